@@ -21,6 +21,15 @@
 #error "clockdrv_shell.h: Fast Idle PLUS n ISRs per tick is not supported"
 #endif
 
+#if CLOCK_DRIVER_USE_TICKLESS && \
+  (CLOCK_DRIVER_USE_FAST_IDLE || CLOCK_DRIVER_ISRS_PER_TICK)
+#error "clockdrv_shell.h: Tickless PLUS Fast Idle or n ISRs per tick is not supported"
+#endif
+
+#if CLOCK_DRIVER_USE_TICKLESS
+  #include <rtems/score/userextimpl.h>
+#endif
+
 /*
  * This method is rarely used so default it.
  */
@@ -42,6 +51,52 @@ volatile uint32_t    Clock_driver_ticks;
 
 void Clock_exit( void );
 
+#if CLOCK_DRIVER_USE_TICKLESS
+/*
+ *  In tickless mode the BSP provides a one-shot event instead of a periodic
+ *  tick.  The BSP must define
+ *
+ *    Clock_driver_support_get_elapsed_nanoseconds() - returns the nanoseconds
+ *      elapsed since its previous call, this is the reference point of the
+ *      next event,
+ *
+ *    Clock_driver_support_set_event( nanoseconds ) - programs the event
+ *      relative to the reference point, an event already in the past must
+ *      trigger the interrupt immediately.
+ *
+ *  Both are called with interrupts disabled.
+ */
+static void Clock_driver_program_next_event( void )
+{
+  rtems_interrupt_level level;
+
+  rtems_interrupt_disable( level );
+  Clock_driver_support_set_event( rtems_clock_get_nanoseconds_to_next_event() );
+  rtems_interrupt_enable( level );
+}
+
+/*
+ *  A thread with a timeslice budget needs an event at each tick boundary.
+ */
+static void Clock_driver_thread_switch(
+  Thread_Control *executing,
+  Thread_Control *heir
+)
+{
+  (void) executing;
+
+  if ( heir->budget_algorithm != THREAD_CPU_BUDGET_ALGORITHM_NONE ) {
+    Clock_driver_program_next_event();
+  }
+}
+
+static const User_extensions_Table Clock_driver_extensions_table = {
+  .thread_switch = Clock_driver_thread_switch
+};
+
+static User_extensions_Control Clock_driver_extensions;
+#endif
+
 /*
  *  Clock_isr
  *
@@ -89,7 +144,16 @@ rtems_isr Clock_isr(
      */
     Clock_driver_support_at_tick();
 
-    #if CLOCK_DRIVER_ISRS_PER_TICK
+    #if CLOCK_DRIVER_USE_TICKLESS
+      /*
+       *  The driver announces the elapsed time and programs the next event.
+       */
+      rtems_clock_tick_nanoseconds(
+        Clock_driver_support_get_elapsed_nanoseconds()
+      );
+
+      Clock_driver_program_next_event();
+    #elif CLOCK_DRIVER_ISRS_PER_TICK
       /*
        *  The driver is multiple ISRs per clock tick.
        */
@@ -177,6 +241,19 @@ rtems_device_driver Clock_initialize(
    */
   Clock_driver_support_initialize_hardware();
 
+  #if CLOCK_DRIVER_USE_TICKLESS
+    (void) Clock_driver_support_get_elapsed_nanoseconds();
+
+    rtems_clock_set_next_event_extension( Clock_driver_program_next_event );
+
+    _User_extensions_Add_set_with_table(
+      &Clock_driver_extensions,
+      &Clock_driver_extensions_table
+    );
+
+    Clock_driver_program_next_event();
+  #endif
+
   atexit( Clock_exit );
 
   /*
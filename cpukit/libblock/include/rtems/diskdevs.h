@@ -83,6 +83,15 @@ typedef struct {
    * be arbitrary.
    */
   rtems_blkdev_bnum next;
+
+  /**
+   * @brief Block count of the next read-ahead request.
+   *
+   * The window is reset for each new sequential access stream and grows
+   * geometrically up to the maximum read-ahead blocks of the bdbuf
+   * configuration as long as the access stays sequential.
+   */
+  uint32_t window;
 } rtems_blkdev_read_ahead;
 
 /**
@@ -115,6 +124,14 @@ typedef struct {
    */
   uint32_t read_ahead_transfers;
 
+  /**
+   * @brief Current read-ahead window in blocks.
+   *
+   * This is the block count of the next read-ahead transfer.  It is not a
+   * counter and not affected by a statistics reset.
+   */
+  uint32_t read_ahead_window;
+
   /**
    * @brief Count of blocks transfered from the device.
    */
@@ -145,6 +162,23 @@ typedef struct {
    * Error count of transfers issued by write requests.
    */
   uint32_t write_errors;
+
+  /**
+   * @brief Count of write transfers with the maximum write blocks.
+   *
+   * Such a transfer may have been split from a longer write.  A high count
+   * indicates the maximum write blocks of the cache configuration is too
+   * small.
+   */
+  uint32_t write_full_transfers;
+
+  /**
+   * @brief Count of blocks coalesced into a write.
+   *
+   * The swapout task writes modified blocks next to blocks with an expired
+   * hold timer along with them to get fewer, larger writes.
+   */
+  uint32_t write_coalesced_blocks;
 } rtems_blkdev_stats;
 
 /**
@@ -114,8 +114,10 @@ typedef struct rtems_bdbuf_cache
                                           * BDBUF_INVALID_DEV not a device
                                           * sync. */
 
-  rtems_bdbuf_buffer* tree;              /**< Buffer descriptor lookup AVL tree
-                                          * root. There is only one. */
+  rtems_bdbuf_buffer** hash_table;       /**< Buffer descriptor lookup hash
+                                          * table. There is only one. */
+  size_t              hash_mask;         /**< Hash table size minus one. The
+                                          * size is a power of two. */
   rtems_chain_control lru;               /**< Least recently used list */
   rtems_chain_control modified;          /**< Modified buffers list */
   rtems_chain_control sync;              /**< Buffers to sync list */
@@ -295,12 +297,12 @@ rtems_bdbuf_show_users (const char* where, rtems_bdbuf_buffer* bd)
 #endif
 
 /**
- * The default maximum height of 32 allows for AVL trees having between
- * 5,704,880 and 4,294,967,295 nodes, depending on order of insertion.  You may
- * change this compile-time constant as you wish.
+ * The read-ahead window in blocks for a new sequential access stream.  The
+ * window doubles with each read-ahead request up to the maximum read-ahead
+ * blocks of the configuration.
  */
-#ifndef RTEMS_BDBUF_AVL_MAX_HEIGHT
-#define RTEMS_BDBUF_AVL_MAX_HEIGHT (32)
+#ifndef RTEMS_BDBUF_READ_AHEAD_INITIAL_WINDOW
+#define RTEMS_BDBUF_READ_AHEAD_INITIAL_WINDOW (2)
 #endif
 
 static void
@@ -316,493 +318,100 @@ rtems_bdbuf_fatal_with_state (rtems_bdbuf_buf_state state,
   rtems_bdbuf_fatal ((((uint32_t) state) << 16) | error);
 }
 
+/**
+ * Returns the hash bucket for the specified dd/block.
+ *
+ * Consecutive blocks of a device map to consecutive buckets.  The device
+ * address selects a pseudo random start bucket for each device.
+ *
+ * @param dd disk device key
+ * @param block block key
+ * @return pointer to the head of the hash bucket
+ */
+static rtems_bdbuf_buffer **
+rtems_bdbuf_hash_bucket (const rtems_disk_device *dd,
+                         rtems_blkdev_bnum        block)
+{
+  uint32_t dd_hash =
+    (uint32_t) ((uintptr_t) dd >> 4) * UINT32_C (0x9e3779b1);
+
+  return &bdbuf_cache.hash_table [(dd_hash + block) & bdbuf_cache.hash_mask];
+}
+
 /**
  * Searches for the node with specified dd/block.
  *
- * @param root pointer to the root node of the AVL-Tree
  * @param dd disk device search key
  * @param block block search key
  * @retval NULL node with the specified dd/block is not found
  * @return pointer to the node with specified dd/block
  */
 static rtems_bdbuf_buffer *
-rtems_bdbuf_avl_search (rtems_bdbuf_buffer** root,
-                        const rtems_disk_device *dd,
-                        rtems_blkdev_bnum    block)
+rtems_bdbuf_hash_search (const rtems_disk_device *dd,
+                         rtems_blkdev_bnum        block)
 {
-  rtems_bdbuf_buffer* p = *root;
+  rtems_bdbuf_buffer* p = *rtems_bdbuf_hash_bucket (dd, block);
 
   while ((p != NULL) && ((p->dd != dd) || (p->block != block)))
-  {
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p = p->avl.right;
-    }
-    else
-    {
-      p = p->avl.left;
-    }
-  }
+    p = p->hash_next;
 
   return p;
 }
 
 /**
- * Inserts the specified node to the AVl-Tree.
+ * Inserts the specified node to the hash table.
  *
- * @param root pointer to the root node of the AVL-Tree
  * @param node Pointer to the node to add.
  * @retval 0 The node added successfully
  * @retval -1 An error occured
  */
 static int
-rtems_bdbuf_avl_insert(rtems_bdbuf_buffer** root,
-                       rtems_bdbuf_buffer*  node)
+rtems_bdbuf_hash_insert (rtems_bdbuf_buffer* node)
 {
-  const rtems_disk_device *dd = node->dd;
-  rtems_blkdev_bnum block = node->block;
-
-  rtems_bdbuf_buffer*  p = *root;
-  rtems_bdbuf_buffer*  q;
-  rtems_bdbuf_buffer*  p1;
-  rtems_bdbuf_buffer*  p2;
-  rtems_bdbuf_buffer*  buf_stack[RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer** buf_prev = buf_stack;
-
-  bool modified = false;
-
-  if (p == NULL)
-  {
-    *root = node;
-    node->avl.left = NULL;
-    node->avl.right = NULL;
-    node->avl.bal = 0;
-    return 0;
-  }
+  rtems_bdbuf_buffer** bucket = rtems_bdbuf_hash_bucket (node->dd,
+                                                         node->block);
+  rtems_bdbuf_buffer*  p = *bucket;
 
   while (p != NULL)
   {
-    *buf_prev++ = p;
-
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p->avl.cache = 1;
-      q = p->avl.right;
-      if (q == NULL)
-      {
-        q = node;
-        p->avl.right = q = node;
-        break;
-      }
-    }
-    else if ((p->dd != dd) || (p->block != block))
-    {
-      p->avl.cache = -1;
-      q = p->avl.left;
-      if (q == NULL)
-      {
-        q = node;
-        p->avl.left = q;
-        break;
-      }
-    }
-    else
-    {
+    if ((p->dd == node->dd) && (p->block == node->block))
       return -1;
-    }
 
-    p = q;
+    p = p->hash_next;
   }
 
-  q->avl.left = q->avl.right = NULL;
-  q->avl.bal = 0;
-  modified = true;
-  buf_prev--;
-
-  while (modified)
-  {
-    if (p->avl.cache == -1)
-    {
-      switch (p->avl.bal)
-      {
-        case 1:
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        case 0:
-          p->avl.bal = -1;
-          break;
-
-        case -1:
-          p1 = p->avl.left;
-          if (p1->avl.bal == -1) /* simple LL-turn */
-          {
-            p->avl.left = p1->avl.right;
-            p1->avl.right = p;
-            p->avl.bal = 0;
-            p = p1;
-          }
-          else /* double LR-turn */
-          {
-            p2 = p1->avl.right;
-            p1->avl.right = p2->avl.left;
-            p2->avl.left = p1;
-            p->avl.left = p2->avl.right;
-            p2->avl.right = p;
-            if (p2->avl.bal == -1) p->avl.bal = +1; else p->avl.bal = 0;
-            if (p2->avl.bal == +1) p1->avl.bal = -1; else p1->avl.bal = 0;
-            p = p2;
-          }
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        default:
-          break;
-      }
-    }
-    else
-    {
-      switch (p->avl.bal)
-      {
-        case -1:
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        case 0:
-          p->avl.bal = 1;
-          break;
-
-        case 1:
-          p1 = p->avl.right;
-          if (p1->avl.bal == 1) /* simple RR-turn */
-          {
-            p->avl.right = p1->avl.left;
-            p1->avl.left = p;
-            p->avl.bal = 0;
-            p = p1;
-          }
-          else /* double RL-turn */
-          {
-            p2 = p1->avl.left;
-            p1->avl.left = p2->avl.right;
-            p2->avl.right = p1;
-            p->avl.right = p2->avl.left;
-            p2->avl.left = p;
-            if (p2->avl.bal == +1) p->avl.bal = -1; else p->avl.bal = 0;
-            if (p2->avl.bal == -1) p1->avl.bal = +1; else p1->avl.bal = 0;
-            p = p2;
-          }
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        default:
-          break;
-      }
-    }
-    q = p;
-    if (buf_prev > buf_stack)
-    {
-      p = *--buf_prev;
-
-      if (p->avl.cache == -1)
-      {
-        p->avl.left = q;
-      }
-      else
-      {
-        p->avl.right = q;
-      }
-    }
-    else
-    {
-      *root = p;
-      break;
-    }
-  };
+  node->hash_next = *bucket;
+  *bucket = node;
 
   return 0;
 }
 
-
 /**
- * Removes the node from the tree.
+ * Removes the node from the hash table.
  *
- * @param root Pointer to pointer to the root node
  * @param node Pointer to the node to remove
  * @retval 0 Item removed
  * @retval -1 No such item found
  */
 static int
-rtems_bdbuf_avl_remove(rtems_bdbuf_buffer**      root,
-                       const rtems_bdbuf_buffer* node)
+rtems_bdbuf_hash_remove (rtems_bdbuf_buffer* node)
 {
-  const rtems_disk_device *dd = node->dd;
-  rtems_blkdev_bnum block = node->block;
-
-  rtems_bdbuf_buffer*  p = *root;
-  rtems_bdbuf_buffer*  q;
-  rtems_bdbuf_buffer*  r;
-  rtems_bdbuf_buffer*  s;
-  rtems_bdbuf_buffer*  p1;
-  rtems_bdbuf_buffer*  p2;
-  rtems_bdbuf_buffer*  buf_stack[RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer** buf_prev = buf_stack;
+  rtems_bdbuf_buffer** prev = rtems_bdbuf_hash_bucket (node->dd,
+                                                       node->block);
 
-  bool modified = false;
-
-  memset (buf_stack, 0, sizeof(buf_stack));
-
-  while (p != NULL)
+  while (*prev != NULL)
   {
-    *buf_prev++ = p;
-
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
+    if (*prev == node)
     {
-      p->avl.cache = 1;
-      p = p->avl.right;
+      *prev = node->hash_next;
+      node->hash_next = NULL;
+      return 0;
     }
-    else if ((p->dd != dd) || (p->block != block))
-    {
-      p->avl.cache = -1;
-      p = p->avl.left;
-    }
-    else
-    {
-      /* node found */
-      break;
-    }
-  }
-
-  if (p == NULL)
-  {
-    /* there is no such node */
-    return -1;
-  }
-
-  q = p;
-
-  buf_prev--;
-  if (buf_prev > buf_stack)
-  {
-    p = *(buf_prev - 1);
-  }
-  else
-  {
-    p = NULL;
-  }
-
-  /* at this moment q - is a node to delete, p is q's parent */
-  if (q->avl.right == NULL)
-  {
-    r = q->avl.left;
-    if (r != NULL)
-    {
-      r->avl.bal = 0;
-    }
-    q = r;
-  }
-  else
-  {
-    rtems_bdbuf_buffer **t;
-
-    r = q->avl.right;
 
-    if (r->avl.left == NULL)
-    {
-      r->avl.left = q->avl.left;
-      r->avl.bal = q->avl.bal;
-      r->avl.cache = 1;
-      *buf_prev++ = q = r;
-    }
-    else
-    {
-      t = buf_prev++;
-      s = r;
-
-      while (s->avl.left != NULL)
-      {
-        *buf_prev++ = r = s;
-        s = r->avl.left;
-        r->avl.cache = -1;
-      }
-
-      s->avl.left = q->avl.left;
-      r->avl.left = s->avl.right;
-      s->avl.right = q->avl.right;
-      s->avl.bal = q->avl.bal;
-      s->avl.cache = 1;
-
-      *t = q = s;
-    }
-  }
-
-  if (p != NULL)
-  {
-    if (p->avl.cache == -1)
-    {
-      p->avl.left = q;
-    }
-    else
-    {
-      p->avl.right = q;
-    }
-  }
-  else
-  {
-    *root = q;
+    prev = &(*prev)->hash_next;
   }
 
-  modified = true;
-
-  while (modified)
-  {
-    if (buf_prev > buf_stack)
-    {
-      p = *--buf_prev;
-    }
-    else
-    {
-      break;
-    }
-
-    if (p->avl.cache == -1)
-    {
-      /* rebalance left branch */
-      switch (p->avl.bal)
-      {
-        case -1:
-          p->avl.bal = 0;
-          break;
-        case  0:
-          p->avl.bal = 1;
-          modified = false;
-          break;
-
-        case +1:
-          p1 = p->avl.right;
-
-          if (p1->avl.bal >= 0) /* simple RR-turn */
-          {
-            p->avl.right = p1->avl.left;
-            p1->avl.left = p;
-
-            if (p1->avl.bal == 0)
-            {
-              p1->avl.bal = -1;
-              modified = false;
-            }
-            else
-            {
-              p->avl.bal = 0;
-              p1->avl.bal = 0;
-            }
-            p = p1;
-          }
-          else /* double RL-turn */
-          {
-            p2 = p1->avl.left;
-
-            p1->avl.left = p2->avl.right;
-            p2->avl.right = p1;
-            p->avl.right = p2->avl.left;
-            p2->avl.left = p;
-
-            if (p2->avl.bal == +1) p->avl.bal = -1; else p->avl.bal = 0;
-            if (p2->avl.bal == -1) p1->avl.bal = 1; else p1->avl.bal = 0;
-
-            p = p2;
-            p2->avl.bal = 0;
-          }
-          break;
-
-        default:
-          break;
-      }
-    }
-    else
-    {
-      /* rebalance right branch */
-      switch (p->avl.bal)
-      {
-        case +1:
-          p->avl.bal = 0;
-          break;
-
-        case  0:
-          p->avl.bal = -1;
-          modified = false;
-          break;
-
-        case -1:
-          p1 = p->avl.left;
-
-          if (p1->avl.bal <= 0) /* simple LL-turn */
-          {
-            p->avl.left = p1->avl.right;
-            p1->avl.right = p;
-            if (p1->avl.bal == 0)
-            {
-              p1->avl.bal = 1;
-              modified = false;
-            }
-            else
-            {
-              p->avl.bal = 0;
-              p1->avl.bal = 0;
-            }
-            p = p1;
-          }
-          else /* double LR-turn */
-          {
-            p2 = p1->avl.right;
-
-            p1->avl.right = p2->avl.left;
-            p2->avl.left = p1;
-            p->avl.left = p2->avl.right;
-            p2->avl.right = p;
-
-            if (p2->avl.bal == -1) p->avl.bal = 1; else p->avl.bal = 0;
-            if (p2->avl.bal == +1) p1->avl.bal = -1; else p1->avl.bal = 0;
-
-            p = p2;
-            p2->avl.bal = 0;
-          }
-          break;
-
-        default:
-          break;
-      }
-    }
-
-    if (buf_prev > buf_stack)
-    {
-      q = *(buf_prev - 1);
-
-      if (q->avl.cache == -1)
-      {
-        q->avl.left = p;
-      }
-      else
-      {
-        q->avl.right = p;
-      }
-    }
-    else
-    {
-      *root = p;
-      break;
-    }
-
-  }
-
-  return 0;
+  return -1;
 }
 
 static void
@@ -1028,21 +637,21 @@ rtems_bdbuf_has_buffer_waiters (void)
 }
 
 static void
-rtems_bdbuf_remove_from_tree (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_index (rtems_bdbuf_buffer *bd)
 {
-  if (rtems_bdbuf_avl_remove (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_hash_remove (bd) != 0)
     rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_TREE_RM);
 }
 
 static void
-rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_remove_from_index_and_lru_list (rtems_bdbuf_buffer *bd)
 {
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_FREE:
       break;
     case RTEMS_BDBUF_STATE_CACHED:
-      rtems_bdbuf_remove_from_tree (bd);
+      rtems_bdbuf_remove_from_index (bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_10);
@@ -1078,7 +687,7 @@ rtems_bdbuf_discard_buffer (rtems_bdbuf_buffer *bd)
 
   if (bd->waiters == 0)
   {
-    rtems_bdbuf_remove_from_tree (bd);
+    rtems_bdbuf_remove_from_index (bd);
     rtems_bdbuf_make_free_and_add_to_lru_list (bd);
   }
 }
@@ -1173,7 +782,7 @@ rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_buffer *bd)
 
 /**
  * Reallocate a group. The BDs currently allocated in the group are removed
- * from the ALV tree and any lists then the new BD's are prepended to the ready
+ * from the hash table and any lists then the new BD's are prepended to the ready
  * list of the cache.
  *
  * @param group The group to reallocate.
@@ -1197,7 +806,7 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
   for (b = 0, bd = group->bdbuf;
        b < group->bds_per_group;
        b++, bd += bufs_per_bd)
-    rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+    rtems_bdbuf_remove_from_index_and_lru_list (bd);
 
   group->bds_per_group = new_bds_per_group;
   bufs_per_bd = bdbuf_cache.max_bds_per_group / new_bds_per_group;
@@ -1220,11 +829,10 @@ rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
 {
   bd->dd        = dd ;
   bd->block     = block;
-  bd->avl.left  = NULL;
-  bd->avl.right = NULL;
+  bd->hash_next = NULL;
   bd->waiters   = 0;
 
-  if (rtems_bdbuf_avl_insert (&bdbuf_cache.tree, bd) != 0)
+  if (rtems_bdbuf_hash_insert (bd) != 0)
     rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RECYCLE);
 
   rtems_bdbuf_make_empty (bd);
@@ -1254,7 +862,7 @@ rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
     {
       if (bd->group->bds_per_group == dd->bds_per_group)
       {
-        rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+        rtems_bdbuf_remove_from_index_and_lru_list (bd);
 
         empty_bd = bd;
       }
@@ -1490,6 +1098,19 @@ rtems_bdbuf_init (void)
   if (!bdbuf_cache.bds)
     goto error;
 
+  /*
+   * Allocate the buffer descriptor lookup hash table.  It has at least one
+   * bucket for each buffer descriptor.
+   */
+  bdbuf_cache.hash_mask = 1;
+  while (bdbuf_cache.hash_mask < bdbuf_cache.buffer_min_count)
+    bdbuf_cache.hash_mask <<= 1;
+  bdbuf_cache.hash_table = calloc (sizeof (rtems_bdbuf_buffer *),
+                                   bdbuf_cache.hash_mask);
+  if (!bdbuf_cache.hash_table)
+    goto error;
+  --bdbuf_cache.hash_mask;
+
   /*
    * Allocate the memory for the buffer descriptors.
    */
@@ -1623,6 +1244,7 @@ error:
 
   free (bdbuf_cache.buffers);
   free (bdbuf_cache.groups);
+  free (bdbuf_cache.hash_table);
   free (bdbuf_cache.bds);
   free (bdbuf_cache.swapout_transfer);
   free (bdbuf_cache.swapout_workers);
@@ -1816,7 +1438,7 @@ rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
   {
     if (bd->state == RTEMS_BDBUF_STATE_EMPTY)
     {
-      rtems_bdbuf_remove_from_tree (bd);
+      rtems_bdbuf_remove_from_index (bd);
       rtems_bdbuf_make_free_and_add_to_lru_list (bd);
     }
     rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
@@ -1829,7 +1451,7 @@ rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
 {
   rtems_bdbuf_buffer *bd = NULL;
 
-  bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+  bd = rtems_bdbuf_hash_search (dd, block);
 
   if (bd == NULL)
   {
@@ -1856,7 +1478,7 @@ rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
 
   do
   {
-    bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+    bd = rtems_bdbuf_hash_search (dd, block);
 
     if (bd != NULL)
     {
@@ -1864,7 +1486,7 @@ rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
       {
         if (rtems_bdbuf_wait_for_recycle (bd))
         {
-          rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+          rtems_bdbuf_remove_from_index_and_lru_list (bd);
           rtems_bdbuf_make_free_and_add_to_lru_list (bd);
           rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
         }
@@ -2021,6 +1643,8 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
   {
     dd->stats.write_blocks += req->bufnum;
     ++dd->stats.write_transfers;
+    if (req->bufnum >= bdbuf_config.max_write_blocks)
+      ++dd->stats.write_full_transfers;
     if (sc != RTEMS_SUCCESSFUL)
       ++dd->stats.write_errors;
   }
@@ -2174,9 +1798,15 @@ rtems_bdbuf_set_read_ahead_trigger (rtems_disk_device *dd,
 {
   if (dd->read_ahead.trigger != block)
   {
+    uint32_t window = RTEMS_BDBUF_READ_AHEAD_INITIAL_WINDOW;
+
+    if (window > bdbuf_config.max_read_ahead_blocks)
+      window = bdbuf_config.max_read_ahead_blocks;
+
     rtems_bdbuf_read_ahead_cancel (dd);
     dd->read_ahead.trigger = block + 1;
     dd->read_ahead.next = block + 2;
+    dd->read_ahead.window = window;
   }
 }
 
@@ -2386,6 +2016,188 @@ rtems_bdbuf_syncdev (rtems_disk_device *dd)
   return RTEMS_SUCCESSFUL;
 }
 
+/**
+ * The number of sorted sub-lists of the swapout sort. The sub-list with index
+ * b has a length of 2^b, so this is enough for any number of buffers.
+ */
+#define RTEMS_BDBUF_SWAPOUT_SORT_BINS (32)
+
+/**
+ * Merge two lists of buffers sorted in block order which are linked by the
+ * next pointer of the chain node. Equal blocks are taken from the first list
+ * first.
+ *
+ * @param first The list of the earlier buffers.
+ * @param second The list of the later buffers.
+ * @return The merged list.
+ */
+static rtems_chain_node*
+rtems_bdbuf_swapout_merge (rtems_chain_node* first, rtems_chain_node* second)
+{
+  rtems_chain_node  head;
+  rtems_chain_node* tail = &head;
+
+  while (first != NULL && second != NULL)
+  {
+    if (((rtems_bdbuf_buffer*) second)->block
+          < ((rtems_bdbuf_buffer*) first)->block)
+    {
+      tail->next = second;
+      second = second->next;
+    }
+    else
+    {
+      tail->next = first;
+      first = first->next;
+    }
+
+    tail = tail->next;
+  }
+
+  tail->next = first != NULL ? first : second;
+
+  return head.next;
+}
+
+/**
+ * Sort the buffers of a transfer in block order. The buffers are written with
+ * one sweep over the device and adjacent blocks end up next to each other so
+ * the write can coalesce them. This is a bottom-up merge sort so it needs
+ * O(n log n) steps no matter in which order the buffers were modified.
+ *
+ * @param bds The transfer list of buffers.
+ */
+static void
+rtems_bdbuf_swapout_sort (rtems_chain_control* bds)
+{
+  rtems_chain_node* bins[RTEMS_BDBUF_SWAPOUT_SORT_BINS];
+  rtems_chain_node* node;
+  size_t            b;
+
+  memset (bins, 0, sizeof (bins));
+
+  while ((node = rtems_chain_get_unprotected (bds)) != NULL)
+  {
+    node->next = NULL;
+
+    for (b = 0; b < RTEMS_BDBUF_SWAPOUT_SORT_BINS - 1 && bins[b] != NULL; ++b)
+    {
+      node = rtems_bdbuf_swapout_merge (bins[b], node);
+      bins[b] = NULL;
+    }
+
+    if (bins[b] != NULL)
+      node = rtems_bdbuf_swapout_merge (bins[b], node);
+
+    bins[b] = node;
+  }
+
+  node = NULL;
+
+  for (b = 0; b < RTEMS_BDBUF_SWAPOUT_SORT_BINS; ++b)
+  {
+    if (bins[b] != NULL)
+      node = rtems_bdbuf_swapout_merge (bins[b], node);
+  }
+
+  while (node != NULL)
+  {
+    rtems_chain_node* next = node->next;
+
+    rtems_chain_append_unprotected (bds, node);
+    node = next;
+  }
+}
+
+/**
+ * Check if a swapout worker writes to the device. The cache must be locked.
+ *
+ * @param dd The device.
+ * @retval true A worker writes to the device.
+ * @retval false Otherwise.
+ */
+static bool
+rtems_bdbuf_swapout_is_device_busy (const rtems_disk_device *dd)
+{
+  char   *worker_current = (char *) bdbuf_cache.swapout_workers;
+  size_t  worker_size = rtems_bdbuf_swapout_worker_size ();
+  size_t  w;
+
+  if (worker_current == NULL)
+    return false;
+
+  for (w = 0;
+       w < bdbuf_config.swapout_workers;
+       w++, worker_current += worker_size)
+  {
+    rtems_bdbuf_swapout_worker *worker =
+      (rtems_bdbuf_swapout_worker *) worker_current;
+
+    if (worker->transfer.dd == dd)
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * Coalesce the modified buffers adjacent to the buffers of a transfer into
+ * the transfer although their hold timer has not expired yet. This turns
+ * several small writes of a device into fewer, larger ones. At most the
+ * maximum write blocks are coalesced at once so the hold timers keep their
+ * meaning. The cache must be locked.
+ *
+ * @param transfer The transfer transaction.
+ */
+static void
+rtems_bdbuf_swapout_coalesce (rtems_bdbuf_swapout_transfer* transfer)
+{
+  rtems_disk_device *dd = transfer->dd;
+  rtems_chain_node  *node;
+  uint32_t           budget = bdbuf_config.max_write_blocks;
+  uint32_t           media_blocks_per_block;
+
+  if (dd == BDBUF_INVALID_DEV)
+    return;
+
+  media_blocks_per_block = dd->media_blocks_per_block;
+
+  /*
+   * Buffers appended by this loop are visited as well, so whole runs are
+   * coalesced.
+   */
+  node = rtems_chain_first (&transfer->bds);
+  while (budget > 0 && !rtems_chain_is_tail (&transfer->bds, node))
+  {
+    rtems_bdbuf_buffer* bd = (rtems_bdbuf_buffer*) node;
+    int                 direction;
+
+    for (direction = -1; direction <= 1; direction += 2)
+    {
+      rtems_blkdev_bnum   block = bd->block
+        + direction * (rtems_blkdev_bnum) media_blocks_per_block;
+      rtems_bdbuf_buffer* neighbour;
+
+      if (budget == 0 || (direction < 0 && bd->block < media_blocks_per_block))
+        continue;
+
+      neighbour = rtems_bdbuf_hash_search (dd, block);
+
+      if (neighbour != NULL
+          && neighbour->state == RTEMS_BDBUF_STATE_MODIFIED)
+      {
+        rtems_bdbuf_set_state (neighbour, RTEMS_BDBUF_STATE_TRANSFER);
+        rtems_chain_extract_unprotected (&neighbour->link);
+        rtems_chain_append_unprotected (&transfer->bds, &neighbour->link);
+        ++dd->stats.write_coalesced_blocks;
+        --budget;
+      }
+    }
+
+    node = rtems_chain_next (node);
+  }
+}
+
 /**
  * Swapout transfer to the driver. The driver will break this I/O into groups
  * of consecutive write requests is multiple consecutive buffers are required
@@ -2429,6 +2241,8 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
     transfer->write_req.status = RTEMS_RESOURCE_IN_USE;
     transfer->write_req.bufnum = 0;
 
+    rtems_bdbuf_swapout_sort (&transfer->bds);
+
     while ((node = rtems_chain_get_unprotected(&transfer->bds)) != NULL)
     {
       rtems_bdbuf_buffer* bd = (rtems_bdbuf_buffer*) node;
@@ -2567,44 +2381,27 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
       /*
        * This assumes we can set it to BDBUF_INVALID_DEV which is just an
        * assumption. Cannot use the transfer list being empty the sync dev
-       * calls sets the dev to use.
+       * calls sets the dev to use. Unless syncing skip the devices a worker
+       * writes to so that each device is written by one worker in block
+       * order at a time.
        */
-      if (*dd_ptr == BDBUF_INVALID_DEV)
+      if (*dd_ptr == BDBUF_INVALID_DEV
+          && (sync_active || !rtems_bdbuf_swapout_is_device_busy (bd->dd)))
         *dd_ptr = bd->dd;
 
       if (bd->dd == *dd_ptr)
       {
         rtems_chain_node* next_node = node->next;
-        rtems_chain_node* tnode = rtems_chain_tail (transfer);
 
         /*
-         * The blocks on the transfer list are sorted in block order. This
-         * means multi-block transfers for drivers that require consecutive
-         * blocks perform better with sorted blocks and for real disks it may
-         * help lower head movement.
+         * The transfer list is sorted in block order by the swapout write
+         * after the cache is unlocked.
          */
 
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
 
         rtems_chain_extract_unprotected (node);
-
-        tnode = tnode->previous;
-
-        while (node && !rtems_chain_is_head (transfer, tnode))
-        {
-          rtems_bdbuf_buffer* tbd = (rtems_bdbuf_buffer*) tnode;
-
-          if (bd->block > tbd->block)
-          {
-            rtems_chain_insert_unprotected (tnode, node);
-            node = NULL;
-          }
-          else
-            tnode = tnode->previous;
-        }
-
-        if (node)
-          rtems_chain_prepend_unprotected (transfer, node);
+        rtems_chain_append_unprotected (transfer, node);
 
         node = next_node;
       }
@@ -2693,6 +2490,22 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
                                            update_timers,
                                            timer_delta);
 
+  /*
+   * Write the modified buffers next to the selected ones in the same go.
+   */
+  rtems_bdbuf_swapout_coalesce (transfer);
+
+  /*
+   * Give the worker back if there is nothing to transfer, otherwise it would
+   * be lost for all further swapout passes.
+   */
+  if (worker && rtems_chain_is_empty (&transfer->bds))
+  {
+    rtems_chain_append_unprotected (&bdbuf_cache.swapout_free_workers,
+                                    &worker->link);
+    worker = NULL;
+  }
+
   /*
    * We have all the buffers that have been modified for this device so the
    * cache can be unlocked because the state of each buffer has been set to
@@ -2759,6 +2572,13 @@ rtems_bdbuf_swapout_worker_task (rtems_task_argument arg)
 
     rtems_chain_append_unprotected (&bdbuf_cache.swapout_free_workers, &worker->link);
 
+    /*
+     * The swapout task skips the devices of busy workers. Let it check for
+     * buffers of this device which expired in the meantime.
+     */
+    if (!rtems_chain_is_empty (&bdbuf_cache.modified))
+      rtems_bdbuf_wake_swapper ();
+
     rtems_bdbuf_unlock_cache ();
   }
 
@@ -2802,6 +2622,9 @@ rtems_bdbuf_swapout_task (rtems_task_argument arg)
   rtems_bdbuf_swapout_transfer* transfer = (rtems_bdbuf_swapout_transfer *) arg;
   uint32_t                      period_in_ticks;
   const uint32_t                period_in_msecs = bdbuf_config.swapout_period;
+  const uint32_t                usecs_per_tick =
+    rtems_configuration_get_microseconds_per_tick ();
+  rtems_interval                last_update;
   uint32_t                      timer_delta;
 
   /*
@@ -2809,21 +2632,34 @@ rtems_bdbuf_swapout_task (rtems_task_argument arg)
    */
   period_in_ticks = RTEMS_MICROSECONDS_TO_TICKS (period_in_msecs * 1000);
 
-  /*
-   * This is temporary. Needs to be changed to use the real time clock.
-   */
-  timer_delta = period_in_msecs;
+  last_update = rtems_clock_get_ticks_since_boot ();
 
   while (bdbuf_cache.swapout_enabled)
   {
     rtems_event_set   out;
     rtems_status_code sc;
+    rtems_interval    now;
 
     /*
      * Only update the timers once in the processing cycle.
      */
     bool update_timers = true;
 
+    /*
+     * The swapout task is woken up before the end of the period by the
+     * workers, sync requests and buffer waiters. Age the hold timers by the
+     * time which actually passed. A wake up within the same milli-second
+     * does not age the timers.
+     */
+    now = rtems_clock_get_ticks_since_boot ();
+    timer_delta = (uint32_t) (((uint64_t) (now - last_update)
+                               * usecs_per_tick) / 1000);
+
+    if (timer_delta > 0)
+      last_update = now;
+    else
+      update_timers = false;
+
     /*
      * If we write buffers to any disk perform a check again. We only write a
      * single device at a time and the cache may have more than one device's
@@ -2894,75 +2730,47 @@ static void
 rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
                               const rtems_disk_device *dd)
 {
-  rtems_bdbuf_buffer *stack [RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer **prev = stack;
-  rtems_bdbuf_buffer *cur = bdbuf_cache.tree;
+  size_t bucket;
 
-  *prev = NULL;
-
-  while (cur != NULL)
+  for (bucket = 0; bucket <= bdbuf_cache.hash_mask; ++bucket)
   {
-    if (cur->dd == dd)
-    {
-      switch (cur->state)
-      {
-        case RTEMS_BDBUF_STATE_FREE:
-        case RTEMS_BDBUF_STATE_EMPTY:
-        case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-          break;
-        case RTEMS_BDBUF_STATE_SYNC:
-          rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
-          /* Fall through */
-        case RTEMS_BDBUF_STATE_MODIFIED:
-          rtems_bdbuf_group_release (cur);
-          /* Fall through */
-        case RTEMS_BDBUF_STATE_CACHED:
-          rtems_chain_extract_unprotected (&cur->link);
-          rtems_chain_append_unprotected (purge_list, &cur->link);
-          break;
-        case RTEMS_BDBUF_STATE_TRANSFER:
-          rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_TRANSFER_PURGED);
-          break;
-        case RTEMS_BDBUF_STATE_ACCESS_CACHED:
-        case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
-        case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-          rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_ACCESS_PURGED);
-          break;
-        default:
-          rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
-      }
-    }
+    rtems_bdbuf_buffer *cur = bdbuf_cache.hash_table [bucket];
 
-    if (cur->avl.left != NULL)
-    {
-      /* Left */
-      ++prev;
-      *prev = cur;
-      cur = cur->avl.left;
-    }
-    else if (cur->avl.right != NULL)
+    while (cur != NULL)
     {
-      /* Right */
-      ++prev;
-      *prev = cur;
-      cur = cur->avl.right;
-    }
-    else
-    {
-      while (*prev != NULL
-             && (cur == (*prev)->avl.right || (*prev)->avl.right == NULL))
+      if (cur->dd == dd)
       {
-        /* Up */
-        cur = *prev;
-        --prev;
+        switch (cur->state)
+        {
+          case RTEMS_BDBUF_STATE_FREE:
+          case RTEMS_BDBUF_STATE_EMPTY:
+          case RTEMS_BDBUF_STATE_ACCESS_PURGED:
+          case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
+            break;
+          case RTEMS_BDBUF_STATE_SYNC:
+            rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
+            /* Fall through */
+          case RTEMS_BDBUF_STATE_MODIFIED:
+            rtems_bdbuf_group_release (cur);
+            /* Fall through */
+          case RTEMS_BDBUF_STATE_CACHED:
+            rtems_chain_extract_unprotected (&cur->link);
+            rtems_chain_append_unprotected (purge_list, &cur->link);
+            break;
+          case RTEMS_BDBUF_STATE_TRANSFER:
+            rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_TRANSFER_PURGED);
+            break;
+          case RTEMS_BDBUF_STATE_ACCESS_CACHED:
+          case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
+          case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
+            rtems_bdbuf_set_state (cur, RTEMS_BDBUF_STATE_ACCESS_PURGED);
+            break;
+          default:
+            rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
+        }
       }
-      if (*prev != NULL)
-        /* Right */
-        cur = (*prev)->avl.right;
-      else
-        /* Finished */
-        cur = NULL;
+
+      cur = cur->hash_next;
     }
   }
 }
@@ -3068,13 +2876,22 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
         if (bd != NULL)
         {
           uint32_t transfer_count = dd->block_count - block;
-          uint32_t max_transfer_count = bdbuf_config.max_read_ahead_blocks;
+          uint32_t max_transfer_count = dd->read_ahead.window;
 
           if (transfer_count >= max_transfer_count)
           {
             transfer_count = max_transfer_count;
             dd->read_ahead.trigger = block + transfer_count / 2;
             dd->read_ahead.next = block + transfer_count;
+
+            /*
+             * The stream is still sequential, so grow the window for the
+             * next request.
+             */
+            if (max_transfer_count < bdbuf_config.max_read_ahead_blocks / 2)
+              dd->read_ahead.window = 2 * max_transfer_count;
+            else
+              dd->read_ahead.window = bdbuf_config.max_read_ahead_blocks;
           }
           else
           {
@@ -3102,6 +2919,7 @@ void rtems_bdbuf_get_device_stats (const rtems_disk_device *dd,
 {
   rtems_bdbuf_lock_cache ();
   *stats = dd->stats;
+  stats->read_ahead_window = dd->read_ahead.window;
   rtems_bdbuf_unlock_cache ();
 }
 
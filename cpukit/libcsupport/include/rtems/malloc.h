@@ -61,8 +61,61 @@ typedef struct {
     uint32_t    max_depth;		     /* most ever malloc'd at 1 time */
     uintmax_t   lifetime_allocated;
     uintmax_t   lifetime_freed;
+    uint32_t    cache_hits;                  /* # per-CPU cache hits */
+    uint32_t    cache_misses;                /* # per-CPU cache refills */
+    uint32_t    cache_flushes;               /* # per-CPU cache flushes */
 } rtems_malloc_statistics_t;
 
+/**
+ *  @brief Count of size classes of the per-CPU malloc caches.
+ *
+ *  The size classes are powers of two starting with
+ *  RTEMS_MALLOC_CACHE_MINIMUM_SIZE.
+ */
+#define RTEMS_MALLOC_CACHE_CLASS_COUNT 5
+
+/**
+ *  @brief Size of the smallest size class of the per-CPU malloc caches.
+ */
+#define RTEMS_MALLOC_CACHE_MINIMUM_SIZE 16
+
+/**
+ *  @brief Count of objects a per-CPU malloc cache holds for each size class.
+ */
+#define RTEMS_MALLOC_CACHE_MAGAZINE_SIZE 16
+
+/**
+ *  @brief Magazine of free objects of one size class.
+ */
+typedef struct {
+  uint32_t  count;
+  void     *objects[RTEMS_MALLOC_CACHE_MAGAZINE_SIZE];
+} rtems_malloc_cache_magazine;
+
+/**
+ *  @brief Per-CPU malloc cache.
+ *
+ *  Each processor owns one cache.  The cache is only accessed by its owner
+ *  processor with interrupts disabled, so no lock is necessary.  Misses
+ *  refill and full magazines flush a batch of objects from and to the C
+ *  program heap under the allocator lock.
+ */
+typedef struct {
+  rtems_malloc_cache_magazine magazines[RTEMS_MALLOC_CACHE_CLASS_COUNT];
+  uint32_t                    hits;
+  uint32_t                    misses;
+  uint32_t                    flushes;
+} rtems_malloc_cache;
+
+/**
+ *  @brief Table of per-CPU malloc caches indexed by the processor index.
+ *
+ *  It is NULL if the per-CPU malloc caches are not configured.
+ *
+ *  @see CONFIGURE_MALLOC_PER_CPU_CACHES.
+ */
+extern rtems_malloc_cache * const rtems_malloc_caches;
+
 /*
  *  Malloc statistics plugin
  */
@@ -48,6 +48,9 @@ void free(
   if ( rtems_malloc_statistics_helpers )
     (*rtems_malloc_statistics_helpers->at_free)(ptr);
 
+  if ( malloc_cache_free( ptr ) )
+    return;
+
   if ( !_Protected_heap_Free( RTEMS_Malloc_Heap, ptr ) ) {
     printk( "Program heap: free of bad pointer %p -- range %p - %p \n",
       ptr,
@@ -53,12 +53,15 @@ void *malloc(
     return NULL;
 
   /*
-   * Try to give a segment in the current heap if there is not
-   * enough space then try to grow the heap.
+   * Try the per-CPU cache first, then give a segment in the current heap.
+   * If there is not enough space then try to grow the heap.
    * If this fails then return a NULL pointer.
    */
 
-  return_this = _Protected_heap_Allocate( RTEMS_Malloc_Heap, size );
+  return_this = malloc_cache_allocate( size );
+
+  if ( !return_this )
+    return_this = _Protected_heap_Allocate( RTEMS_Malloc_Heap, size );
 
   if ( !return_this ) {
     return_this = (*rtems_malloc_extend_handler)( RTEMS_Malloc_Heap, size );
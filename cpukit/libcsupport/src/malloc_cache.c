@@ -0,0 +1,225 @@
+/**
+ *  @file
+ *
+ *  @brief Per-CPU Malloc Caches
+ *  @ingroup MallocSupport
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef RTEMS_NEWLIB
+#include "malloc_p.h"
+
+#include <rtems/score/apimutex.h>
+#include <rtems/score/isrlevel.h>
+#include <rtems/score/smp.h>
+
+/*
+ *  Count of objects moved between a magazine and the heap at once.
+ */
+#define MALLOC_CACHE_BATCH_SIZE (RTEMS_MALLOC_CACHE_MAGAZINE_SIZE / 2)
+
+#define MALLOC_CACHE_LAST_CLASS (RTEMS_MALLOC_CACHE_CLASS_COUNT - 1)
+
+/*
+ *  A cache is only accessed by its owner processor.  Disabling the
+ *  interrupts of this processor prevents a thread migration and protects
+ *  the cache against interrupt service routines.
+ */
+#if defined(RTEMS_SMP)
+  #define malloc_cache_disable( _level ) _ISR_Disable_without_giant( _level )
+  #define malloc_cache_enable( _level ) _ISR_Enable_without_giant( _level )
+#else
+  #define malloc_cache_disable( _level ) _ISR_Disable( _level )
+  #define malloc_cache_enable( _level ) _ISR_Enable( _level )
+#endif
+
+static uintptr_t malloc_cache_class_size(
+  uint32_t size_class
+)
+{
+  return (uintptr_t) RTEMS_MALLOC_CACHE_MINIMUM_SIZE << size_class;
+}
+
+static rtems_malloc_cache *malloc_cache_get(void)
+{
+  return &rtems_malloc_caches[ _SMP_Get_current_processor() ];
+}
+
+static void malloc_cache_release_batch(
+  void     **batch,
+  uint32_t   count
+)
+{
+  _RTEMS_Lock_allocator();
+
+  while ( count > 0 ) {
+    --count;
+    _Heap_Free( RTEMS_Malloc_Heap, batch[ count ] );
+  }
+
+  _RTEMS_Unlock_allocator();
+}
+
+void *malloc_cache_allocate(
+  size_t size
+)
+{
+  rtems_malloc_cache          *cache;
+  rtems_malloc_cache_magazine *magazine;
+  void                        *batch[ MALLOC_CACHE_BATCH_SIZE ];
+  void                        *object;
+  uintptr_t                    class_size;
+  uint32_t                     size_class = 0;
+  uint32_t                     count;
+  ISR_Level                    level;
+
+  if ( rtems_malloc_caches == NULL )
+    return NULL;
+
+  while ( size > malloc_cache_class_size( size_class ) ) {
+    ++size_class;
+
+    if ( size_class == RTEMS_MALLOC_CACHE_CLASS_COUNT )
+      return NULL;
+  }
+
+  malloc_cache_disable( level );
+  cache = malloc_cache_get();
+  magazine = &cache->magazines[ size_class ];
+
+  if ( magazine->count > 0 ) {
+    ++cache->hits;
+    --magazine->count;
+    object = magazine->objects[ magazine->count ];
+    malloc_cache_enable( level );
+
+    return object;
+  }
+
+  ++cache->misses;
+  malloc_cache_enable( level );
+
+  /*
+   *  Refill the magazine with a batch of objects under one allocator lock.
+   */
+  class_size = malloc_cache_class_size( size_class );
+  count = 0;
+
+  _RTEMS_Lock_allocator();
+
+  while ( count < MALLOC_CACHE_BATCH_SIZE ) {
+    object = _Heap_Allocate( RTEMS_Malloc_Heap, class_size );
+
+    if ( object == NULL )
+      break;
+
+    batch[ count ] = object;
+    ++count;
+  }
+
+  _RTEMS_Unlock_allocator();
+
+  if ( count == 0 )
+    return NULL;
+
+  --count;
+  object = batch[ count ];
+
+  /*
+   *  The executing thread may run on another processor now, so get the cache
+   *  again.  Objects which do not fit into the magazine go back to the heap.
+   */
+  malloc_cache_disable( level );
+  cache = malloc_cache_get();
+  magazine = &cache->magazines[ size_class ];
+
+  while ( count > 0 && magazine->count < RTEMS_MALLOC_CACHE_MAGAZINE_SIZE ) {
+    --count;
+    magazine->objects[ magazine->count ] = batch[ count ];
+    ++magazine->count;
+  }
+
+  malloc_cache_enable( level );
+
+  if ( count > 0 )
+    malloc_cache_release_batch( batch, count );
+
+  return object;
+}
+
+bool malloc_cache_free(
+  void *pointer
+)
+{
+  rtems_malloc_cache          *cache;
+  rtems_malloc_cache_magazine *magazine;
+  void                        *batch[ MALLOC_CACHE_BATCH_SIZE ];
+  uintptr_t                    size;
+  uint32_t                     size_class = 0;
+  uint32_t                     count = 0;
+  ISR_Level                    level;
+
+  if ( rtems_malloc_caches == NULL )
+    return false;
+
+  /*
+   *  The caller owns the block, so its size cannot change and may be
+   *  obtained without the allocator lock.
+   */
+  if ( !_Heap_Size_of_alloc_area( RTEMS_Malloc_Heap, pointer, &size ) )
+    return false;
+
+  /*
+   *  Blocks much larger than the largest size class are not cached.
+   */
+  if (
+    size < RTEMS_MALLOC_CACHE_MINIMUM_SIZE
+      || size >= 2 * malloc_cache_class_size( MALLOC_CACHE_LAST_CLASS )
+  ) {
+    return false;
+  }
+
+  while (
+    size_class < MALLOC_CACHE_LAST_CLASS
+      && size >= malloc_cache_class_size( size_class + 1 )
+  ) {
+    ++size_class;
+  }
+
+  malloc_cache_disable( level );
+  cache = malloc_cache_get();
+  magazine = &cache->magazines[ size_class ];
+
+  if ( magazine->count == RTEMS_MALLOC_CACHE_MAGAZINE_SIZE ) {
+    ++cache->flushes;
+
+    while ( count < MALLOC_CACHE_BATCH_SIZE ) {
+      --magazine->count;
+      batch[ count ] = magazine->objects[ magazine->count ];
+      ++count;
+    }
+  }
+
+  magazine->objects[ magazine->count ] = pointer;
+  ++magazine->count;
+  malloc_cache_enable( level );
+
+  if ( count > 0 )
+    malloc_cache_release_batch( batch, count );
+
+  return true;
+}
+
+#endif
@@ -30,6 +30,24 @@ int malloc_get_statistics(
   _RTEMS_Lock_allocator();
   *stats = rtems_malloc_statistics;
   _RTEMS_Unlock_allocator();
+
+  /*
+   *  The per-CPU cache counters are owned by the processors, so just sum up
+   *  a snapshot of them.
+   */
+  if ( rtems_malloc_caches != NULL ) {
+    uint32_t cpu_count = rtems_configuration_get_maximum_processors();
+    uint32_t cpu;
+
+    for ( cpu = 0 ; cpu < cpu_count ; ++cpu ) {
+      const rtems_malloc_cache *cache = &rtems_malloc_caches[ cpu ];
+
+      stats->cache_hits += cache->hits;
+      stats->cache_misses += cache->misses;
+      stats->cache_flushes += cache->flushes;
+    }
+  }
+
   return 0;
 }
 
@@ -51,7 +51,13 @@ void RTEMS_Malloc_Initialize(
       }
     }
 
-    if ( init_or_extend == _Heap_Initialize ) {
+    if (
+      init_or_extend == _Heap_Initialize
+        || (
+          rtems_configuration_get_segregated_fit_heaps()
+            && !_Heap_Enable_segregated_fit( heap )
+        )
+    ) {
       _Internal_error_Occurred(
         INTERNAL_ERROR_CORE,
         true,
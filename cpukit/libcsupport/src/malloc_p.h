@@ -34,3 +34,9 @@ extern rtems_malloc_statistics_t rtems_malloc_statistics;
 bool malloc_is_system_state_OK(void);
 void malloc_deferred_frees_process(void);
 void malloc_deferred_free(void *);
+
+/*
+ *  Per-CPU malloc caches
+ */
+void *malloc_cache_allocate(size_t);
+bool malloc_cache_free(void *);
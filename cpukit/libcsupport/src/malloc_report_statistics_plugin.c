@@ -22,13 +22,22 @@ void malloc_report_statistics_with_plugin(
   rtems_printk_plugin_t  print
 )
 {
-  rtems_malloc_statistics_t *s = &rtems_malloc_statistics;
-  uint32_t space_available = s->space_available;
-  uint32_t allocated = (uint32_t) (s->lifetime_allocated - s->lifetime_freed);
-  uint32_t max_depth = s->max_depth;
+  rtems_malloc_statistics_t stats;
+  rtems_malloc_statistics_t *s = &stats;
+  uint32_t space_available;
+  uint32_t allocated;
+  uint32_t max_depth;
+  uint32_t allocated_per_cent;
+  uint32_t max_depth_per_cent;
+
+  malloc_get_statistics( s );
+
+  space_available = s->space_available;
+  allocated = (uint32_t) (s->lifetime_allocated - s->lifetime_freed);
+  max_depth = s->max_depth;
     /* avoid float! */
-  uint32_t allocated_per_cent = (allocated * 100) / space_available;
-  uint32_t max_depth_per_cent = (max_depth * 100) / space_available;
+  allocated_per_cent = (allocated * 100) / space_available;
+  max_depth_per_cent = (max_depth * 100) / space_available;
 
   (*print)(
     context,
@@ -54,6 +63,24 @@ void malloc_report_statistics_with_plugin(
     s->realloc_calls,
     s->calloc_calls
   );
+
+  if ( rtems_malloc_caches != NULL ) {
+    uint32_t lookups = s->cache_hits + s->cache_misses;
+    uint32_t hit_rate_per_cent = 0;
+
+    if ( lookups > 0 )
+      hit_rate_per_cent = (uint32_t) ((s->cache_hits * 100ULL) / lookups);
+
+    (*print)(
+      context,
+      "  Per-CPU caches:   hits:%"PRIu32"   misses:%"PRIu32
+         "   flushes:%"PRIu32"   hit rate:%"PRIu32"%%\n",
+      s->cache_hits,
+      s->cache_misses,
+      s->cache_flushes,
+      hit_rate_per_cent
+    );
+  }
 }
 
 #endif
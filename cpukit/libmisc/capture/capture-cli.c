@@ -27,13 +27,17 @@
 #endif
 
 #include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include <inttypes.h>
+#include <unistd.h>
 
 #include <rtems.h>
 #include <rtems/capture-cli.h>
+#include <rtems/capture-export.h>
 #include <rtems/monitor.h>
 
 #define RTEMS_CAPTURE_CLI_MAX_LOAD_TASKS (20)
@@ -48,6 +52,11 @@ static rtems_capture_timestamp capture_timestamp;
  */
 static volatile int cli_load_thread_active;
 
+/*
+ * The file the trace export writes to.
+ */
+static int cli_export_fd = -1;
+
 /*
  * rtems_capture_cli_open
  *
@@ -1362,12 +1371,13 @@ rtems_capture_cli_trace_records (int                          argc,
     {
       if (csv)
         fprintf (stdout, "%08" PRIxPTR ",%03" PRIu32
-                   ",%03" PRIu32 ",%04" PRIx32 ",%" PRId32 ",%" PRId32 "\n",
+                   ",%03" PRIu32 ",%04" PRIx32 ",%" PRId32 ",%" PRId32
+                   ",%" PRIu32 "\n",
                 (uintptr_t) rec->task,
                 (rec->events >> RTEMS_CAPTURE_REAL_PRIORITY_EVENT) & 0xff,
                 (rec->events >> RTEMS_CAPTURE_CURR_PRIORITY_EVENT) & 0xff,
                 (rec->events >> RTEMS_CAPTURE_EVENT_START),
-                rec->ticks, rec->tick_offset);
+                rec->ticks, rec->tick_offset, rec->cpu);
       else
       {
         unsigned long long t;
@@ -1384,8 +1394,9 @@ rtems_capture_cli_trace_records (int                          argc,
         {
           if (event & 1)
           {
-            fprintf (stdout, "%9li.%06li ", (unsigned long) (t / 1000000),
-                    (unsigned long) (t % 1000000));
+            fprintf (stdout, "%9li.%06li %2" PRIu32 " ",
+                    (unsigned long) (t / 1000000),
+                    (unsigned long) (t % 1000000), rec->cpu);
             rtems_monitor_dump_id (rtems_capture_task_id (rec->task));
             fprintf (stdout, " ");
             rtems_monitor_dump_name (rtems_capture_task_name (rec->task));
@@ -1454,6 +1465,131 @@ rtems_capture_cli_flush (int                          argc,
            prime ? "primed" : "not primed");
 }
 
+/*
+ * rtems_capture_cli_export
+ *
+ *  DESCRIPTION:
+ *
+ * This function is a monitor command that starts or stops the export of
+ * the trace records into a file. Without arguments the statistics of the
+ * export are displayed.
+ *
+ */
+
+static char const * export_usage =
+  "usage: cexport [-b records] [-t usecs] [file | stop]\n";
+
+static void
+rtems_capture_cli_export (int                          argc,
+                          char**                       argv,
+                          const rtems_monitor_command_arg_t* command_arg __attribute__((unused)),
+                          bool                         verbose __attribute__((unused)))
+{
+  rtems_capture_export_stats_t stats;
+  rtems_status_code            sc;
+  rtems_task_priority          priority;
+  const char*                  file = NULL;
+  uint32_t                     threshold = 100;
+  uint32_t                     timeout = 1000000;
+  int                          arg;
+
+  for (arg = 1; arg < argc; arg++)
+  {
+    if (argv[arg][0] == '-')
+    {
+      if ((arg + 1) == argc)
+      {
+        fprintf (stdout, export_usage);
+        return;
+      }
+
+      if (argv[arg][1] == 'b')
+        threshold = strtoul (argv[++arg], 0, 0);
+      else if (argv[arg][1] == 't')
+        timeout = strtoul (argv[++arg], 0, 0);
+      else
+        fprintf (stdout, "warning: option -%c ignored\n", argv[arg][1]);
+    }
+    else
+      file = argv[arg];
+  }
+
+  if (file == NULL)
+  {
+    rtems_capture_export_get_stats (&stats);
+
+    fprintf (stdout, "export %s\n",
+             rtems_capture_export_active () ? "active" : "inactive");
+    fprintf (stdout, " records: %" PRIu64 " bytes: %" PRIu64
+             " batches: %" PRIu32 " max batch: %" PRIu32 "\n",
+             stats.records, stats.bytes, stats.batches, stats.max_batch);
+    fprintf (stdout, " dropped: %" PRIu32 " write errors: %" PRIu32
+             " busy: %" PRIu64 "us\n",
+             stats.dropped, stats.write_errors, stats.busy_ns / 1000);
+    return;
+  }
+
+  if (strcmp (file, "stop") == 0)
+  {
+    rtems_capture_export_stop ();
+
+    if (cli_export_fd >= 0)
+    {
+      close (cli_export_fd);
+      cli_export_fd = -1;
+    }
+
+    fprintf (stdout, "export stopped.\n");
+    return;
+  }
+
+  if (threshold == 0)
+  {
+    fprintf (stdout, "error: the record count must not be 0\n");
+    return;
+  }
+
+  if (timeout == 0)
+  {
+    fprintf (stdout, "error: the timeout must not be 0\n");
+    return;
+  }
+
+  if (rtems_capture_export_active ())
+  {
+    fprintf (stdout, "error: export already active\n");
+    return;
+  }
+
+  if (cli_export_fd >= 0)
+    close (cli_export_fd);
+
+  cli_export_fd = open (file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+  if (cli_export_fd < 0)
+  {
+    fprintf (stdout, "error: cannot open %s: %s\n", file, strerror (errno));
+    return;
+  }
+
+  sc = rtems_task_set_priority (RTEMS_SELF, RTEMS_CURRENT_PRIORITY, &priority);
+
+  if (sc == RTEMS_SUCCESSFUL)
+    sc = rtems_capture_export_start (cli_export_fd, priority,
+                                     threshold, timeout);
+
+  if (sc != RTEMS_SUCCESSFUL)
+  {
+    fprintf (stdout, "error: export start failed: %s\n",
+             rtems_status_text (sc));
+    close (cli_export_fd);
+    cli_export_fd = -1;
+    return;
+  }
+
+  fprintf (stdout, "exporting to %s.\n", file);
+}
+
 static rtems_monitor_command_entry_t rtems_capture_cli_cmds[] =
 {
   {
@@ -1591,6 +1727,14 @@ static rtems_monitor_command_entry_t rtems_capture_cli_cmds[] =
     rtems_capture_cli_flush,
     { 0 },
     0
+  },
+  {
+    "cexport",
+    "usage: cexport [-b records] [-t usecs] [file | stop]\n",
+    0,
+    rtems_capture_cli_export,
+    { 0 },
+    0
   }
 };
 
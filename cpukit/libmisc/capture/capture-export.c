@@ -0,0 +1,346 @@
+/**
+ * @file
+ *
+ * @brief Capture Engine Trace Export
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems.h>
+#include <rtems/capture-export.h>
+
+/*
+ * The number of records encoded into the write buffer at once.
+ */
+#define RTEMS_CAPTURE_EXPORT_CHUNK_RECORDS (64)
+
+/*
+ * The export state. It is only changed by the export task after the start.
+ */
+static int                          export_fd = -1;
+static uint32_t                     export_threshold;
+static uint32_t                     export_timeout;
+static volatile bool                export_running;
+static volatile bool                export_stop;
+static rtems_capture_export_stats_t export_stats;
+
+/*
+ * The write buffer of the export task.
+ */
+static uint8_t export_buffer[RTEMS_CAPTURE_EXPORT_CHUNK_RECORDS *
+                             RTEMS_CAPTURE_BINARY_RECORD_SIZE];
+
+/*
+ * rtems_capture_export_put_u32
+ *
+ *  DESCRIPTION:
+ *
+ * This function stores a value in little-endian byte order.
+ */
+static uint8_t*
+rtems_capture_export_put_u32 (uint8_t* out, uint32_t value)
+{
+  size_t b;
+
+  for (b = 0; b < 4; b++)
+    *out++ = (uint8_t) (value >> (8 * b));
+
+  return out;
+}
+
+/*
+ * rtems_capture_export_uptime
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns the uptime in nano-seconds.
+ */
+static uint64_t
+rtems_capture_export_uptime (void)
+{
+  struct timespec uptime;
+
+  rtems_clock_get_uptime (&uptime);
+
+  return (uint64_t) uptime.tv_sec * 1000000000 + (uint64_t) uptime.tv_nsec;
+}
+
+/*
+ * rtems_capture_export_write
+ *
+ *  DESCRIPTION:
+ *
+ * This function writes the buffer completely to the file descriptor.
+ * Pipes and sockets may accept less than requested.
+ */
+static bool
+rtems_capture_export_write (const void* buffer, size_t size)
+{
+  const uint8_t* out = buffer;
+
+  while (size > 0)
+  {
+    ssize_t n = write (export_fd, out, size);
+
+    if (n < 0)
+    {
+      if (errno == EINTR)
+        continue;
+
+      export_stats.write_errors++;
+      return false;
+    }
+
+    out  += n;
+    size -= n;
+    export_stats.bytes += n;
+  }
+
+  return true;
+}
+
+/*
+ * rtems_capture_export_header
+ *
+ *  DESCRIPTION:
+ *
+ * This function writes the stream header.
+ */
+static bool
+rtems_capture_export_header (void)
+{
+  uint8_t  header[RTEMS_CAPTURE_EXPORT_HEADER_SIZE];
+  uint8_t* out = header;
+
+  out = rtems_capture_export_put_u32 (out, RTEMS_CAPTURE_EXPORT_MAGIC);
+  out = rtems_capture_export_put_u32 (out, RTEMS_CAPTURE_EXPORT_VERSION);
+  out = rtems_capture_export_put_u32 (out, RTEMS_CAPTURE_EXPORT_HEADER_SIZE);
+  out = rtems_capture_export_put_u32 (out, RTEMS_CAPTURE_EXPORT_BATCH_SIZE);
+  out = rtems_capture_export_put_u32 (out, RTEMS_CAPTURE_BINARY_RECORD_SIZE);
+  out = rtems_capture_export_put_u32 (out, rtems_capture_tick_time ());
+  out = rtems_capture_export_put_u32 (out, rtems_smp_get_processor_count ());
+  rtems_capture_export_put_u32 (out, 0);
+
+  return rtems_capture_export_write (header, sizeof (header));
+}
+
+/*
+ * rtems_capture_export_batch
+ *
+ *  DESCRIPTION:
+ *
+ * This function writes a batch of records. The records are encoded in
+ * chunks into the write buffer.
+ */
+static bool
+rtems_capture_export_batch (rtems_capture_record_t* recs, uint32_t count)
+{
+  uint8_t  header[RTEMS_CAPTURE_EXPORT_BATCH_SIZE];
+  uint8_t* out = header;
+
+  export_stats.dropped = rtems_capture_dropped ();
+
+  out = rtems_capture_export_put_u32 (out, RTEMS_CAPTURE_EXPORT_BATCH_MAGIC);
+  out = rtems_capture_export_put_u32 (out, count);
+  rtems_capture_export_put_u32 (out, export_stats.dropped);
+
+  if (!rtems_capture_export_write (header, sizeof (header)))
+    return false;
+
+  while (count > 0)
+  {
+    uint32_t chunk = count;
+    uint32_t r;
+
+    if (chunk > RTEMS_CAPTURE_EXPORT_CHUNK_RECORDS)
+      chunk = RTEMS_CAPTURE_EXPORT_CHUNK_RECORDS;
+
+    out = export_buffer;
+
+    for (r = 0; r < chunk; r++)
+      out += rtems_capture_record_to_binary (recs++, out);
+
+    if (!rtems_capture_export_write (export_buffer, out - export_buffer))
+      return false;
+
+    export_stats.records += chunk;
+    count -= chunk;
+  }
+
+  return true;
+}
+
+/*
+ * rtems_capture_export_task
+ *
+ *  DESCRIPTION:
+ *
+ * This is the export task. It drains the capture records until it is
+ * stopped or a write fails.
+ */
+static rtems_task
+rtems_capture_export_task (rtems_task_argument arg __attribute__((unused)))
+{
+  bool ok = rtems_capture_export_header ();
+
+  while (ok && !export_stop)
+  {
+    rtems_capture_record_t* recs;
+    uint32_t                read;
+    uint64_t                begin;
+    rtems_status_code       sc;
+
+    sc = rtems_capture_read (export_threshold, export_timeout, &read, &recs);
+
+    if (sc != RTEMS_SUCCESSFUL)
+      break;
+
+    if (read == 0)
+    {
+      rtems_capture_release (0);
+      continue;
+    }
+
+    begin = rtems_capture_export_uptime ();
+
+    ok = rtems_capture_export_batch (recs, read);
+
+    rtems_capture_release (read);
+
+    export_stats.batches++;
+
+    if (read > export_stats.max_batch)
+      export_stats.max_batch = read;
+
+    export_stats.busy_ns += rtems_capture_export_uptime () - begin;
+  }
+
+  export_running = false;
+
+  rtems_task_delete (RTEMS_SELF);
+}
+
+/*
+ * rtems_capture_export_start
+ *
+ *  DESCRIPTION:
+ *
+ * This function starts the export task.
+ */
+rtems_status_code
+rtems_capture_export_start (int                 fd,
+                            rtems_task_priority priority,
+                            uint32_t            threshold,
+                            uint32_t            timeout)
+{
+  rtems_status_code sc;
+  rtems_name        name;
+  rtems_id          id;
+
+  if (fd < 0)
+    return RTEMS_INVALID_NUMBER;
+
+  /*
+   * A threshold of 0 is satisfied without any record, so the task would
+   * spin without blocking.
+   */
+  if ((threshold == 0) || (timeout == 0))
+    return RTEMS_INVALID_NUMBER;
+
+  if (export_running)
+    return RTEMS_RESOURCE_IN_USE;
+
+  memset (&export_stats, 0, sizeof (export_stats));
+
+  export_fd        = fd;
+  export_threshold = threshold;
+  export_timeout   = timeout;
+  export_stop      = false;
+
+  name = rtems_build_name ('C', 'P', 'e', 'x');
+
+  sc = rtems_task_create (name, priority, 4 * 1024,
+                          RTEMS_NO_FLOATING_POINT | RTEMS_LOCAL,
+                          RTEMS_PREEMPT | RTEMS_NO_TIMESLICE | RTEMS_NO_ASR,
+                          &id);
+
+  if (sc != RTEMS_SUCCESSFUL)
+    return sc;
+
+  export_running = true;
+
+  sc = rtems_task_start (id, rtems_capture_export_task, 0);
+
+  if (sc != RTEMS_SUCCESSFUL)
+  {
+    export_running = false;
+    rtems_task_delete (id);
+  }
+
+  return sc;
+}
+
+/*
+ * rtems_capture_export_stop
+ *
+ *  DESCRIPTION:
+ *
+ * This function stops the export task and waits for it to terminate.
+ * The task notices the stop request at the latest after the read
+ * timeout.
+ */
+rtems_status_code
+rtems_capture_export_stop (void)
+{
+  if (!export_running)
+    return RTEMS_SUCCESSFUL;
+
+  export_stop = true;
+
+  while (export_running)
+    rtems_task_wake_after (RTEMS_MICROSECONDS_TO_TICKS (export_timeout) + 1);
+
+  return RTEMS_SUCCESSFUL;
+}
+
+/*
+ * rtems_capture_export_active
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns true if the export task is running.
+ */
+bool
+rtems_capture_export_active (void)
+{
+  return export_running;
+}
+
+/*
+ * rtems_capture_export_get_stats
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns the statistics of the export.
+ */
+void
+rtems_capture_export_get_stats (rtems_capture_export_stats_t* stats)
+{
+  *stats = export_stats;
+  stats->dropped = rtems_capture_dropped ();
+}
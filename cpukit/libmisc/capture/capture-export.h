@@ -0,0 +1,144 @@
+/**
+ * @file rtems/capture-export.h
+ *
+ * @brief Capture Engine Trace Export
+ *
+ * This is the trace export of the capture engine. A task drains the
+ * capture records into a file descriptor in a binary stream format.
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifndef __CAPTURE_EXPORT_H_
+#define __CAPTURE_EXPORT_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <rtems/capture.h>
+
+/**
+ * The trace export stream format.
+ *
+ * All values are 32-bit unsigned integers in little-endian byte order
+ * without padding. A stream starts with a stream header followed by
+ * any number of batches.
+ *
+ * The stream header:
+ *
+ *   offset  0: magic, the bytes 'R', 'T', 'C', 'T'
+ *   offset  4: version of the stream format
+ *   offset  8: size of the stream header in bytes
+ *   offset 12: size of the batch header in bytes
+ *   offset 16: size of a record in bytes
+ *   offset 20: tick period in micro-seconds
+ *   offset 24: processor count
+ *   offset 28: reserved, zero
+ *
+ * A batch is a batch header followed by the records of the batch in
+ * the binary record format of the capture engine, see
+ * RTEMS_CAPTURE_BINARY_RECORD_SIZE. The batch header:
+ *
+ *   offset  0: magic, the bytes 'B', 'T', 'C', 'H'
+ *   offset  4: number of records in the batch
+ *   offset  8: number of records dropped since the capture engine was
+ *              opened or flushed
+ *
+ * A reader must use the header and record sizes of the stream header to
+ * skip fields added by later versions of the format.
+ */
+#define RTEMS_CAPTURE_EXPORT_MAGIC        UINT32_C (0x54435452)
+#define RTEMS_CAPTURE_EXPORT_BATCH_MAGIC  UINT32_C (0x48435442)
+#define RTEMS_CAPTURE_EXPORT_VERSION      (1)
+#define RTEMS_CAPTURE_EXPORT_HEADER_SIZE  (32)
+#define RTEMS_CAPTURE_EXPORT_BATCH_SIZE   (12)
+
+/**
+ * rtems_capture_export_stats_t
+ *
+ *  DESCRIPTION:
+ *
+ * The statistics of the trace export. The busy time is the time the
+ * export task spent encoding and writing records. A maximum batch equal
+ * to the capture buffer size or dropped records indicate the capture
+ * buffer is too small for the load.
+ */
+typedef struct rtems_capture_export_stats_s
+{
+  uint64_t records;
+  uint64_t bytes;
+  uint64_t busy_ns;
+  uint32_t batches;
+  uint32_t max_batch;
+  uint32_t dropped;
+  uint32_t write_errors;
+} rtems_capture_export_stats_t;
+
+/**
+ * rtems_capture_export_start
+ *
+ *  DESCRIPTION:
+ *
+ * This function starts a task which writes the stream header and then
+ * continuously reads the capture records and writes them in batches to
+ * the file descriptor. The file descriptor may refer to a file, a pipe
+ * or a socket and is not closed by the export.
+ *
+ * The 'threshold' parameter is the number of records the task waits for
+ * before it writes a batch. The 'timeout' parameter is in micro-seconds
+ * and limits the wait. Both must not be 0.
+ *
+ * The capture engine must be open. The export is the reader of the
+ * capture engine so the records cannot be read otherwise while it runs.
+ */
+rtems_status_code
+rtems_capture_export_start (int                 fd,
+                            rtems_task_priority priority,
+                            uint32_t            threshold,
+                            uint32_t            timeout);
+
+/**
+ * rtems_capture_export_stop
+ *
+ *  DESCRIPTION:
+ *
+ * This function stops the export task. The records read so far are
+ * written before the task terminates.
+ */
+rtems_status_code
+rtems_capture_export_stop (void);
+
+/**
+ * rtems_capture_export_active
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns true if the export task is running. The task
+ * terminates on its own on a write error.
+ */
+bool
+rtems_capture_export_active (void);
+
+/**
+ * rtems_capture_export_get_stats
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns the statistics of the current or last export.
+ */
+void
+rtems_capture_export_get_stats (rtems_capture_export_stats_t* stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
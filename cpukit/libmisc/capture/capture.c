@@ -29,6 +29,8 @@
 #include <string.h>
 
 #include "capture.h"
+#include <rtems/score/atomic.h>
+#include <rtems/score/isrlevel.h>
 #include <rtems/score/statesimpl.h>
 
 /*
@@ -58,21 +60,60 @@
  */
 #define RTEMS_CAPTURE_ON             (1U << 0)
 #define RTEMS_CAPTURE_NO_MEMORY      (1U << 1)
-#define RTEMS_CAPTURE_OVERFLOW       (1U << 2)
 #define RTEMS_CAPTURE_TRIGGERED      (1U << 3)
 #define RTEMS_CAPTURE_READER_ACTIVE  (1U << 4)
 #define RTEMS_CAPTURE_READER_WAITING (1U << 5)
 #define RTEMS_CAPTURE_GLOBAL_WATCH   (1U << 6)
 #define RTEMS_CAPTURE_ONLY_MONITOR   (1U << 7)
 
+/*
+ * The per processor capture buffer. It is a single writer, single reader
+ * ring. Only the owner processor writes records and advances the in
+ * index. Only the reader advances the out index. The in and out indices
+ * are free running counters, the slots are the positions in the records.
+ */
+typedef struct rtems_capture_per_cpu_s
+{
+  rtems_capture_record_t* records;
+  Atomic_Ulong            in;
+  Atomic_Ulong            out;
+  uint32_t                in_slot;
+  uint32_t                out_slot;
+  Atomic_Ulong            dropped;
+} rtems_capture_per_cpu_t;
+
+/*
+ * A record is written with the interrupts of the owner processor disabled
+ * to protect the ring against interrupt service routines. Other processors
+ * are not involved.
+ */
+#if defined(RTEMS_SMP)
+  #define rtems_capture_disable(_level) _ISR_Disable_without_giant (_level)
+  #define rtems_capture_enable(_level) _ISR_Enable_without_giant (_level)
+#else
+  #define rtems_capture_disable(_level) _ISR_Disable (_level)
+  #define rtems_capture_enable(_level) _ISR_Enable (_level)
+#endif
+
+/*
+ * The capture task reference counts, the capture task flags and the
+ * capture task list are changed by all processors. The thread switch
+ * extension does not own the Giant lock, so disabling interrupts does not
+ * protect them. This lock does.
+ */
+static rtems_interrupt_lock capture_lock = RTEMS_INTERRUPT_LOCK_INITIALIZER;
+
 /*
  * RTEMS Capture Data.
+ *
+ * The capture records are the merge buffer of the reader. It contains the
+ * records merged from the per processor buffers in time order.
  */
 static rtems_capture_record_t*  capture_records;
 static uint32_t                 capture_size;
 static uint32_t                 capture_count;
-static rtems_capture_record_t*  capture_in;
-static uint32_t                 capture_out;
+static rtems_capture_per_cpu_t* capture_per_cpu;
+static uint32_t                 capture_cpu_count;
 static uint32_t                 capture_flags;
 static rtems_capture_task_t*    capture_tasks;
 static rtems_capture_control_t* capture_controls;
@@ -260,7 +301,11 @@ rtems_capture_by_in_to (uint32_t                 events,
 static inline void
 rtems_capture_refcount_up (rtems_capture_task_t* task)
 {
+  rtems_interrupt_level level;
+
+  rtems_interrupt_lock_acquire (&capture_lock, level);
   task->refcount++;
+  rtems_interrupt_lock_release (&capture_lock, level);
 }
 
 /*
@@ -275,8 +320,12 @@ rtems_capture_refcount_up (rtems_capture_task_t* task)
 static inline void
 rtems_capture_refcount_down (rtems_capture_task_t* task)
 {
+  rtems_interrupt_level level;
+
+  rtems_interrupt_lock_acquire (&capture_lock, level);
   if (task->refcount)
     task->refcount--;
+  rtems_interrupt_lock_release (&capture_lock, level);
 }
 
 /*
@@ -434,7 +483,7 @@ rtems_capture_create_capture_task (rtems_tcb* new_task)
   task->stack_size     = new_task->Start.Initial_stack.size;
   task->stack_clean    = task->stack_size;
 
-  rtems_interrupt_disable (level);
+  rtems_interrupt_lock_acquire (&capture_lock, level);
 
   task->forw    = capture_tasks;
   if (task->forw)
@@ -442,7 +491,7 @@ rtems_capture_create_capture_task (rtems_tcb* new_task)
   task->back    = NULL;
   capture_tasks = task;
 
-  rtems_interrupt_enable (level);
+  rtems_interrupt_lock_release (&capture_lock, level);
 
   /*
    * We need to scan the default control list to initialise
@@ -474,7 +523,7 @@ rtems_capture_destroy_capture_task (rtems_capture_task_t* task)
   {
     rtems_interrupt_level level;
 
-    rtems_interrupt_disable (level);
+    rtems_interrupt_lock_acquire (&capture_lock, level);
 
     if (task->tcb || task->refcount)
       task = 0;
@@ -489,7 +538,7 @@ rtems_capture_destroy_capture_task (rtems_capture_task_t* task)
         capture_tasks = task->forw;
     }
 
-    rtems_interrupt_enable (level);
+    rtems_interrupt_lock_release (&capture_lock, level);
 
     rtems_workspace_free (task);
   }
@@ -532,33 +581,55 @@ rtems_capture_record (rtems_capture_task_t* task,
          ((capture_flags & RTEMS_CAPTURE_GLOBAL_WATCH) ||
           (control && (control->flags & RTEMS_CAPTURE_WATCH)))))
     {
-      rtems_interrupt_level level;
+      rtems_capture_per_cpu_t* per_cpu;
+      ISR_Level                level;
+      unsigned long            in;
+      uint32_t                 cpu;
 
-      rtems_interrupt_disable (level);
+      rtems_capture_disable (level);
 
-      if (capture_count < capture_size)
+      cpu = rtems_smp_get_current_processor ();
+      per_cpu = &capture_per_cpu[cpu];
+      in = _Atomic_Load_ulong (&per_cpu->in, ATOMIC_ORDER_RELAXED);
+
+      if ((in - _Atomic_Load_ulong (&per_cpu->out, ATOMIC_ORDER_ACQUIRE)) <
+          capture_size)
       {
-        capture_count++;
-        capture_in->task   = task;
-        capture_in->events = (events |
-                              (task->tcb->real_priority) |
-                              (task->tcb->current_priority << 8));
+        rtems_capture_record_t* rec = &per_cpu->records[per_cpu->in_slot];
+
+        rec->task   = task;
+        rec->events = (events |
+                       (task->tcb->real_priority) |
+                       (task->tcb->current_priority << 8));
+        rec->cpu    = cpu;
 
         if ((events & RTEMS_CAPTURE_RECORD_EVENTS) == 0)
+        {
+          rtems_interrupt_level lock_level;
+
+          rtems_interrupt_lock_acquire (&capture_lock, lock_level);
           task->flags |= RTEMS_CAPTURE_TRACED;
+          rtems_interrupt_lock_release (&capture_lock, lock_level);
+        }
+
+        rtems_capture_get_time (&rec->ticks, &rec->tick_offset);
 
-        rtems_capture_get_time (&capture_in->ticks, &capture_in->tick_offset);
+        rtems_capture_refcount_up (task);
 
-        if (capture_in == &capture_records[capture_size - 1])
-          capture_in = capture_records;
+        if (per_cpu->in_slot == capture_size - 1)
+          per_cpu->in_slot = 0;
         else
-          capture_in++;
+          per_cpu->in_slot++;
 
-        rtems_capture_refcount_up (task);
+        /*
+         * Publish the record to the reader.
+         */
+        _Atomic_Store_ulong (&per_cpu->in, in + 1, ATOMIC_ORDER_RELEASE);
       }
       else
-        capture_flags |= RTEMS_CAPTURE_OVERFLOW;
-      rtems_interrupt_enable (level);
+        _Atomic_Fetch_add_ulong (&per_cpu->dropped, 1, ATOMIC_ORDER_RELAXED);
+
+      rtems_capture_enable (level);
     }
   }
 }
@@ -805,7 +876,14 @@ rtems_capture_delete_task (rtems_tcb* current_task,
    * This task's tcb will be invalid. This signals the
    * task has been deleted.
    */
-  dt->tcb = 0;
+  if (dt)
+  {
+    rtems_interrupt_level level;
+
+    rtems_interrupt_lock_acquire (&capture_lock, level);
+    dt->tcb = 0;
+    rtems_interrupt_lock_release (&capture_lock, level);
+  }
 
   rtems_capture_destroy_capture_task (dt);
 }
@@ -987,11 +1065,12 @@ rtems_capture_switch_task (rtems_tcb* current_task,
  *
  */
 rtems_status_code
-rtems_capture_open (uint32_t   size, rtems_capture_timestamp timestamp __attribute__((unused)))
+rtems_capture_open (uint32_t   size, rtems_capture_timestamp timestamp)
 {
   rtems_extensions_table capture_extensions;
   rtems_name             name;
   rtems_status_code      sc;
+  uint32_t               cpu;
 
   /*
    * See if the capture engine is already open.
@@ -1000,19 +1079,48 @@ rtems_capture_open (uint32_t   size, rtems_capture_timestamp timestamp __attribu
   if (capture_records)
     return RTEMS_RESOURCE_IN_USE;
 
-  capture_records = malloc (size * sizeof (rtems_capture_record_t));
+  if (size == 0)
+    return RTEMS_INVALID_SIZE;
+
+  capture_cpu_count = rtems_smp_get_processor_count ();
+
+  capture_per_cpu = calloc (capture_cpu_count,
+                            sizeof (rtems_capture_per_cpu_t));
+
+  if (capture_per_cpu == NULL)
+    return RTEMS_NO_MEMORY;
+
+  /*
+   * The merge buffer of the reader is followed by the buffer of each
+   * processor. Each buffer holds the requested number of records.
+   */
+  capture_records = malloc ((capture_cpu_count + 1) * size *
+                            sizeof (rtems_capture_record_t));
 
   if (capture_records == NULL)
+  {
+    free (capture_per_cpu);
+    capture_per_cpu = NULL;
     return RTEMS_NO_MEMORY;
+  }
 
-  capture_size    = size;
-  capture_count   = 0;
-  capture_in      = capture_records;
-  capture_out     = 0;
-  capture_flags   = 0;
-  capture_tasks   = NULL;
-  capture_ceiling = 0;
-  capture_floor   = 255;
+  for (cpu = 0; cpu < capture_cpu_count; cpu++)
+  {
+    rtems_capture_per_cpu_t* per_cpu = &capture_per_cpu[cpu];
+
+    per_cpu->records = &capture_records[(cpu + 1) * size];
+    _Atomic_Init_ulong (&per_cpu->in, 0);
+    _Atomic_Init_ulong (&per_cpu->out, 0);
+    _Atomic_Init_ulong (&per_cpu->dropped, 0);
+  }
+
+  capture_size      = size;
+  capture_count     = 0;
+  capture_flags     = 0;
+  capture_tasks     = NULL;
+  capture_ceiling   = 0;
+  capture_floor     = 255;
+  capture_timestamp = timestamp;
 
   /*
    * Create the extension table. This is copied so we
@@ -1043,6 +1151,8 @@ rtems_capture_open (uint32_t   size, rtems_capture_timestamp timestamp __attribu
     capture_id = 0;
     free (capture_records);
     capture_records = NULL;
+    free (capture_per_cpu);
+    capture_per_cpu = NULL;
   }
   else
   {
@@ -1120,11 +1230,9 @@ rtems_capture_close (void)
 
   capture_controls = NULL;
 
-  if (capture_records)
-  {
-    free (capture_records);
-    capture_records = NULL;
-  }
+  free (records);
+  free (capture_per_cpu);
+  capture_per_cpu = NULL;
 
   return RTEMS_SUCCESSFUL;
 }
@@ -1204,8 +1312,9 @@ rtems_capture_flush (bool prime)
 {
   rtems_interrupt_level level;
   rtems_capture_task_t* task;
+  uint32_t              cpu;
 
-  rtems_interrupt_disable (level);
+  rtems_interrupt_lock_acquire (&capture_lock, level);
 
   for (task = capture_tasks; task != NULL; task = task->forw)
   {
@@ -1213,14 +1322,38 @@ rtems_capture_flush (bool prime)
     task->refcount = 0;
   }
 
+  rtems_interrupt_lock_release (&capture_lock, level);
+
+  rtems_interrupt_disable (level);
+
   if (prime)
-    capture_flags &= ~(RTEMS_CAPTURE_TRIGGERED | RTEMS_CAPTURE_OVERFLOW);
-  else
-    capture_flags &= ~RTEMS_CAPTURE_OVERFLOW;
+    capture_flags &= ~RTEMS_CAPTURE_TRIGGERED;
+
+  /*
+   * Discard the records of each processor by moving the out index of the
+   * reader up to the in index of the writer.
+   */
+  for (cpu = 0; capture_records && cpu < capture_cpu_count; cpu++)
+  {
+    rtems_capture_per_cpu_t* per_cpu = &capture_per_cpu[cpu];
+    unsigned long            in;
+    unsigned long            out;
+
+    in  = _Atomic_Load_ulong (&per_cpu->in, ATOMIC_ORDER_ACQUIRE);
+    out = _Atomic_Load_ulong (&per_cpu->out, ATOMIC_ORDER_RELAXED);
+
+    per_cpu->out_slot = (per_cpu->out_slot + (in - out)) % capture_size;
+
+    /*
+     * The writer of this processor may drop a record at the same time, so
+     * the count must be exchanged and not stored.
+     */
+    _Atomic_Exchange_ulong (&per_cpu->dropped, 0, ATOMIC_ORDER_RELAXED);
+
+    _Atomic_Store_ulong (&per_cpu->out, in, ATOMIC_ORDER_RELEASE);
+  }
 
   capture_count = 0;
-  capture_in    = capture_records;
-  capture_out   = 0;
 
   rtems_interrupt_enable (level);
 
@@ -1669,6 +1802,125 @@ rtems_capture_clear_trigger (rtems_name                   from_name,
   return RTEMS_SUCCESSFUL;
 }
 
+/*
+ * rtems_capture_merge
+ *
+ *  DESCRIPTION:
+ *
+ * This function moves the records of the processor buffers into the
+ * merge buffer of the reader. The oldest record at the head of the
+ * processor buffers is taken next. Records with an equal time stamp
+ * are taken in processor order. Each processor buffer is already in
+ * time order so this results in a time ordered merge buffer. The
+ * function returns the number of records in the merge buffer.
+ */
+static uint32_t
+rtems_capture_merge (void)
+{
+  while (capture_count < capture_size)
+  {
+    rtems_capture_per_cpu_t* next = NULL;
+    rtems_capture_record_t*  next_rec = NULL;
+    unsigned long            next_out = 0;
+    uint32_t                 cpu;
+
+    for (cpu = 0; cpu < capture_cpu_count; cpu++)
+    {
+      rtems_capture_per_cpu_t* per_cpu = &capture_per_cpu[cpu];
+      rtems_capture_record_t*  rec;
+      unsigned long            out;
+
+      out = _Atomic_Load_ulong (&per_cpu->out, ATOMIC_ORDER_RELAXED);
+
+      if (_Atomic_Load_ulong (&per_cpu->in, ATOMIC_ORDER_ACQUIRE) == out)
+        continue;
+
+      rec = &per_cpu->records[per_cpu->out_slot];
+
+      if ((next_rec == NULL) ||
+          (rec->ticks < next_rec->ticks) ||
+          ((rec->ticks == next_rec->ticks) &&
+           (rec->tick_offset < next_rec->tick_offset)))
+      {
+        next     = per_cpu;
+        next_rec = rec;
+        next_out = out;
+      }
+    }
+
+    if (next == NULL)
+      break;
+
+    capture_records[capture_count] = *next_rec;
+    capture_count++;
+
+    if (next->out_slot == capture_size - 1)
+      next->out_slot = 0;
+    else
+      next->out_slot++;
+
+    /*
+     * Hand the slot back to the writer.
+     */
+    _Atomic_Store_ulong (&next->out, next_out + 1, ATOMIC_ORDER_RELEASE);
+  }
+
+  return capture_count;
+}
+
+/*
+ * rtems_capture_dropped
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns the number of records dropped since the
+ * capture engine was opened or flushed because the buffer of a
+ * processor was full.
+ */
+uint32_t
+rtems_capture_dropped (void)
+{
+  uint32_t dropped = 0;
+  uint32_t cpu;
+
+  for (cpu = 0; capture_records && cpu < capture_cpu_count; cpu++)
+    dropped += _Atomic_Load_ulong (&capture_per_cpu[cpu].dropped,
+                                   ATOMIC_ORDER_RELAXED);
+
+  return dropped;
+}
+
+/*
+ * rtems_capture_record_to_binary
+ *
+ *  DESCRIPTION:
+ *
+ * This function encodes a capture record in the binary record
+ * format. See capture.h for the layout.
+ */
+size_t
+rtems_capture_record_to_binary (const rtems_capture_record_t* rec,
+                                void*                         buffer)
+{
+  uint8_t* out = buffer;
+  uint32_t values[RTEMS_CAPTURE_BINARY_RECORD_SIZE / 4];
+  size_t   v;
+  size_t   b;
+
+  values[0] = rec->task->id;
+  values[1] = rec->task->name;
+  values[2] = rec->events;
+  values[3] = rec->ticks;
+  values[4] = rec->tick_offset;
+  values[5] = rec->cpu;
+
+  for (v = 0; v < RTEMS_ARRAY_SIZE (values); v++)
+    for (b = 0; b < 4; b++)
+      *out++ = (uint8_t) (values[v] >> (8 * b));
+
+  return RTEMS_CAPTURE_BINARY_RECORD_SIZE;
+}
+
 /*
  * rtems_capture_read
  *
@@ -1679,12 +1931,10 @@ rtems_capture_clear_trigger (rtems_name                   from_name,
  * specific number of records available or a specific time has
  * elasped.
  *
- * The function returns the number of record that is has that are
- * in a continous block of memory. If the number of available records
- * wrap then only those records are provided. This removes the need for
- * caller to be concerned about buffer wrappings. If the number of
- * requested records cannot be met due to the wrapping of the records
- * less than the specified number will be returned.
+ * The records of the processors are merged in time order into a
+ * continous block of memory. The function returns the number of
+ * records in this block. At most the number of records specified
+ * at open time are returned.
  *
  * The user must release the records. This is achieved with a call to
  * rtems_capture_release. Calls this function without a release will
@@ -1708,13 +1958,18 @@ rtems_capture_read (uint32_t                 threshold,
 {
   rtems_interrupt_level level;
   rtems_status_code     sc = RTEMS_SUCCESSFUL;
-  uint32_t              count;
 
   *read = 0;
   *recs = NULL;
 
   rtems_interrupt_disable (level);
 
+  if (!capture_records)
+  {
+    rtems_interrupt_enable (level);
+    return RTEMS_UNSATISFIED;
+  }
+
   /*
    * Only one reader is allowed.
    */
@@ -1726,25 +1981,19 @@ rtems_capture_read (uint32_t                 threshold,
   }
 
   capture_flags |= RTEMS_CAPTURE_READER_ACTIVE;
-  *read = count = capture_count;
 
   rtems_interrupt_enable (level);
 
-  *recs = &capture_records[capture_out];
+  *recs = &capture_records[0];
 
   for (;;)
   {
-    /*
-     * See if the count wraps the end of the record buffer.
-     */
-    if (count && ((capture_out + count) >= capture_size))
-      *read = capture_size - capture_out;
+    *read = rtems_capture_merge ();
 
     /*
-     * Do we have a threshold and the current count has not wrapped
-     * around the end of the capture record buffer ?
+     * Do we have a threshold and the merge buffer is not full ?
      */
-    if ((*read == count) && threshold)
+    if ((*read < capture_size) && threshold)
     {
       /*
        * Do we have enough records ?
@@ -1774,11 +2023,14 @@ rtems_capture_read (uint32_t                 threshold,
         if ((sc != RTEMS_SUCCESSFUL) && (sc != RTEMS_TIMEOUT))
           break;
 
-        rtems_interrupt_disable (level);
-
-        *read = count = capture_count;
-
-        rtems_interrupt_enable (level);
+        /*
+         * Return what we have after a timeout.
+         */
+        if (sc == RTEMS_TIMEOUT)
+        {
+          sc = RTEMS_SUCCESSFUL;
+          threshold = 0;
+        }
 
         continue;
       }
@@ -1809,16 +2061,12 @@ rtems_capture_release (uint32_t count)
 
   rtems_interrupt_level level;
 
-  rtems_interrupt_disable (level);
-
   if (count > capture_count)
     count = capture_count;
 
-  rtems_interrupt_enable (level);
-
   counted = count;
 
-  rec = &capture_records[capture_out];
+  rec = &capture_records[0];
 
   while (counted--)
   {
@@ -1827,11 +2075,16 @@ rtems_capture_release (uint32_t count)
     rec++;
   }
 
-  rtems_interrupt_disable (level);
-
+  /*
+   * Keep the records not released at the front of the merge buffer.
+   */
   capture_count -= count;
 
-  capture_out = (capture_out + count) % capture_size;
+  if (capture_count)
+    memmove (&capture_records[0], &capture_records[count],
+             capture_count * sizeof (rtems_capture_record_t));
+
+  rtems_interrupt_disable (level);
 
   capture_flags &= ~RTEMS_CAPTURE_READER_ACTIVE;
 
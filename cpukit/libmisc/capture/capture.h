@@ -178,8 +178,8 @@ typedef struct rtems_capture_task_s
  *  DESCRIPTION:
  *
  * RTEMS capture record. This is a record that is written into
- * the buffer. The events includes the priority of the task
- * at the time of the context switch.
+ * the buffer of the processor the event occurred on. The events
+ * includes the priority of the task at the time of the context switch.
  */
 typedef struct rtems_capture_record_s
 {
@@ -187,8 +187,26 @@ typedef struct rtems_capture_record_s
   uint32_t              events;
   uint32_t              ticks;
   uint32_t              tick_offset;
+  uint32_t              cpu;
 } rtems_capture_record_t;
 
+/**
+ * The size in bytes of a capture record in the binary record format.
+ *
+ * A binary record is a sequence of six 32-bit unsigned integers in
+ * little-endian byte order without padding:
+ *
+ *   offset  0: task id
+ *   offset  4: task name
+ *   offset  8: events and priorities, see the event flags below
+ *   offset 12: ticks
+ *   offset 16: tick offset of the time stamp handler
+ *   offset 20: processor index
+ *
+ * Records are written in time order.
+ */
+#define RTEMS_CAPTURE_BINARY_RECORD_SIZE (24)
+
 /**
  * The capture record event flags.
  */
@@ -266,6 +284,10 @@ typedef void (*rtems_capture_timestamp)
  * capture buffer. It is assumed we have a working heap at stage of
  * initialisation.
  *
+ * The size is the number of records in the buffer of each processor.
+ * Each processor writes the records of its events into its own buffer
+ * without a lock. The reader merges the buffers in time order.
+ *
  */
 rtems_status_code
 rtems_capture_open (uint32_t                size,
@@ -471,12 +493,10 @@ rtems_capture_clear_trigger (rtems_name                   from_name,
  * specific number of records available or a specific time has
  * elasped.
  *
- * The function returns the number of record that is has that are
- * in a continous block of memory. If the number of available records
- * wrap then only those records are provided. This removes the need for
- * caller to be concerned about buffer wrappings. If the number of
- * requested records cannot be met due to the wrapping of the records
- * less than the specified number will be returned.
+ * The records of the processors are merged in time order into a
+ * continous block of memory. The function returns the number of
+ * records in this block. At most the number of records specified
+ * at open time are returned.
  *
  * The user must release the records. This is achieved with a call to
  * rtems_capture_release. Calls this function without a release will
@@ -509,6 +529,32 @@ rtems_capture_read (uint32_t                 threshold,
 rtems_status_code
 rtems_capture_release (uint32_t count);
 
+/**
+ * rtems_capture_dropped
+ *
+ *  DESCRIPTION:
+ *
+ * This function returns the number of records dropped since the
+ * capture engine was opened or flushed because the buffer of a
+ * processor was full.
+ */
+uint32_t
+rtems_capture_dropped (void);
+
+/**
+ * rtems_capture_record_to_binary
+ *
+ *  DESCRIPTION:
+ *
+ * This function encodes a capture record in the binary record format
+ * into the buffer. The buffer must provide at least
+ * RTEMS_CAPTURE_BINARY_RECORD_SIZE bytes. The function returns the
+ * number of bytes written.
+ */
+size_t
+rtems_capture_record_to_binary (const rtems_capture_record_t* rec,
+                                void*                         buffer);
+
 /**
  * rtems_capture_tick_time
  *
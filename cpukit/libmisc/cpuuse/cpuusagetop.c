@@ -0,0 +1,666 @@
+/**
+ * @file
+ *
+ * @brief CPU Usage Top
+ * @ingroup libmisc_cpuuse CPU Usage
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include <rtems/cpuuse.h>
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/todimpl.h>
+#include <rtems/score/watchdogimpl.h>
+
+#include "cpuuseimpl.h"
+
+/*
+ *  One sample more than the maximum window is necessary to cover the
+ *  maximum window.
+ */
+#define CPU_USAGE_TOP_SAMPLE_COUNT ( RTEMS_CPU_USAGE_WINDOW_MAXIMUM + 1 )
+
+#define CPU_USAGE_TOP_WINDOW_COUNT 3
+
+#define CPU_USAGE_TOP_LOAD_MAXIMUM 100000
+
+typedef struct {
+  rtems_id id;
+  uint64_t used;
+} CPU_usage_Top_thread;
+
+/*
+ *  A sample contains the uptime, the time used by each processor idle thread
+ *  and the time used by each thread.  The threads are in object identifier
+ *  order.  The time unit is nanoseconds or ticks, depending on the CPU usage
+ *  statistics.
+ */
+typedef struct {
+  uint64_t              uptime;
+  uint64_t             *idle;
+  CPU_usage_Top_thread *threads;
+  uint32_t              thread_count;
+} CPU_usage_Top_sample;
+
+typedef struct {
+  rtems_id id;
+  uint32_t load[ CPU_USAGE_TOP_WINDOW_COUNT ];
+} CPU_usage_Top_entry;
+
+static const uint32_t cpu_usage_top_windows[ CPU_USAGE_TOP_WINDOW_COUNT ] = {
+  1, 10, RTEMS_CPU_USAGE_WINDOW_MAXIMUM
+};
+
+/*
+ *  The samples are written by the sampler task and read by the load getters
+ *  with thread dispatching disabled.
+ */
+static CPU_usage_Top_sample *cpu_usage_top_samples;
+static uint64_t             *cpu_usage_top_idle;
+static CPU_usage_Top_thread *cpu_usage_top_threads;
+static uint32_t              cpu_usage_top_thread_maximum;
+static uint32_t              cpu_usage_top_processor_count;
+static uint32_t              cpu_usage_top_newest;
+static uint32_t              cpu_usage_top_sample_count;
+static volatile bool         cpu_usage_top_running;
+static volatile bool         cpu_usage_top_stop_request;
+
+#ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+  static uint64_t cpu_usage_top_to_units( const Timestamp_Control *time )
+  {
+    return (uint64_t) _Timestamp_Get_seconds( time )
+      * TOD_NANOSECONDS_PER_SECOND
+      + _Timestamp_Get_nanoseconds( time );
+  }
+#endif
+
+static uint64_t cpu_usage_top_thread_used(
+  Thread_Control *the_thread,
+  const void     *uptime
+)
+{
+  #ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+    Timestamp_Control ran = the_thread->cpu_time_used;
+    Timestamp_Control last;
+
+    /*
+     *  Account for the time since the last context switch of a thread
+     *  executing on a processor.
+     */
+    if ( _CPU_usage_Is_executing_on_a_core( the_thread, &last ) ) {
+      Timestamp_Control used;
+
+      _Timestamp_Subtract( &last, (const Timestamp_Control *) uptime, &used );
+      _Timestamp_Add_to( &ran, &used );
+    }
+
+    return cpu_usage_top_to_units( &ran );
+  #else
+    (void) uptime;
+
+    return the_thread->cpu_time_used;
+  #endif
+}
+
+static bool cpu_usage_top_is_idle( Thread_Control *the_thread )
+{
+  return the_thread->Start.entry_point
+    == (Thread_Entry) rtems_configuration_get_idle_task();
+}
+
+static void cpu_usage_top_take_sample( void )
+{
+  CPU_usage_Top_sample *sample;
+  uint32_t              next;
+  uint32_t              api_index;
+  uint32_t              idle_index = 0;
+  #ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+    Timestamp_Control   uptime;
+  #else
+    uint32_t            uptime;
+  #endif
+
+  _Thread_Disable_dispatch();
+
+  next = ( cpu_usage_top_newest + 1 ) % CPU_USAGE_TOP_SAMPLE_COUNT;
+  sample = &cpu_usage_top_samples[ next ];
+  sample->thread_count = 0;
+  memset(
+    sample->idle,
+    0,
+    cpu_usage_top_processor_count * sizeof( *sample->idle )
+  );
+
+  #ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+    _TOD_Get_uptime( &uptime );
+    sample->uptime = cpu_usage_top_to_units( &uptime );
+  #else
+    uptime = _Watchdog_Ticks_since_boot;
+    sample->uptime = uptime;
+  #endif
+
+  for ( api_index = 1 ; api_index <= OBJECTS_APIS_LAST ; api_index++ ) {
+    Objects_Information *information;
+    uint32_t             i;
+
+    #if !defined(RTEMS_POSIX_API) || defined(RTEMS_DEBUG)
+      if ( !_Objects_Information_table[ api_index ] )
+        continue;
+    #endif
+
+    information = _Objects_Information_table[ api_index ][ 1 ];
+    if ( !information )
+      continue;
+
+    for ( i = 1 ; i <= information->maximum ; i++ ) {
+      Thread_Control *the_thread;
+      uint64_t        used;
+
+      the_thread = (Thread_Control *) information->local_table[ i ];
+      if ( !the_thread )
+        continue;
+
+      used = cpu_usage_top_thread_used( the_thread, &uptime );
+
+      /*
+       *  The idle threads are created in processor index order.
+       */
+      if (
+        api_index == OBJECTS_INTERNAL_API
+          && idle_index < cpu_usage_top_processor_count
+          && cpu_usage_top_is_idle( the_thread )
+      ) {
+        sample->idle[ idle_index ] = used;
+        ++idle_index;
+      }
+
+      if ( sample->thread_count < cpu_usage_top_thread_maximum ) {
+        CPU_usage_Top_thread *thread;
+
+        thread = &sample->threads[ sample->thread_count ];
+        thread->id = the_thread->Object.id;
+        thread->used = used;
+        ++sample->thread_count;
+      }
+    }
+  }
+
+  cpu_usage_top_newest = next;
+  if ( cpu_usage_top_sample_count < CPU_USAGE_TOP_SAMPLE_COUNT )
+    ++cpu_usage_top_sample_count;
+
+  _Thread_Enable_dispatch();
+}
+
+static rtems_task cpu_usage_top_task( rtems_task_argument arg )
+{
+  (void) arg;
+
+  while ( !cpu_usage_top_stop_request ) {
+    cpu_usage_top_take_sample();
+    rtems_task_wake_after( rtems_clock_get_ticks_per_second() );
+  }
+
+  cpu_usage_top_running = false;
+
+  rtems_task_delete( RTEMS_SELF );
+}
+
+/*
+ *  Get the newest sample and the sample the window starts with.  Thread
+ *  dispatching must be disabled.
+ */
+static bool cpu_usage_top_get_window(
+  uint32_t                     window,
+  const CPU_usage_Top_sample **newest,
+  const CPU_usage_Top_sample **oldest
+)
+{
+  if ( cpu_usage_top_samples == NULL || cpu_usage_top_sample_count < 2 )
+    return false;
+
+  if ( window > cpu_usage_top_sample_count - 1 )
+    window = cpu_usage_top_sample_count - 1;
+
+  *newest = &cpu_usage_top_samples[ cpu_usage_top_newest ];
+  *oldest = &cpu_usage_top_samples[
+    ( cpu_usage_top_newest + CPU_USAGE_TOP_SAMPLE_COUNT - window )
+      % CPU_USAGE_TOP_SAMPLE_COUNT
+  ];
+
+  return true;
+}
+
+static uint32_t cpu_usage_top_load( uint64_t used, uint64_t elapsed )
+{
+  uint64_t load;
+
+  if ( elapsed == 0 )
+    return 0;
+
+  load = used * CPU_USAGE_TOP_LOAD_MAXIMUM / elapsed;
+  if ( load > CPU_USAGE_TOP_LOAD_MAXIMUM )
+    load = CPU_USAGE_TOP_LOAD_MAXIMUM;
+
+  return (uint32_t) load;
+}
+
+static const CPU_usage_Top_thread *cpu_usage_top_find(
+  const CPU_usage_Top_sample *sample,
+  rtems_id                    id
+)
+{
+  uint32_t low = 0;
+  uint32_t high = sample->thread_count;
+
+  while ( low < high ) {
+    uint32_t                    middle = low + ( high - low ) / 2;
+    const CPU_usage_Top_thread *thread = &sample->threads[ middle ];
+
+    if ( thread->id == id )
+      return thread;
+
+    if ( thread->id < id )
+      low = middle + 1;
+    else
+      high = middle;
+  }
+
+  return NULL;
+}
+
+static uint32_t cpu_usage_top_thread_load(
+  const CPU_usage_Top_thread *thread,
+  const CPU_usage_Top_sample *newest,
+  const CPU_usage_Top_sample *oldest
+)
+{
+  const CPU_usage_Top_thread *before;
+  uint64_t                    used = thread->used;
+
+  before = cpu_usage_top_find( oldest, thread->id );
+
+  /*
+   *  A thread created or reset within the window used its time entirely
+   *  within the window.
+   */
+  if ( before != NULL && before->used <= used )
+    used -= before->used;
+
+  return cpu_usage_top_load( used, newest->uptime - oldest->uptime );
+}
+
+static uint32_t cpu_usage_top_processor_load(
+  uint32_t                    processor,
+  const CPU_usage_Top_sample *newest,
+  const CPU_usage_Top_sample *oldest
+)
+{
+  uint64_t elapsed = newest->uptime - oldest->uptime;
+  uint64_t idle = 0;
+
+  if ( oldest->idle[ processor ] <= newest->idle[ processor ] )
+    idle = newest->idle[ processor ] - oldest->idle[ processor ];
+
+  if ( idle > elapsed )
+    idle = elapsed;
+
+  return cpu_usage_top_load( elapsed - idle, elapsed );
+}
+
+rtems_status_code rtems_cpu_usage_top_start(
+  rtems_task_priority priority
+)
+{
+  rtems_status_code sc;
+  rtems_id          id;
+  uint32_t          thread_maximum = 0;
+  uint32_t          processor_count;
+  uint32_t          api_index;
+  uint32_t          i;
+
+  if ( cpu_usage_top_running )
+    return RTEMS_RESOURCE_IN_USE;
+
+  for ( api_index = 1 ; api_index <= OBJECTS_APIS_LAST ; api_index++ ) {
+    Objects_Information *information;
+
+    #if !defined(RTEMS_POSIX_API) || defined(RTEMS_DEBUG)
+      if ( !_Objects_Information_table[ api_index ] )
+        continue;
+    #endif
+
+    information = _Objects_Information_table[ api_index ][ 1 ];
+    if ( information )
+      thread_maximum += information->maximum;
+  }
+
+  processor_count = rtems_smp_get_processor_count();
+
+  cpu_usage_top_samples = calloc(
+    CPU_USAGE_TOP_SAMPLE_COUNT,
+    sizeof( *cpu_usage_top_samples )
+  );
+  cpu_usage_top_idle = calloc(
+    CPU_USAGE_TOP_SAMPLE_COUNT * processor_count,
+    sizeof( *cpu_usage_top_idle )
+  );
+  cpu_usage_top_threads = calloc(
+    CPU_USAGE_TOP_SAMPLE_COUNT * thread_maximum,
+    sizeof( *cpu_usage_top_threads )
+  );
+
+  if (
+    cpu_usage_top_samples == NULL
+      || cpu_usage_top_idle == NULL
+      || ( cpu_usage_top_threads == NULL && thread_maximum > 0 )
+  ) {
+    sc = RTEMS_NO_MEMORY;
+    goto error;
+  }
+
+  for ( i = 0 ; i < CPU_USAGE_TOP_SAMPLE_COUNT ; i++ ) {
+    CPU_usage_Top_sample *sample = &cpu_usage_top_samples[ i ];
+
+    sample->idle = &cpu_usage_top_idle[ i * processor_count ];
+    sample->threads = &cpu_usage_top_threads[ i * thread_maximum ];
+  }
+
+  cpu_usage_top_thread_maximum = thread_maximum;
+  cpu_usage_top_processor_count = processor_count;
+  cpu_usage_top_newest = CPU_USAGE_TOP_SAMPLE_COUNT - 1;
+  cpu_usage_top_sample_count = 0;
+  cpu_usage_top_stop_request = false;
+
+  sc = rtems_task_create(
+    rtems_build_name( 'C', 'P', 'U', 'T' ),
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  if ( sc != RTEMS_SUCCESSFUL )
+    goto error;
+
+  cpu_usage_top_running = true;
+
+  sc = rtems_task_start( id, cpu_usage_top_task, 0 );
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    cpu_usage_top_running = false;
+    rtems_task_delete( id );
+    goto error;
+  }
+
+  return RTEMS_SUCCESSFUL;
+
+error:
+
+  free( cpu_usage_top_threads );
+  free( cpu_usage_top_idle );
+  free( cpu_usage_top_samples );
+  cpu_usage_top_threads = NULL;
+  cpu_usage_top_idle = NULL;
+  cpu_usage_top_samples = NULL;
+
+  return sc;
+}
+
+void rtems_cpu_usage_top_stop( void )
+{
+  CPU_usage_Top_sample *samples;
+
+  if ( !cpu_usage_top_running )
+    return;
+
+  cpu_usage_top_stop_request = true;
+
+  while ( cpu_usage_top_running )
+    rtems_task_wake_after( 1 );
+
+  _Thread_Disable_dispatch();
+  samples = cpu_usage_top_samples;
+  cpu_usage_top_samples = NULL;
+  _Thread_Enable_dispatch();
+
+  free( cpu_usage_top_threads );
+  free( cpu_usage_top_idle );
+  free( samples );
+  cpu_usage_top_threads = NULL;
+  cpu_usage_top_idle = NULL;
+}
+
+bool rtems_cpu_usage_top_is_active( void )
+{
+  return cpu_usage_top_running;
+}
+
+rtems_status_code rtems_cpu_usage_get_thread_load(
+  rtems_id  id,
+  uint32_t  window,
+  uint32_t *load
+)
+{
+  const CPU_usage_Top_sample *newest;
+  const CPU_usage_Top_sample *oldest;
+  const CPU_usage_Top_thread *thread;
+  rtems_status_code           sc = RTEMS_SUCCESSFUL;
+
+  if ( window == 0 || window > RTEMS_CPU_USAGE_WINDOW_MAXIMUM )
+    return RTEMS_INVALID_NUMBER;
+
+  if ( load == NULL )
+    return RTEMS_INVALID_ADDRESS;
+
+  if ( id == RTEMS_SELF )
+    id = rtems_task_self();
+
+  _Thread_Disable_dispatch();
+
+  if ( cpu_usage_top_get_window( window, &newest, &oldest ) ) {
+    thread = cpu_usage_top_find( newest, id );
+
+    if ( thread != NULL )
+      *load = cpu_usage_top_thread_load( thread, newest, oldest );
+    else
+      sc = RTEMS_INVALID_ID;
+  } else {
+    sc = RTEMS_UNSATISFIED;
+  }
+
+  _Thread_Enable_dispatch();
+
+  return sc;
+}
+
+rtems_status_code rtems_cpu_usage_get_processor_load(
+  uint32_t  processor,
+  uint32_t  window,
+  uint32_t *load
+)
+{
+  const CPU_usage_Top_sample *newest;
+  const CPU_usage_Top_sample *oldest;
+  rtems_status_code           sc = RTEMS_SUCCESSFUL;
+
+  if ( window == 0 || window > RTEMS_CPU_USAGE_WINDOW_MAXIMUM )
+    return RTEMS_INVALID_NUMBER;
+
+  if ( processor >= rtems_smp_get_processor_count() )
+    return RTEMS_INVALID_NUMBER;
+
+  if ( load == NULL )
+    return RTEMS_INVALID_ADDRESS;
+
+  _Thread_Disable_dispatch();
+
+  if ( cpu_usage_top_get_window( window, &newest, &oldest ) )
+    *load = cpu_usage_top_processor_load( processor, newest, oldest );
+  else
+    sc = RTEMS_UNSATISFIED;
+
+  _Thread_Enable_dispatch();
+
+  return sc;
+}
+
+static int cpu_usage_top_compare( const void *a, const void *b )
+{
+  const CPU_usage_Top_entry *lhs = a;
+  const CPU_usage_Top_entry *rhs = b;
+
+  if ( lhs->load[ 0 ] != rhs->load[ 0 ] )
+    return lhs->load[ 0 ] < rhs->load[ 0 ] ? 1 : -1;
+
+  return lhs->id < rhs->id ? -1 : ( lhs->id > rhs->id ? 1 : 0 );
+}
+
+static void cpu_usage_top_print_loads(
+  void                  *context,
+  rtems_printk_plugin_t  print,
+  const uint32_t        *load
+)
+{
+  (*print)(
+    context,
+    " %4" PRIu32 ".%03" PRIu32 " | %4" PRIu32 ".%03" PRIu32
+      " | %4" PRIu32 ".%03" PRIu32 "\n",
+    load[ 0 ] / 1000, load[ 0 ] % 1000,
+    load[ 1 ] / 1000, load[ 1 ] % 1000,
+    load[ 2 ] / 1000, load[ 2 ] % 1000
+  );
+}
+
+void rtems_cpu_usage_top_report_with_plugin(
+  void                  *context,
+  rtems_printk_plugin_t  print
+)
+{
+  CPU_usage_Top_entry *entries;
+  uint32_t            *processor_loads;
+  uint32_t             entry_count = 0;
+  uint32_t             entry_maximum;
+  uint32_t             processor_count;
+  uint32_t             i;
+  uint32_t             w;
+  bool                 ok = true;
+
+  if ( !print )
+    return;
+
+  processor_count = rtems_smp_get_processor_count();
+  entry_maximum = cpu_usage_top_thread_maximum;
+  entries = malloc( ( entry_maximum + 1 ) * sizeof( *entries ) );
+  processor_loads = malloc(
+    processor_count * CPU_USAGE_TOP_WINDOW_COUNT * sizeof( *processor_loads )
+  );
+
+  if ( entries == NULL || processor_loads == NULL ) {
+    free( entries );
+    free( processor_loads );
+    (*print)( context, "not enough memory for the CPU usage top report\n" );
+    return;
+  }
+
+  /*
+   *  Compute the loads with thread dispatching disabled and print them
+   *  afterwards.
+   */
+  _Thread_Disable_dispatch();
+
+  for ( w = 0 ; ok && w < CPU_USAGE_TOP_WINDOW_COUNT ; w++ ) {
+    const CPU_usage_Top_sample *newest;
+    const CPU_usage_Top_sample *oldest;
+
+    ok = cpu_usage_top_get_window(
+      cpu_usage_top_windows[ w ],
+      &newest,
+      &oldest
+    );
+    if ( !ok )
+      break;
+
+    for ( i = 0 ; i < processor_count ; i++ ) {
+      processor_loads[ i * CPU_USAGE_TOP_WINDOW_COUNT + w ] =
+        cpu_usage_top_processor_load( i, newest, oldest );
+    }
+
+    entry_count = newest->thread_count;
+    if ( entry_count > entry_maximum )
+      entry_count = entry_maximum;
+
+    for ( i = 0 ; i < entry_count ; i++ ) {
+      const CPU_usage_Top_thread *thread = &newest->threads[ i ];
+
+      entries[ i ].id = thread->id;
+      entries[ i ].load[ w ] =
+        cpu_usage_top_thread_load( thread, newest, oldest );
+    }
+  }
+
+  _Thread_Enable_dispatch();
+
+  if ( !ok ) {
+    free( entries );
+    free( processor_loads );
+    (*print)( context, "CPU usage top: no samples available\n" );
+    return;
+  }
+
+  qsort( entries, entry_count, sizeof( *entries ), cpu_usage_top_compare );
+
+  (*print)(
+     context,
+     "-------------------------------------------------------------------------------\n"
+     "                         CPU USAGE TOP IN PERCENT\n"
+     "------------+-----------------------------------+----------+----------+---------\n"
+     " ID         | NAME                              | 1S       | 10S      | 60S\n"
+     "------------+-----------------------------------+----------+----------+---------\n"
+  );
+
+  for ( i = 0 ; i < processor_count ; i++ ) {
+    (*print)( context, " CPU %-6" PRIu32 " | %-33s |", i, "PROCESSOR LOAD" );
+    cpu_usage_top_print_loads(
+      context,
+      print,
+      &processor_loads[ i * CPU_USAGE_TOP_WINDOW_COUNT ]
+    );
+  }
+
+  (*print)(
+     context,
+     "------------+-----------------------------------+----------+----------+---------\n"
+  );
+
+  for ( i = 0 ; i < entry_count ; i++ ) {
+    char name[ 34 ];
+
+    rtems_object_get_name( entries[ i ].id, sizeof( name ), name );
+
+    (*print)( context, " 0x%08" PRIx32 " | %-33s |", entries[ i ].id, name );
+    cpu_usage_top_print_loads( context, print, entries[ i ].load );
+  }
+
+  (*print)(
+     context,
+     "-------------------------------------------------------------------------------\n"
+  );
+
+  free( entries );
+  free( processor_loads );
+}
@@ -70,6 +70,98 @@ void rtems_cpu_usage_report( void );
 
 void rtems_cpu_usage_reset( void );
 
+/**
+ *  @brief The maximum CPU usage window in seconds.
+ *
+ *  The CPU usage sampler takes one sample per second and keeps enough
+ *  samples to cover this window.
+ */
+#define RTEMS_CPU_USAGE_WINDOW_MAXIMUM 60
+
+/**
+ *  @brief Start the CPU usage sampler.
+ *
+ *  The sampler task takes a snapshot of the CPU time used by each thread and
+ *  each processor once per second.  The snapshots are kept in a ring, so the
+ *  load of the last seconds can be obtained without a reset of the CPU usage
+ *  counters.  Threads created after the start beyond the current maximum
+ *  thread count are not sampled.
+ *
+ *  @param[in] priority The priority of the sampler task.
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_RESOURCE_IN_USE The sampler is already running.
+ *  @retval RTEMS_NO_MEMORY Not enough memory for the snapshots.
+ */
+rtems_status_code rtems_cpu_usage_top_start(
+  rtems_task_priority priority
+);
+
+/**
+ *  @brief Stop the CPU usage sampler and release its snapshots.
+ */
+void rtems_cpu_usage_top_stop( void );
+
+/**
+ *  @brief Returns true if the CPU usage sampler is running.
+ */
+bool rtems_cpu_usage_top_is_active( void );
+
+/**
+ *  @brief Get the load of a thread during the last seconds.
+ *
+ *  The load is the CPU time used by the thread divided by the elapsed time
+ *  in thousandths of a percent.  If less than the requested window was
+ *  sampled so far, the load of the sampled time is returned.
+ *
+ *  @param[in] id The thread identifier.
+ *  @param[in] window The window in seconds, at most
+ *  RTEMS_CPU_USAGE_WINDOW_MAXIMUM.
+ *  @param[out] load The load of the thread.
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_INVALID_NUMBER Invalid window.
+ *  @retval RTEMS_INVALID_ID The thread was not sampled.
+ *  @retval RTEMS_UNSATISFIED Less than two samples are available.
+ */
+rtems_status_code rtems_cpu_usage_get_thread_load(
+  rtems_id  id,
+  uint32_t  window,
+  uint32_t *load
+);
+
+/**
+ *  @brief Get the load of a processor during the last seconds.
+ *
+ *  The load is the time the processor did not execute its idle thread
+ *  divided by the elapsed time in thousandths of a percent.
+ *
+ *  @param[in] processor The processor index.
+ *  @param[in] window The window in seconds, at most
+ *  RTEMS_CPU_USAGE_WINDOW_MAXIMUM.
+ *  @param[out] load The load of the processor.
+ *
+ *  @retval RTEMS_SUCCESSFUL Successful operation.
+ *  @retval RTEMS_INVALID_NUMBER Invalid window or processor index.
+ *  @retval RTEMS_UNSATISFIED Less than two samples are available.
+ */
+rtems_status_code rtems_cpu_usage_get_processor_load(
+  uint32_t  processor,
+  uint32_t  window,
+  uint32_t *load
+);
+
+/**
+ *  @brief Report the 1 s, 10 s and 60 s loads of the processors and threads.
+ *
+ *  The threads are sorted by their 1 s load.  The CPU usage sampler must be
+ *  running.
+ */
+void rtems_cpu_usage_top_report_with_plugin(
+  void                  *context,
+  rtems_printk_plugin_t  print
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,58 @@
+/**
+ * @file
+ *
+ * @brief CPU Usage Implementation
+ * @ingroup libmisc_cpuuse CPU Usage
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifndef __RTEMS_CPUUSEIMPL_h
+#define __RTEMS_CPUUSEIMPL_h
+
+#include <rtems/cpuuse.h>
+#include <rtems/score/threadimpl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+  /**
+   *  @brief Returns true if the thread executes on a processor and gets the
+   *  time of the last context switch of this processor.
+   */
+  static inline bool _CPU_usage_Is_executing_on_a_core(
+    Thread_Control    *the_thread,
+    Timestamp_Control *time_of_context_switch
+  )
+  {
+    #ifndef RTEMS_SMP
+      if ( _Thread_Executing->Object.id == the_thread->Object.id ) {
+        *time_of_context_switch = _Thread_Time_of_last_context_switch;
+        return true;
+      }
+    #else
+      /* FIXME: Locking */
+      if ( the_thread->is_executing ) {
+        *time_of_context_switch = the_thread->cpu->time_of_last_context_switch;
+        return true;
+      }
+    #endif
+    return false;
+  }
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
@@ -18,9 +18,104 @@
 
 #include <rtems.h>
 #include <rtems/cpuuse.h>
+#include <rtems/error.h>
 #include <rtems/shell.h>
 #include "internal.h"
 
+static volatile bool rtems_shell_cpuuse_top_stop;
+
+static volatile bool rtems_shell_cpuuse_top_active;
+
+/*
+ *  Print the top report in place once per second until stopped.
+ */
+static rtems_task rtems_shell_cpuuse_top_task(
+  rtems_task_argument arg
+)
+{
+  FILE *out = (FILE *) arg;
+
+  while ( !rtems_shell_cpuuse_top_stop ) {
+    fprintf( out, "\033[H\033[J" );
+    rtems_cpu_usage_top_report_with_plugin(
+      out,
+      (rtems_printk_plugin_t) fprintf
+    );
+    fprintf( out, "Press ENTER to exit.\n" );
+    fflush( out );
+    rtems_task_wake_after( rtems_clock_get_ticks_per_second() );
+  }
+
+  rtems_shell_cpuuse_top_active = false;
+
+  rtems_task_delete( RTEMS_SELF );
+}
+
+static int rtems_shell_cpuuse_top( void )
+{
+  rtems_status_code   sc;
+  rtems_task_priority priority;
+  rtems_id            id;
+  bool                started = false;
+  int                 c;
+
+  sc = rtems_task_set_priority( RTEMS_SELF, RTEMS_CURRENT_PRIORITY, &priority );
+  if ( sc != RTEMS_SUCCESSFUL )
+    return -1;
+
+  if ( !rtems_cpu_usage_top_is_active() ) {
+    sc = rtems_cpu_usage_top_start( priority );
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      fprintf( stderr, "cpuuse: cannot start sampler: %s\n",
+               rtems_status_text( sc ) );
+      return -1;
+    }
+    started = true;
+  }
+
+  sc = rtems_task_create(
+    rtems_build_name( 'T', 'O', 'P', ' ' ),
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE * 2,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  if ( sc == RTEMS_SUCCESSFUL ) {
+    rtems_shell_cpuuse_top_stop = false;
+    rtems_shell_cpuuse_top_active = true;
+
+    sc = rtems_task_start(
+      id,
+      rtems_shell_cpuuse_top_task,
+      (rtems_task_argument) stdout
+    );
+    if ( sc != RTEMS_SUCCESSFUL ) {
+      rtems_shell_cpuuse_top_active = false;
+      rtems_task_delete( id );
+    }
+  }
+
+  if ( sc != RTEMS_SUCCESSFUL ) {
+    fprintf( stderr, "cpuuse: cannot start top: %s\n",
+             rtems_status_text( sc ) );
+  } else {
+    do {
+      c = getchar();
+    } while ( c != '\n' && c != '\r' && c != EOF );
+
+    rtems_shell_cpuuse_top_stop = true;
+
+    while ( rtems_shell_cpuuse_top_active )
+      rtems_task_wake_after( 1 );
+  }
+
+  if ( started )
+    rtems_cpu_usage_top_stop();
+
+  return sc == RTEMS_SUCCESSFUL ? 0 : -1;
+}
+
 static int rtems_shell_main_cpuuse(
   int   argc,
   char *argv[]
@@ -43,16 +138,23 @@ static int rtems_shell_main_cpuuse(
     return 0;
   }
 
+  /*
+   *  When invoked with the single argument -t, show the top loads.
+   */
+  if ( argc == 2 && !strcmp( argv[1], "-t" ) ) {
+    return rtems_shell_cpuuse_top();
+  }
+
   /*
    *  OK.  The user did something wrong.
    */
-  fprintf( stderr, "%s: [-r]\n", argv[0] );
+  fprintf( stderr, "%s: [-r|-t]\n", argv[0] );
   return -1;
 }
 
 rtems_shell_cmd_t rtems_shell_CPUUSE_Command = {
   "cpuuse",                                   /* name */
-  "[-r] print or reset per thread cpu usage", /* usage */
+  "[-r|-t] print, reset or top per thread cpu usage", /* usage */
   "rtems",                                    /* topic */
   rtems_shell_main_cpuuse,                    /* command */
   NULL,                                       /* alias */
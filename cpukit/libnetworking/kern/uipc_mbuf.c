@@ -258,7 +258,7 @@ m_copym(struct mbuf *m, int off0, uint32_t len, int wait)
 		if (m->m_flags & M_EXT) {
 			n->m_data = m->m_data + off;
 			if(!m->m_ext.ext_ref)
-				mclrefcnt[mtocl(m->m_ext.ext_buf)]++;
+				MCLREFCNT(m->m_ext.ext_buf)++;
 			else
 				(*(m->m_ext.ext_ref))(m->m_ext.ext_buf,
 							m->m_ext.ext_size);
@@ -300,7 +300,11 @@ m_copypacket(struct mbuf *m, int how)
 	n->m_len = m->m_len;
 	if (m->m_flags & M_EXT) {
 		n->m_data = m->m_data;
-		mclrefcnt[mtocl(m->m_ext.ext_buf)]++;
+		if(!m->m_ext.ext_ref)
+			MCLREFCNT(m->m_ext.ext_buf)++;
+		else
+			(*(m->m_ext.ext_ref))(m->m_ext.ext_buf,
+						m->m_ext.ext_size);
 		n->m_ext = m->m_ext;
 		n->m_flags |= M_EXT;
 	} else {
@@ -319,7 +323,11 @@ m_copypacket(struct mbuf *m, int how)
 		n->m_len = m->m_len;
 		if (m->m_flags & M_EXT) {
 			n->m_data = m->m_data;
-			mclrefcnt[mtocl(m->m_ext.ext_buf)]++;
+			if(!m->m_ext.ext_ref)
+				MCLREFCNT(m->m_ext.ext_buf)++;
+			else
+				(*(m->m_ext.ext_ref))(m->m_ext.ext_buf,
+							m->m_ext.ext_size);
 			n->m_ext = m->m_ext;
 			n->m_flags |= M_EXT;
 		} else {
@@ -598,7 +606,7 @@ extpacket:
 		n->m_flags |= M_EXT;
 		n->m_ext = m->m_ext;
 		if(!m->m_ext.ext_ref)
-			mclrefcnt[mtocl(m->m_ext.ext_buf)]++;
+			MCLREFCNT(m->m_ext.ext_buf)++;
 		else
 			(*(m->m_ext.ext_ref))(m->m_ext.ext_buf,
 						m->m_ext.ext_size);
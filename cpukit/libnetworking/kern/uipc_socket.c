@@ -49,6 +49,25 @@
 static int somaxconn = SOMAXCONN;
 SYSCTL_INT(_kern, KIPC_SOMAXCONN, somaxconn, CTLFLAG_RW, &somaxconn, 0, "");
 
+/*
+ * Copy data between an mbuf and the user buffer.  Large copies are done
+ * without the network semaphore so that the network daemon and other
+ * sockets are not held up.  The caller holds the socket buffer lock, so
+ * no other task sends or receives on the socket buffer meanwhile.
+ */
+static int
+souiomove(caddr_t cp, int n, struct uio *uio)
+{
+	int error;
+
+	if (n < MINCLSIZE)
+		return (uiomove(cp, n, uio));
+	rtems_bsdnet_semaphore_release();
+	error = uiomove(cp, n, uio);
+	rtems_bsdnet_semaphore_obtain();
+	return (error);
+}
+
 /*
  * Socket operation routines.
  * These routines are called by the routines in
@@ -157,6 +176,7 @@ soclose(struct socket *so)
 	int s = splnet();		/* conservative */
 	int error = 0;
 
+	soevdetach(so);
 	if (so->so_options & SO_ACCEPTCONN) {
 		struct socket *sp, *sonext;
 
@@ -420,7 +440,7 @@ nopages:
 					MH_ALIGN(m, len);
 			}
 			space -= len;
-			error = uiomove(mtod(m, caddr_t), (int)len, uio);
+			error = souiomove(mtod(m, caddr_t), (int)len, uio);
 			resid = uio->uio_resid;
 			m->m_len = len;
 			*mp = m;
@@ -677,7 +697,7 @@ dontblock:
 		 */
 		if (mp == 0) {
 			splx(s);
-			error = uiomove(mtod(m, caddr_t) + moff, (int)len, uio);
+			error = souiomove(mtod(m, caddr_t) + moff, (int)len, uio);
 			s = splnet();
 			if (error)
 				goto release;
@@ -68,117 +68,116 @@
 #else
 
 #include <stdio.h> /* for puts */
+#include <machine/endian.h> /* BYTE_ORDER */
 
 /*
  * Checksum routine for Internet Protocol family headers (Portable Version).
  *
  * This routine is very heavily used in the network
  * code and should be modified for each CPU to be as fast as possible.
+ *
+ * The data is added a 32-bit word at a time into a 64-bit accumulator,
+ * so the carries need not be folded back inside the loop.  The sum of
+ * each mbuf is computed as if it started at an even offset and is byte
+ * swapped if it actually starts at an odd offset within the packet.
+ */
+
+/*
+ * Place a byte as the first byte of a 16-bit word
+ */
+#if BYTE_ORDER == BIG_ENDIAN
+#define	CKSUM_BYTE0(b)	((uint32_t)(b) << 8)
+#else
+#define	CKSUM_BYTE0(b)	((uint32_t)(b))
+#endif
+
+static uint32_t
+in_cksum_fold(uint64_t sum)
+{
+	sum = (sum & 0xffffffff) + (sum >> 32);
+	sum = (sum & 0xffffffff) + (sum >> 32);
+	sum = (sum & 0xffff) + (sum >> 16);
+	sum = (sum & 0xffff) + (sum >> 16);
+	return ((uint32_t)sum);
+}
+
+static uint32_t
+in_cksum_swap(uint32_t sum)
+{
+	return (((sum & 0xff) << 8) | (sum >> 8));
+}
+
+/*
+ * Sum of len bytes starting at an even offset, folded to 16 bits
  */
+static uint32_t
+in_cksum_data(const u_char *p, int len)
+{
+	const uint32_t *w;
+	uint64_t sum = 0;
 
-#define ADDCARRY(x)  (x > 65535L ? x -= 65535L : x)
-#define REDUCE \
-  {l_util.l = sum; sum = l_util.s[0] + l_util.s[1];  ADDCARRY(sum);}
+	if (len <= 0)
+		return (0);
+	if (1 & (uintptr_t) p) {
+		/*
+		 * The remaining bytes start at an odd offset, their sum
+		 * must be byte swapped.
+		 */
+		sum = in_cksum_swap(in_cksum_data(p + 1, len - 1));
+		return (in_cksum_fold(sum + CKSUM_BYTE0(*p)));
+	}
+	if ((2 & (uintptr_t) p) && len >= 2) {
+		sum += *(const u_short *)p;
+		p += 2;
+		len -= 2;
+	}
+	w = (const uint32_t *)p;
+	while (len >= 32) {
+		sum += w[0]; sum += w[1]; sum += w[2]; sum += w[3];
+		sum += w[4]; sum += w[5]; sum += w[6]; sum += w[7];
+		w += 8;
+		len -= 32;
+	}
+	while (len >= 4) {
+		sum += *w++;
+		len -= 4;
+	}
+	p = (const u_char *)w;
+	if (len >= 2) {
+		sum += *(const u_short *)p;
+		p += 2;
+		len -= 2;
+	}
+	if (len > 0)
+		sum += CKSUM_BYTE0(*p);
+	return (in_cksum_fold(sum));
+}
 
 int
 in_cksum(
 	struct mbuf *m,
-	uint32_t len )
+	int len )
 {
-	register u_short *w;
-	register int32_t sum = 0;
-	register int32_t mlen = 0;
-	int byte_swapped = 0;
-
-	union {
-		char	c[2];
-		u_short	s;
-	} s_util;
-	union {
-		u_short s[2];
-		long	l;
-	} l_util;
+	uint64_t sum = 0;
+	uint32_t partial;
+	int mlen;
+	int odd = 0;
 
 	for (;m && len; m = m->m_next) {
 		if (m->m_len == 0)
 			continue;
-		w = mtod(m, u_short *);
-		if (mlen == -1) {
-			/*
-			 * The first byte of this mbuf is the continuation
-			 * of a word spanning between this mbuf and the
-			 * last mbuf.
-			 *
-			 * s_util.c[0] is already saved when scanning previous
-			 * mbuf.
-			 */
-			s_util.c[1] = *(char *)w;
-			sum += s_util.s;
-			w = (u_short *)((char *)w + 1);
-			mlen = m->m_len - 1;
-			len--;
-		} else
-			mlen = m->m_len;
+		mlen = m->m_len;
 		if (len < mlen)
 			mlen = len;
+		partial = in_cksum_data(mtod(m, u_char *), mlen);
+		if (odd)
+			partial = in_cksum_swap(partial);
+		sum += partial;
+		odd ^= mlen & 1;
 		len -= mlen;
-		/*
-		 * Force to even boundary.
-		 */
-		if ((1 & (intptr_t) w) && (mlen > 0)) {
-			REDUCE;
-			sum <<= 8;
-			s_util.c[0] = *(u_char *)w;
-			w = (u_short *)((char *)w + 1);
-			mlen--;
-			byte_swapped = 1;
-		}
-		/*
-		 * Unroll the loop to make overhead from
-		 * branches &c small.
-		 */
-		while ((mlen -= 32) >= 0) {
-			sum += w[0]; sum += w[1]; sum += w[2]; sum += w[3];
-			sum += w[4]; sum += w[5]; sum += w[6]; sum += w[7];
-			sum += w[8]; sum += w[9]; sum += w[10]; sum += w[11];
-			sum += w[12]; sum += w[13]; sum += w[14]; sum += w[15];
-			w += 16;
-		}
-		mlen += 32;
-		while ((mlen -= 8) >= 0) {
-			sum += w[0]; sum += w[1]; sum += w[2]; sum += w[3];
-			w += 4;
-		}
-		mlen += 8;
-		if (mlen == 0 && byte_swapped == 0)
-			continue;
-		REDUCE;
-		while ((mlen -= 2) >= 0) {
-			sum += *w++;
-		}
-		if (byte_swapped) {
-			REDUCE;
-			sum <<= 8;
-			byte_swapped = 0;
-			if (mlen == -1) {
-				s_util.c[1] = *(char *)w;
-				sum += s_util.s;
-				mlen = 0;
-			} else
-				mlen = -1;
-		} else if (mlen == -1)
-			s_util.c[0] = *(char *)w;
 	}
 	if (len)
 		puts("cksum: out of data");
-	if (mlen == -1) {
-		/* The last mbuf has odd # of bytes. Follow the
-		   standard (the odd byte may be shifted left by 8 bits
-		   or not as determined by endian-ness of the machine) */
-		s_util.c[1] = 0;
-		sum += s_util.s;
-	}
-	REDUCE;
-	return (~sum & 0xffff);
+	return (~in_cksum_fold(sum) & 0xffff);
 }
 #endif
@@ -181,6 +181,16 @@ struct rtems_bsdnet_config {
 	 */
 	unsigned long		tcp_tx_buf_size;
 	unsigned long		tcp_rx_buf_size;
+	/*
+	 * Upper limits for the mbuf and cluster pools.  The pools
+	 * start with mbuf_bytecount and mbuf_cluster_bytecount and
+	 * grow from the heap up to these limits when they run dry.
+	 * Memory which stays unused is returned to the heap.
+	 *
+	 * The default value 0 keeps the pools at their initial size.
+	 */
+	unsigned long		mbuf_max_bytecount;
+	unsigned long		mbuf_cluster_max_bytecount;
 };
 
 /*
@@ -284,6 +294,74 @@ int rtems_bsdnet_get_ntp(int socket, rtems_bsdnet_ntp_callback_t callback, void
 
 int rtems_bsdnet_synchronize_ntp (int interval, rtems_task_priority priority);
 
+/*
+ * Event queues report ready sockets.  A socket is registered once with
+ * rtems_bsdnet_evq_ctl().  The socket wakeups push the registered sockets
+ * onto the queue, so rtems_bsdnet_evq_wait() does not scan all sockets
+ * like select().  The events are the poll() events POLLIN, POLLRDNORM,
+ * POLLPRI, POLLRDBAND, POLLOUT and POLLWRNORM.  A socket is ready under
+ * the same conditions as for select().  Like poll() the events POLLERR for
+ * a pending socket error and POLLHUP for a socket which cannot receive
+ * more data are reported even if they are not requested.
+ *
+ * A level-triggered socket is reported by each wait as long as it is
+ * ready.  An edge-triggered socket (RTEMS_BSDNET_EVQ_EDGE) is reported
+ * once for each wakeup, e.g. the arrival of data.  A socket is removed
+ * from all event queues when it is closed.  One task at a time may wait
+ * on an event queue.  The functions return -1 and set errno on failure.
+ */
+typedef struct rtems_bsdnet_evq rtems_bsdnet_evq;
+
+#define RTEMS_BSDNET_EVQ_ADD  1
+#define RTEMS_BSDNET_EVQ_MOD  2
+#define RTEMS_BSDNET_EVQ_DEL  3
+
+#define RTEMS_BSDNET_EVQ_EDGE 0x1
+
+struct rtems_bsdnet_evq_event {
+  int fd;
+  short events;
+  void *udata;
+};
+
+rtems_bsdnet_evq *rtems_bsdnet_evq_create (void);
+int rtems_bsdnet_evq_destroy (rtems_bsdnet_evq *evq);
+int rtems_bsdnet_evq_ctl (rtems_bsdnet_evq *evq, int op, int fd,
+                          short events, int flags, void *udata);
+
+/*
+ * Wait for ready sockets and return their count.  The timeout is in
+ * milliseconds like for poll(), -1 waits forever.
+ */
+int rtems_bsdnet_evq_wait (rtems_bsdnet_evq *evq,
+                           struct rtems_bsdnet_evq_event *events,
+                           int maxevents, int timeout);
+
+/*
+ * Zero-copy socket interface.  The data of an mbuf chain is sent and
+ * received without a copy between a user buffer and mbuf clusters.  The
+ * application accesses the data with mtod(), m_len and m_next from
+ * <sys/mbuf.h>.  Note that <sys/mbuf.h> redefines malloc() and free() as
+ * the network stack versions.
+ *
+ * rtems_bsdnet_mbuf_alloc() returns an mbuf for up to MCLBYTES of data.
+ * The application sets m_len and may append further mbufs via m_next.
+ * rtems_bsdnet_sendto_mbuf() always consumes the chain.  For a stream
+ * socket the chain must fit into the send buffer.
+ * rtems_bsdnet_recvfrom_mbuf() returns a chain with up to len bytes which
+ * the application frees with rtems_bsdnet_mbuf_free().
+ */
+struct mbuf;
+struct sockaddr;
+
+struct mbuf *rtems_bsdnet_mbuf_alloc (size_t size);
+void rtems_bsdnet_mbuf_free (struct mbuf *m);
+ssize_t rtems_bsdnet_sendto_mbuf (int s, struct mbuf *m, int flags,
+                                  const struct sockaddr *to, int tolen);
+ssize_t rtems_bsdnet_recvfrom_mbuf (int s, struct mbuf **mp, size_t len,
+                                    int flags, struct sockaddr *from,
+                                    int *fromlen);
+
 /*
  * Callback to report BSD malloc starvation.
  * The default implementation just prints a message but an application
@@ -17,6 +17,7 @@
 #include <rtems/score/coremuteximpl.h>
 #include <sys/types.h>
 #include <sys/param.h>
+#include <sys/systm.h>
 #include <sys/domain.h>
 #include <sys/mbuf.h>
 #include <sys/socketvar.h>
@@ -46,9 +47,18 @@ void sysctl_register_all(void *arg);
  */
 static uint32_t nmbuf       = (64L * 1024L) / MSIZE;
        uint32_t nmbclusters = (128L * 1024L) / MCLBYTES;
+static uint32_t nmbufmax;
+static uint32_t nmbclmax;
+static char    *mbinit_start;
+static char    *mbinit_end;
 
 /*
  * Network task synchronization
+ *
+ * The network semaphore serializes the whole stack including the routing
+ * table, the PCB hash tables and the interface queues.  Only the copy of
+ * socket data between the mbufs and the user buffer runs without it, see
+ * sb_lock().
  */
 static rtems_id networkSemaphore;
 #ifdef RTEMS_FAST_MUTEX
@@ -144,6 +154,7 @@ rtems_bsdnet_semaphore_obtain_recursive(uint32_t nest_count)
 #undef free
 extern void *malloc (size_t);
 extern void free (void *);
+extern int posix_memalign (void **, size_t, size_t);
 void *
 rtems_bsdnet_malloc (size_t size, int type, int flags)
 {
@@ -225,6 +236,8 @@ bsd_init (void)
 		printf ("Can't get network memory.\n");
 		return -1;
 	}
+	mbinit_start = p;
+	mbinit_end = p + nmbuf * MSIZE;
 	for (i = 0; i < nmbuf; i++) {
 		((struct mbuf *)p)->m_next = mmbfree;
 		mmbfree = (struct mbuf *)p;
@@ -287,6 +300,10 @@ rtems_bsdnet_initialize (void)
 		nmbuf = rtems_bsdnet_config.mbuf_bytecount / MSIZE;
 	if (rtems_bsdnet_config.mbuf_cluster_bytecount)
 		nmbclusters = rtems_bsdnet_config.mbuf_cluster_bytecount / MCLBYTES;
+	if (rtems_bsdnet_config.mbuf_max_bytecount)
+		nmbufmax = rtems_bsdnet_config.mbuf_max_bytecount / MSIZE;
+	if (rtems_bsdnet_config.mbuf_cluster_max_bytecount)
+		nmbclmax = rtems_bsdnet_config.mbuf_cluster_max_bytecount / MCLBYTES;
 
         rtems_set_udp_buffer_sizes(
           rtems_bsdnet_config.udp_tx_buf_size,
@@ -420,12 +437,24 @@ rtems_bsdnet_semaphore_release (void)
 #endif
 }
 
+/*
+ * Tasks sleeping on a wait channel.  The list is protected by the
+ * network semaphore.
+ */
+struct sleeper {
+	TAILQ_ENTRY(sleeper) link;
+	void *chan;
+	rtems_id tid;
+};
+static TAILQ_HEAD(, sleeper) sleepers = TAILQ_HEAD_INITIALIZER(sleepers);
+
 /*
  * Wait for something to happen to a socket buffer
  */
 int
 sbwait(struct sockbuf *sb)
 {
+	struct sleeper sleeper;
 	rtems_event_set events;
 	rtems_id tid;
 	rtems_status_code sc;
@@ -443,6 +472,14 @@ sbwait(struct sockbuf *sb)
 	rtems_task_ident (RTEMS_SELF, 0, &tid);
 	sb->sb_sel.si_pid = tid;
 
+	/*
+	 * Several tasks may wait on a socket buffer since the socket
+	 * buffer lock is released while waiting.
+	 */
+	sleeper.chan = &sb->sb_cc;
+	sleeper.tid = tid;
+	TAILQ_INSERT_TAIL (&sleepers, &sleeper, link);
+
 	/*
 	 * Show that socket is waiting
 	 */
@@ -462,6 +499,7 @@ sbwait(struct sockbuf *sb)
 	 * Reobtain the network semaphore.
 	 */
 	rtems_bsdnet_semaphore_obtain ();
+	TAILQ_REMOVE (&sleepers, &sleeper, link);
 
 	/*
 	 * Return the status of the wait.
@@ -485,25 +523,61 @@ sowakeup(
 	if (sb->sb_flags & SB_WAIT) {
 		sb->sb_flags &= ~SB_WAIT;
 		rtems_event_system_send (sb->sb_sel.si_pid, SBWAIT_EVENT);
+		wakeup (&sb->sb_cc);
 	}
 	if (sb->sb_wakeup) {
 		(*sb->sb_wakeup) (so, sb->sb_wakeuparg);
 	}
+	if (so->so_evnotes.lh_first != NULL) {
+		soevwakeup (so, sb);
+	}
 }
 
 /*
- * For now, a socket can be used by only one task at a time.
+ * Wait for the lock of a socket buffer.  The lock is held by another
+ * task while it copies data between the socket buffer and the user
+ * buffer without the network semaphore.
  */
 int
 sb_lock(struct sockbuf *sb)
 {
-	rtems_panic ("Socket buffer is already in use.");
+	struct sleeper sleeper;
+	rtems_event_set events;
+
+	rtems_task_ident (RTEMS_SELF, 0, &sleeper.tid);
+	sleeper.chan = &sb->sb_flags;
+
+	while (sb->sb_flags & SB_LOCK) {
+		sb->sb_flags |= SB_WANT;
+		TAILQ_INSERT_TAIL (&sleepers, &sleeper, link);
+
+		/*
+		 * The wakeup may be sent before this task waits for it, so
+		 * the wait has memory.  A stale event just causes another
+		 * turn of the loop.
+		 */
+		rtems_bsdnet_semaphore_release ();
+		rtems_event_system_receive (SBWAIT_EVENT, RTEMS_EVENT_ANY | RTEMS_WAIT, RTEMS_NO_TIMEOUT, &events);
+		rtems_bsdnet_semaphore_obtain ();
+
+		TAILQ_REMOVE (&sleepers, &sleeper, link);
+	}
+	sb->sb_flags |= SB_LOCK;
 	return 0;
 }
+
+/*
+ * Wake up all tasks sleeping on a wait channel.
+ */
 void
-wakeup (void *p)
+wakeup (void *chan)
 {
-	rtems_panic ("Wakeup called");
+	struct sleeper *sleeper;
+
+	TAILQ_FOREACH (sleeper, &sleepers, link) {
+		if (sleeper->chan == chan)
+			rtems_event_system_send (sleeper->tid, SBWAIT_EVENT);
+	}
 }
 
 /*
@@ -1241,8 +1315,240 @@ rtems_bsdnet_parse_driver_name (const struct rtems_bsdnet_ifconfig *config, char
 	return -1;
 }
 
+/*
+ * Pool growth
+ * When a pool runs dry it grows by chunks from the heap up to the
+ * configured maximum.  A chunk is aligned to its size so the chunk of an
+ * mbuf or cluster is found by masking the address.  The first slot of a
+ * chunk holds the chunk header, for clusters this includes the reference
+ * counts.  Chunks which are found completely free by two checks in a row
+ * are returned to the heap.
+ */
+#define MBCHUNK_SIZE		(64 * MSIZE)
+#define MCLCHUNK_SIZE		(16 * MCLBYTES)
+#define MBCHUNK_MBUFS		(MBCHUNK_SIZE / MSIZE - 1)
+#define MCLCHUNK_CLUSTERS	(MCLCHUNK_SIZE / MCLBYTES - 1)
+#define MBPOOL_CHECK_INTERVAL	10	/* seconds */
+
+#define mtochunk(x, size) \
+	((struct mbchunk *)((uintptr_t)(x) & ~((uintptr_t)(size) - 1)))
+
+struct mbchunk {
+	LIST_ENTRY(mbchunk)	link;
+	int			nfree;
+	int			idle;
+	char			refcnt[MCLCHUNK_SIZE / MCLBYTES];
+};
+
+RTEMS_STATIC_ASSERT(sizeof(struct mbchunk) <= MSIZE, mbchunk_size);
+
+LIST_HEAD(mbchunklist, mbchunk);
+
+static struct mbchunklist mbchunks = LIST_HEAD_INITIALIZER(mbchunks);
+static struct mbchunklist mclchunks = LIST_HEAD_INITIALIZER(mclchunks);
+static int mbpool_check_active;
+
+static void m_poolcheck (void *arg);
+
+static int
+m_mbinitial (struct mbuf *m)
+{
+	return (char *)m >= mbinit_start && (char *)m < mbinit_end;
+}
+
+/*
+ * Reference count of a cluster which does not belong to the initial pool
+ */
+char *
+m_clrefcnt (caddr_t p)
+{
+	struct mbchunk *ch = mtochunk (p, MCLCHUNK_SIZE);
+
+	return &ch->refcnt[((uintptr_t)p & (MCLCHUNK_SIZE - 1)) >> MCLSHIFT];
+}
+
+static struct mbchunk *
+m_chunkalloc (struct mbchunklist *list, size_t size)
+{
+	void *p;
+	struct mbchunk *ch;
+
+	if (posix_memalign (&p, size, size) != 0)
+		return NULL;
+	ch = p;
+	memset (ch, 0, sizeof *ch);
+	LIST_INSERT_HEAD (list, ch, link);
+	mbstat.m_grow++;
+	if (!mbpool_check_active) {
+		mbpool_check_active = 1;
+		timeout (m_poolcheck, NULL,
+		    MBPOOL_CHECK_INTERVAL * rtems_bsdnet_ticks_per_second);
+	}
+	return ch;
+}
+
+/*
+ * Update the idle state of a chunk, return non-zero if it shall be
+ * released
+ */
+static int
+m_chunkidle (struct mbchunk *ch, int nobj)
+{
+	if (ch->nfree != nobj) {
+		ch->idle = 0;
+		return 0;
+	}
+	return ++ch->idle > 1;
+}
+
+/*
+ * Release the chunks marked by m_chunkidle(), their objects must be
+ * removed from the free list already
+ */
+static int
+m_chunkrelease (struct mbchunklist *list)
+{
+	struct mbchunk *ch, *next;
+	int n = 0;
+
+	for (ch = LIST_FIRST (list); ch != NULL; ch = next) {
+		next = LIST_NEXT (ch, link);
+		if (ch->idle > 1) {
+			LIST_REMOVE (ch, link);
+			free (ch);
+			mbstat.m_shrink++;
+			n++;
+		}
+	}
+	return n;
+}
+
+static int
+m_mbgrow (void)
+{
+	struct mbchunk *ch;
+	char *p;
+	int i;
+
+	if (mbstat.m_mbufs + MBCHUNK_MBUFS > nmbufmax)
+		return 0;
+	ch = m_chunkalloc (&mbchunks, MBCHUNK_SIZE);
+	if (ch == NULL)
+		return 0;
+	p = (char *)ch + MSIZE;
+	for (i = 0; i < MBCHUNK_MBUFS; i++) {
+		((struct mbuf *)p)->m_next = mmbfree;
+		mmbfree = (struct mbuf *)p;
+		p += MSIZE;
+	}
+	mbstat.m_mbufs += MBCHUNK_MBUFS;
+	mbstat.m_mtypes[MT_FREE] += MBCHUNK_MBUFS;
+	return 1;
+}
+
+static int
+m_clgrow (void)
+{
+	struct mbchunk *ch;
+	char *p;
+	int i;
+
+	if (mbstat.m_clusters + MCLCHUNK_CLUSTERS > nmbclmax)
+		return 0;
+	ch = m_chunkalloc (&mclchunks, MCLCHUNK_SIZE);
+	if (ch == NULL)
+		return 0;
+	p = (char *)ch + MCLBYTES;
+	for (i = 0; i < MCLCHUNK_CLUSTERS; i++) {
+		((union mcluster *)p)->mcl_next = mclfree;
+		mclfree = (union mcluster *)p;
+		p += MCLBYTES;
+	}
+	mbstat.m_clusters += MCLCHUNK_CLUSTERS;
+	mbstat.m_clfree += MCLCHUNK_CLUSTERS;
+	return 1;
+}
+
+/*
+ * Return idle chunks to the heap
+ * Runs periodically in the network daemon as long as there are chunks.
+ */
+static void
+m_poolcheck (void *arg)
+{
+	struct mbchunk *ch;
+	struct mbuf *m, **mp;
+	union mcluster *c, **cp;
+	int release;
+	int i;
+
+	release = 0;
+	LIST_FOREACH (ch, &mbchunks, link)
+		ch->nfree = 0;
+	for (m = mmbfree; m != NULL; m = m->m_next) {
+		if (!m_mbinitial (m))
+			mtochunk (m, MBCHUNK_SIZE)->nfree++;
+	}
+	LIST_FOREACH (ch, &mbchunks, link)
+		release |= m_chunkidle (ch, MBCHUNK_MBUFS);
+	if (release) {
+		for (mp = &mmbfree; (m = *mp) != NULL;) {
+			if (!m_mbinitial (m) && mtochunk (m, MBCHUNK_SIZE)->idle > 1)
+				*mp = m->m_next;
+			else
+				mp = &m->m_next;
+		}
+		i = m_chunkrelease (&mbchunks) * MBCHUNK_MBUFS;
+		mbstat.m_mbufs -= i;
+		mbstat.m_mtypes[MT_FREE] -= i;
+	}
+
+	release = 0;
+	LIST_FOREACH (ch, &mclchunks, link) {
+		ch->nfree = 0;
+		for (i = 1; i <= MCLCHUNK_CLUSTERS; i++) {
+			if (ch->refcnt[i] == 0)
+				ch->nfree++;
+		}
+		release |= m_chunkidle (ch, MCLCHUNK_CLUSTERS);
+	}
+	if (release) {
+		for (cp = &mclfree; (c = *cp) != NULL;) {
+			if (mtocl (c) >= nmbclusters &&
+			    mtochunk (c, MCLCHUNK_SIZE)->idle > 1)
+				*cp = c->mcl_next;
+			else
+				cp = &c->mcl_next;
+		}
+		i = m_chunkrelease (&mclchunks) * MCLCHUNK_CLUSTERS;
+		mbstat.m_clusters -= i;
+		mbstat.m_clfree -= i;
+	}
+
+	if (LIST_EMPTY (&mbchunks) && LIST_EMPTY (&mclchunks))
+		mbpool_check_active = 0;
+	else
+		timeout (m_poolcheck, NULL,
+		    MBPOOL_CHECK_INTERVAL * rtems_bsdnet_ticks_per_second);
+}
+
+/*
+ * Account the time a task waited for network memory
+ */
+static void
+m_waited (rtems_interval start)
+{
+	rtems_interval waited = rtems_clock_get_ticks_since_boot () - start;
+
+	mbstat.m_waitticks += waited;
+	if (waited > mbstat.m_waitmax)
+		mbstat.m_waitmax = waited;
+}
+
 /*
  * Handle requests for more network memory
+ * The pools grow up to the configured maximum first.  Beyond that, the
+ * request waits until memory is freed.
  * XXX: Another possibility would be to use a semaphore here with
  *      a release in the mbuf free macro.  I have chosen this `polling'
  *      approach because:
@@ -1258,25 +1564,29 @@ rtems_bsdnet_parse_driver_name (const struct rtems_bsdnet_ifconfig *config, char
 int
 m_mballoc(int nmb, int nowait)
 {
+	if (m_mbgrow ())
+		return 1;
 	if (nowait)
 		return 0;
 	m_reclaim ();
 	if (mmbfree == NULL) {
 		int try = 0;
 		int print_limit = 30 * rtems_bsdnet_ticks_per_second;
+		rtems_interval start = rtems_clock_get_ticks_since_boot ();
 
 		mbstat.m_wait++;
 		for (;;) {
 			uint32_t nest_count = rtems_bsdnet_semaphore_release_recursive ();
 			rtems_task_wake_after (1);
 			rtems_bsdnet_semaphore_obtain_recursive (nest_count);
-			if (mmbfree)
+			if (mmbfree || m_mbgrow ())
 				break;
 			if (++try >= print_limit) {
 				printf ("Still waiting for mbuf.\n");
 				try = 0;
 			}
 		}
+		m_waited (start);
 	}
 	else {
 		mbstat.m_drops++;
@@ -1287,25 +1597,29 @@ m_mballoc(int nmb, int nowait)
 int
 m_clalloc(int ncl, int nowait)
 {
+	if (m_clgrow ())
+		return 1;
 	if (nowait)
 		return 0;
 	m_reclaim ();
 	if (mclfree == NULL) {
 		int try = 0;
 		int print_limit = 30 * rtems_bsdnet_ticks_per_second;
+		rtems_interval start = rtems_clock_get_ticks_since_boot ();
 
 		mbstat.m_wait++;
 		for (;;) {
 			uint32_t nest_count = rtems_bsdnet_semaphore_release_recursive ();
 			rtems_task_wake_after (1);
 			rtems_bsdnet_semaphore_obtain_recursive (nest_count);
-			if (mclfree)
+			if (mclfree || m_clgrow ())
 				break;
 			if (++try >= print_limit) {
 				printf ("Still waiting for mbuf cluster.\n");
 				try = 0;
 			}
 		}
+		m_waited (start);
 	}
 	else {
 		mbstat.m_drops++;
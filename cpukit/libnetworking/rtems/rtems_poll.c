@@ -0,0 +1,464 @@
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <string.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/libio_.h>
+#include <rtems/error.h>
+#include <rtems/rtems_bsdnet.h>
+
+#include <errno.h>
+#include <sys/types.h>
+#include <sys/param.h>
+#include <sys/queue.h>
+#include <sys/kernel.h>
+#include <sys/malloc.h>
+#include <sys/mbuf.h>
+#include <sys/socket.h>
+#include <sys/socketvar.h>
+#include <sys/protosw.h>
+#include <sys/poll.h>
+
+/*
+ *********************************************************************
+ *      RTEMS implementation of event queues and poll() system call  *
+ *********************************************************************
+ */
+
+/*
+ * Like select() this works on sockets only.  In contrast to select() a
+ * socket is not rescanned after each wakeup.  The socket wakeups push
+ * the notes of the socket onto the ready list of the event queues, so a
+ * wait only checks the sockets which had a wakeup.
+ *
+ * All data structures are protected by the network semaphore.
+ */
+
+#define EVQ_READ_EVENTS		(POLLIN | POLLRDNORM | POLLPRI | POLLRDBAND)
+#define EVQ_WRITE_EVENTS	(POLLOUT | POLLWRNORM)
+
+static __inline int imin(int a, int b) { return (a < b ? a : b); }
+struct socket *rtems_bsdnet_fdToSocket(int fd);
+
+/*
+ * The registration of a socket with an event queue.
+ */
+struct evnote {
+	LIST_ENTRY(evnote) en_solink;	/* on list of socket */
+	LIST_ENTRY(evnote) en_evqlink;	/* on list of event queue */
+	TAILQ_ENTRY(evnote) en_qlink;	/* on ready list of event queue */
+	struct socket *en_so;		/* NULL if the socket was closed */
+	struct rtems_bsdnet_evq *en_evq;
+	void *en_udata;
+	int en_fd;
+	int en_flags;			/* see RTEMS_BSDNET_EVQ_EDGE */
+	short en_events;		/* events of interest */
+	short en_queued;		/* on ready list */
+};
+
+struct rtems_bsdnet_evq {
+	LIST_HEAD(, evnote) evq_notes;
+	TAILQ_HEAD(, evnote) evq_ready;
+	rtems_id evq_tid;		/* waiting task */
+	int evq_owned;			/* notes are allocated by the queue */
+};
+
+/*
+ * Return the events of interest for which the socket is ready.  The
+ * error and hangup conditions are reported regardless of the events of
+ * interest.
+ */
+static short
+soevready(struct socket *so, short events)
+{
+	short revents = 0;
+
+	if (so->so_error)
+		revents |= POLLERR;
+	if (so->so_state & SS_CANTRCVMORE)
+		revents |= POLLHUP;
+
+	if ((events & (POLLIN | POLLRDNORM)) && soreadable(so))
+		revents |= events & (POLLIN | POLLRDNORM);
+	if ((events & EVQ_WRITE_EVENTS) && sowriteable(so))
+		revents |= events & EVQ_WRITE_EVENTS;
+	if ((events & (POLLPRI | POLLRDBAND))
+	    && (so->so_oobmark || (so->so_state & SS_RCVATMARK)))
+		revents |= events & (POLLPRI | POLLRDBAND);
+	return (revents);
+}
+
+static void
+evq_enqueue(struct evnote *en)
+{
+	struct rtems_bsdnet_evq *evq = en->en_evq;
+
+	if (en->en_queued)
+		return;
+	en->en_queued = 1;
+	TAILQ_INSERT_TAIL(&evq->evq_ready, en, en_qlink);
+	if (evq->evq_tid)
+		rtems_event_system_send (evq->evq_tid, SBWAIT_EVENT);
+}
+
+static void
+evq_attach(struct rtems_bsdnet_evq *evq, struct evnote *en,
+    struct socket *so, int fd, short events, int flags, void *udata)
+{
+	en->en_so = so;
+	en->en_evq = evq;
+	en->en_udata = udata;
+	en->en_fd = fd;
+	en->en_flags = flags;
+	en->en_events = events;
+	en->en_queued = 0;
+	LIST_INSERT_HEAD(&so->so_evnotes, en, en_solink);
+	LIST_INSERT_HEAD(&evq->evq_notes, en, en_evqlink);
+	if (soevready(so, events))
+		evq_enqueue(en);
+}
+
+static void
+evq_detach(struct evnote *en)
+{
+	struct rtems_bsdnet_evq *evq = en->en_evq;
+
+	if (en->en_queued)
+		TAILQ_REMOVE(&evq->evq_ready, en, en_qlink);
+	LIST_REMOVE(en, en_solink);
+	LIST_REMOVE(en, en_evqlink);
+	en->en_so = NULL;
+	if (evq->evq_owned)
+		free(en, M_TEMP);
+}
+
+static struct evnote *
+evq_lookup(struct rtems_bsdnet_evq *evq, int fd)
+{
+	struct evnote *en;
+
+	for (en = evq->evq_notes.lh_first; en != NULL;
+	    en = en->en_evqlink.le_next) {
+		if (en->en_fd == fd)
+			return (en);
+	}
+	return (NULL);
+}
+
+/*
+ * Remove the next note with ready events from the ready list.
+ */
+static struct evnote *
+evq_next(struct rtems_bsdnet_evq *evq, short *revents)
+{
+	struct evnote *en;
+
+	while ((en = evq->evq_ready.tqh_first) != NULL) {
+		TAILQ_REMOVE(&evq->evq_ready, en, en_qlink);
+		en->en_queued = 0;
+		*revents = soevready(en->en_so, en->en_events);
+		if (*revents)
+			return (en);
+	}
+	return (NULL);
+}
+
+/*
+ * Wait until the collect routine returns events or the timeout in
+ * milliseconds expires.  A negative timeout waits forever.
+ */
+static int
+evq_sleep(struct rtems_bsdnet_evq *evq, int timeout,
+    int (*collect)(struct rtems_bsdnet_evq *, void *), void *arg)
+{
+	rtems_interval ticks = 0, then = 0, now;
+	rtems_event_set events;
+	int n;
+
+	if (timeout > 0) {
+		ticks = (rtems_interval)
+		    (((uint64_t) timeout * 1000 + tick - 1) / tick);
+		then = rtems_clock_get_ticks_since_boot();
+	}
+
+	rtems_task_ident (RTEMS_SELF, 0, &evq->evq_tid);
+	rtems_event_system_receive (SBWAIT_EVENT, RTEMS_EVENT_ANY | RTEMS_NO_WAIT, RTEMS_NO_TIMEOUT, &events);
+	for (;;) {
+		n = (*collect)(evq, arg);
+		if (n || timeout == 0)
+			break;
+		if (timeout > 0) {
+			now = rtems_clock_get_ticks_since_boot();
+			if (now - then >= ticks)
+				break;
+			ticks -= now - then;
+			then = now;
+		}
+		rtems_bsdnet_semaphore_release ();
+		rtems_event_system_receive (SBWAIT_EVENT, RTEMS_EVENT_ANY | RTEMS_WAIT, timeout > 0 ? ticks : RTEMS_NO_TIMEOUT, &events);
+		rtems_bsdnet_semaphore_obtain ();
+	}
+	evq->evq_tid = 0;
+	return (n);
+}
+
+/*
+ * Push the notes of a socket onto the ready lists of their event queues.
+ * Called by sowakeup().
+ */
+void
+soevwakeup(struct socket *so, struct sockbuf *sb)
+{
+	struct evnote *en;
+	short events;
+
+	events = sb == &so->so_rcv ? EVQ_READ_EVENTS : EVQ_WRITE_EVENTS;
+	for (en = so->so_evnotes.lh_first; en != NULL;
+	    en = en->en_solink.le_next) {
+		if ((en->en_events & events) || soevready(so, 0))
+			evq_enqueue(en);
+	}
+}
+
+/*
+ * Remove a socket from all event queues.  Called by soclose().
+ */
+void
+soevdetach(struct socket *so)
+{
+	while (so->so_evnotes.lh_first != NULL)
+		evq_detach(so->so_evnotes.lh_first);
+}
+
+rtems_bsdnet_evq *
+rtems_bsdnet_evq_create (void)
+{
+	struct rtems_bsdnet_evq *evq;
+
+	evq = malloc(sizeof(*evq), M_TEMP, M_NOWAIT);
+	if (evq == NULL) {
+		errno = ENOMEM;
+		return (NULL);
+	}
+	LIST_INIT(&evq->evq_notes);
+	TAILQ_INIT(&evq->evq_ready);
+	evq->evq_tid = 0;
+	evq->evq_owned = 1;
+	return (evq);
+}
+
+int
+rtems_bsdnet_evq_destroy (rtems_bsdnet_evq *evq)
+{
+	rtems_bsdnet_semaphore_obtain ();
+	if (evq->evq_tid) {
+		rtems_bsdnet_semaphore_release ();
+		errno = EBUSY;
+		return (-1);
+	}
+	while (evq->evq_notes.lh_first != NULL)
+		evq_detach(evq->evq_notes.lh_first);
+	rtems_bsdnet_semaphore_release ();
+	free(evq, M_TEMP);
+	return (0);
+}
+
+int
+rtems_bsdnet_evq_ctl (rtems_bsdnet_evq *evq, int op, int fd,
+    short events, int flags, void *udata)
+{
+	struct evnote *en, *new_en = NULL;
+	struct socket *so;
+	int error = 0;
+
+	if (op == RTEMS_BSDNET_EVQ_ADD) {
+		new_en = malloc(sizeof(*new_en), M_TEMP, M_WAITOK);
+		if (new_en == NULL) {
+			errno = ENOMEM;
+			return (-1);
+		}
+	}
+
+	rtems_bsdnet_semaphore_obtain ();
+	if ((so = rtems_bsdnet_fdToSocket (fd)) == NULL) {
+		rtems_bsdnet_semaphore_release ();
+		if (new_en != NULL)
+			free(new_en, M_TEMP);
+		return (-1);
+	}
+	en = evq_lookup(evq, fd);
+	switch (op) {
+	case RTEMS_BSDNET_EVQ_ADD:
+		if (en != NULL) {
+			error = EEXIST;
+			break;
+		}
+		evq_attach(evq, new_en, so, fd, events, flags, udata);
+		new_en = NULL;
+		break;
+
+	case RTEMS_BSDNET_EVQ_MOD:
+		if (en == NULL) {
+			error = ENOENT;
+			break;
+		}
+		en->en_events = events;
+		en->en_flags = flags;
+		en->en_udata = udata;
+		if (soevready(so, events))
+			evq_enqueue(en);
+		break;
+
+	case RTEMS_BSDNET_EVQ_DEL:
+		if (en == NULL) {
+			error = ENOENT;
+			break;
+		}
+		evq_detach(en);
+		break;
+
+	default:
+		error = EINVAL;
+		break;
+	}
+	rtems_bsdnet_semaphore_release ();
+	if (new_en != NULL)
+		free(new_en, M_TEMP);
+	if (error) {
+		errno = error;
+		return (-1);
+	}
+	return (0);
+}
+
+struct evq_collect_arg {
+	struct rtems_bsdnet_evq_event *events;
+	int maxevents;
+};
+
+/*
+ * Report the ready sockets.  Level-triggered notes go back onto the
+ * ready list, so the next wait checks them again.
+ */
+static int
+evq_collect(struct rtems_bsdnet_evq *evq, void *arg)
+{
+	struct evq_collect_arg *ca = arg;
+	TAILQ_HEAD(, evnote) requeue;
+	struct evnote *en;
+	short revents;
+	int n = 0;
+
+	TAILQ_INIT(&requeue);
+	while (n < ca->maxevents && (en = evq_next(evq, &revents)) != NULL) {
+		ca->events[n].fd = en->en_fd;
+		ca->events[n].events = revents;
+		ca->events[n].udata = en->en_udata;
+		n++;
+		if ((en->en_flags & RTEMS_BSDNET_EVQ_EDGE) == 0) {
+			en->en_queued = 1;
+			TAILQ_INSERT_TAIL(&requeue, en, en_qlink);
+		}
+	}
+	while ((en = requeue.tqh_first) != NULL) {
+		TAILQ_REMOVE(&requeue, en, en_qlink);
+		TAILQ_INSERT_TAIL(&evq->evq_ready, en, en_qlink);
+	}
+	return (n);
+}
+
+int
+rtems_bsdnet_evq_wait (rtems_bsdnet_evq *evq,
+    struct rtems_bsdnet_evq_event *events, int maxevents, int timeout)
+{
+	struct evq_collect_arg ca;
+	int n;
+
+	if (maxevents <= 0) {
+		errno = EINVAL;
+		return (-1);
+	}
+	ca.events = events;
+	ca.maxevents = maxevents;
+
+	rtems_bsdnet_semaphore_obtain ();
+	if (evq->evq_tid) {
+		rtems_bsdnet_semaphore_release ();
+		errno = EBUSY;
+		return (-1);
+	}
+	n = evq_sleep(evq, timeout, evq_collect, &ca);
+	rtems_bsdnet_semaphore_release ();
+	return (n);
+}
+
+static int
+poll_collect(struct rtems_bsdnet_evq *evq, void *arg)
+{
+	struct evnote *en;
+	short revents;
+	int n = 0;
+
+	while ((en = evq_next(evq, &revents)) != NULL) {
+		((struct pollfd *) en->en_udata)->revents = revents;
+		n++;
+	}
+	return (n);
+}
+
+/*
+ * The descriptors are registered with a temporary event queue, so a
+ * wakeup only checks the socket which had the wakeup.
+ */
+int
+poll (struct pollfd fds[], nfds_t nfds, int timeout)
+{
+	struct rtems_bsdnet_evq evq;
+	struct evnote *notes = NULL;
+	struct socket *so;
+	nfds_t i;
+	int n = 0;
+
+	if (nfds > rtems_libio_number_iops) {
+		errno = EINVAL;
+		return (-1);
+	}
+	if (nfds > 0) {
+		notes = malloc(nfds * sizeof(*notes), M_TEMP, M_WAITOK);
+		if (notes == NULL) {
+			errno = ENOMEM;
+			return (-1);
+		}
+	}
+	LIST_INIT(&evq.evq_notes);
+	TAILQ_INIT(&evq.evq_ready);
+	evq.evq_tid = 0;
+	evq.evq_owned = 0;
+
+	rtems_bsdnet_semaphore_obtain ();
+	for (i = 0; i < nfds; i++) {
+		fds[i].revents = 0;
+		if (fds[i].fd < 0)
+			continue;
+		so = rtems_bsdnet_fdToSocket (fds[i].fd);
+		if (so == NULL) {
+			fds[i].revents = POLLNVAL;
+			n++;
+			continue;
+		}
+		evq_attach(&evq, &notes[i], so, fds[i].fd, fds[i].events,
+		    0, &fds[i]);
+	}
+	n += evq_sleep(&evq, n ? 0 : timeout, poll_collect, NULL);
+	while (evq.evq_notes.lh_first != NULL)
+		evq_detach(evq.evq_notes.lh_first);
+	rtems_bsdnet_semaphore_release ();
+
+	if (notes != NULL)
+		free(notes, M_TEMP);
+	return (n);
+}
@@ -27,6 +27,12 @@ rtems_bsdnet_show_mbuf_stats (void)
 			mbstat.m_mbufs, mbstat.m_clusters, mbstat.m_clfree);
 	printf ("drops:%4lu       waits:%4lu  drains:%4lu\n",
 			mbstat.m_drops, mbstat.m_wait, mbstat.m_drain);
+	printf ("max mbufs in use:%4lu    max clusters in use:%4lu\n",
+			mbstat.m_mbhiwat, mbstat.m_clhiwat);
+	printf ("grown:%4lu     released:%4lu\n",
+			mbstat.m_grow, mbstat.m_shrink);
+	printf ("wait ticks:%6lu  longest wait:%6lu\n",
+			mbstat.m_waitticks, mbstat.m_waitmax);
 	for (i = 0 ; i < 20 ; i++) {
 		switch (i) {
 		case MT_FREE:		cp = "free";		break;
@@ -7,6 +7,7 @@
 /* #include <stdlib.h> */
 #include <stdio.h>
 #include <errno.h>
+#include <limits.h>
 
 #include <rtems.h>
 #include <rtems/libio_.h>
@@ -19,6 +20,7 @@
 #include <sys/mbuf.h>
 #include <sys/socket.h>
 #include <sys/socketvar.h>
+#include <sys/libkern.h>
 #include <sys/protosw.h>
 #include <sys/proc.h>
 #include <sys/fcntl.h>
@@ -548,6 +550,187 @@ recvfrom (int s, void *buf, size_t buflen, int flags, const struct sockaddr *fro
 	return ret;
 }
 
+/*
+ *********************************************************************
+ *                  RTEMS zero-copy socket entry points              *
+ *********************************************************************
+ */
+
+/*
+ * Allocate a packet header mbuf which the application fills with the
+ * data to send.  A cluster is attached if the size exceeds the packet
+ * header mbuf.
+ */
+struct mbuf *
+rtems_bsdnet_mbuf_alloc (size_t size)
+{
+	struct mbuf *m;
+
+	if (size > MCLBYTES) {
+		errno = EINVAL;
+		return NULL;
+	}
+	rtems_bsdnet_semaphore_obtain ();
+	MGETHDR(m, M_WAIT, MT_DATA);
+	if ((m != NULL) && (size > MHLEN)) {
+		MCLGET(m, M_WAIT);
+		if ((m->m_flags & M_EXT) == 0) {
+			m_freem (m);
+			m = NULL;
+		}
+	}
+	rtems_bsdnet_semaphore_release ();
+	if (m == NULL) {
+		errno = ENOBUFS;
+		return NULL;
+	}
+	m->m_len = 0;
+	m->m_pkthdr.len = 0;
+	m->m_pkthdr.rcvif = NULL;
+	return m;
+}
+
+/*
+ * Free an mbuf chain
+ */
+void
+rtems_bsdnet_mbuf_free (struct mbuf *m)
+{
+	rtems_bsdnet_semaphore_obtain ();
+	m_freem (m);
+	rtems_bsdnet_semaphore_release ();
+}
+
+/*
+ * Send an mbuf chain without copying the data.  The chain is consumed
+ * in any case.
+ */
+ssize_t
+rtems_bsdnet_sendto_mbuf (int s, struct mbuf *m, int flags, const struct sockaddr *to, int tolen)
+{
+	int error;
+	struct socket *so;
+	struct mbuf *n;
+	struct mbuf *nam = NULL;
+	int len = 0;
+
+	rtems_bsdnet_semaphore_obtain ();
+	if ((m->m_flags & M_PKTHDR) == 0) {
+		m_freem (m);
+		rtems_bsdnet_semaphore_release ();
+		errno = EINVAL;
+		return -1;
+	}
+	if ((so = rtems_bsdnet_fdToSocket (s)) == NULL) {
+		m_freem (m);
+		rtems_bsdnet_semaphore_release ();
+		return -1;
+	}
+	for (n = m ; n != NULL ; n = n->m_next) {
+		if (n != m)
+			n->m_flags &= ~M_PKTHDR;
+		len += n->m_len;
+	}
+	m->m_pkthdr.len = len;
+	if (to) {
+		error = sockargstombuf (&nam, to, tolen, MT_SONAME);
+		if (error) {
+			m_freem (m);
+			rtems_bsdnet_semaphore_release ();
+			errno = error;
+			return -1;
+		}
+	}
+
+	/*
+	 * Unlike a send from a user buffer sosend() does not wait for
+	 * space in the socket buffer for an mbuf chain.
+	 */
+	error = 0;
+	while ((sbspace (&so->so_snd) < len)
+	    && (len <= so->so_snd.sb_hiwat)
+	    && (so->so_state & SS_ISCONNECTED)
+	    && ((so->so_state & SS_NBIO) == 0)
+	    && ((flags & MSG_DONTWAIT) == 0)) {
+		error = sbwait (&so->so_snd);
+		if (error)
+			break;
+	}
+	if (error)
+		m_freem (m);
+	else
+		error = sosend (so, nam, NULL, m, NULL, flags);
+	if (nam)
+		m_freem (nam);
+	rtems_bsdnet_semaphore_release ();
+	if (error) {
+		errno = error;
+		return -1;
+	}
+	return len;
+}
+
+/*
+ * Receive up to len bytes as an mbuf chain without copying the data.
+ * The application frees the chain with rtems_bsdnet_mbuf_free().
+ */
+ssize_t
+rtems_bsdnet_recvfrom_mbuf (int s, struct mbuf **mp, size_t len, int flags, struct sockaddr *from, int *fromlen)
+{
+	int ret = -1;
+	int error;
+	struct uio auio;
+	struct socket *so;
+	struct mbuf *nam = NULL;
+
+	*mp = NULL;
+	if ((flags & (MSG_OOB | MSG_PEEK)) || (len > INT_MAX)) {
+		errno = EINVAL;
+		return -1;
+	}
+	rtems_bsdnet_semaphore_obtain ();
+	if ((so = rtems_bsdnet_fdToSocket (s)) == NULL) {
+		rtems_bsdnet_semaphore_release ();
+		return -1;
+	}
+	auio.uio_iov = NULL;
+	auio.uio_iovcnt = 0;
+	auio.uio_segflg = UIO_USERSPACE;
+	auio.uio_rw = UIO_READ;
+	auio.uio_offset = 0;
+	auio.uio_resid = len;
+	error = soreceive (so, &nam, &auio, mp, (struct mbuf **)NULL, &flags);
+	if (error) {
+		if (auio.uio_resid != len && (error == EINTR || error == EWOULDBLOCK))
+			error = 0;
+	}
+	if (error) {
+		m_freem (*mp);
+		*mp = NULL;
+		errno = error;
+	}
+	else {
+		ret = len - auio.uio_resid;
+		if (from && fromlen) {
+			int namelen = *fromlen;
+
+			if ((namelen <= 0) || (nam == NULL)) {
+				namelen = 0;
+			}
+			else {
+				if (namelen > nam->m_len)
+					namelen = nam->m_len;
+				memcpy (from, mtod(nam, caddr_t), namelen);
+			}
+			*fromlen = namelen;
+		}
+	}
+	if (nam)
+		m_freem (nam);
+	rtems_bsdnet_semaphore_release ();
+	return (ret);
+}
+
 int
 setsockopt (int s, int level, int name, const void *val, int len)
 {
@@ -57,12 +57,22 @@
  * dtom(x)	-- Convert data pointer within mbuf to mbuf pointer (XXX).
  * mtocl(x) 	-- Convert pointer within cluster to cluster index #
  * cltom(x) 	-- Convert cluster # to ptr to beginning of cluster
+ * MCLREFCNT(x)	-- Reference count of the cluster containing x
  */
 #define	mtod(m, t)	((t)((m)->m_data))
 #define	dtom(x)		((struct mbuf *)((intptr_t)(x) & ~(MSIZE-1)))
 #define	mtocl(x)	(((uintptr_t)(x) - (uintptr_t)mbutl) >> MCLSHIFT)
 #define	cltom(x)	((caddr_t)((u_long)mbutl + ((u_long)(x) << MCLSHIFT)))
 
+/*
+ * Clusters of the initial pool are indexed by mtocl(), clusters added
+ * later by m_clalloc() keep their reference counts in the header of the
+ * chunk they were carved from.
+ */
+#define	MCLREFCNT(x) \
+	(*(mtocl(x) < nmbclusters ? &mclrefcnt[mtocl(x)] : \
+	    m_clrefcnt((caddr_t)(x))))
+
 /*
  * Header present at the beginning of every mbuf.
  */
@@ -174,6 +184,12 @@ struct mbstat {
 	u_long	m_wait;		/* times waited for space */
 	u_long	m_drain;	/* times drained protocols for space */
 	u_short	m_mtypes[256];	/* type specific mbuf allocations */
+	u_long	m_mbhiwat;	/* most mbufs in use at once */
+	u_long	m_clhiwat;	/* most clusters in use at once */
+	u_long	m_grow;		/* chunks added to the pools */
+	u_long	m_shrink;	/* idle chunks returned to the heap */
+	u_long	m_waitticks;	/* total ticks waited for space */
+	u_long	m_waitmax;	/* longest wait for space in ticks */
 };
 
 
@@ -222,6 +238,10 @@ union mcluster {
 	  if (((m) = mmbfree) != 0) { \
 		mmbfree = (m)->m_next; \
 		mbstat.m_mtypes[MT_FREE]--; \
+		if (mbstat.m_mbufs - mbstat.m_mtypes[MT_FREE] > \
+		    mbstat.m_mbhiwat) \
+			mbstat.m_mbhiwat = \
+			    mbstat.m_mbufs - mbstat.m_mtypes[MT_FREE]; \
 		(m)->m_type = (type); \
 		mbstat.m_mtypes[type]++; \
 		(m)->m_next = (struct mbuf *)NULL; \
@@ -242,6 +262,10 @@ union mcluster {
 	  if (((m) = mmbfree) != 0) { \
 		mmbfree = (m)->m_next; \
 		mbstat.m_mtypes[MT_FREE]--; \
+		if (mbstat.m_mbufs - mbstat.m_mtypes[MT_FREE] > \
+		    mbstat.m_mbhiwat) \
+			mbstat.m_mbhiwat = \
+			    mbstat.m_mbufs - mbstat.m_mtypes[MT_FREE]; \
 		(m)->m_type = (type); \
 		mbstat.m_mtypes[type]++; \
 		(m)->m_next = (struct mbuf *)NULL; \
@@ -268,8 +292,10 @@ union mcluster {
 	  if (mclfree == 0) \
 		(void)m_clalloc(1, (how)); \
 	  if (((p) = (caddr_t)mclfree) != 0) { \
-		++mclrefcnt[mtocl(p)]; \
+		++MCLREFCNT(p); \
 		mbstat.m_clfree--; \
+		if (mbstat.m_clusters - mbstat.m_clfree > mbstat.m_clhiwat) \
+			mbstat.m_clhiwat = mbstat.m_clusters - mbstat.m_clfree; \
 		mclfree = ((union mcluster *)(p))->mcl_next; \
 	  } \
 	)
@@ -285,9 +311,25 @@ union mcluster {
 	  } \
 	}
 
+/*
+ * MEXTADD(struct mbuf *m, caddr_t buf, u_int size, free, ref)
+ * attaches external storage, e.g. a receive buffer of a driver, to an
+ * mbuf instead of copying the data into clusters with m_devget().
+ * The free routine is called for each released reference and the ref
+ * routine for each copy of the mbuf which shares the storage.
+ */
+#define	MEXTADD(m, buf, size, free, ref) \
+	{ (m)->m_ext.ext_buf = (caddr_t)(buf); \
+	  (m)->m_data = (m)->m_ext.ext_buf; \
+	  (m)->m_flags |= M_EXT; \
+	  (m)->m_ext.ext_free = (free); \
+	  (m)->m_ext.ext_ref = (ref); \
+	  (m)->m_ext.ext_size = (size); \
+	}
+
 #define	MCLFREE(p) \
 	MBUFLOCK ( \
-	  if (--mclrefcnt[mtocl(p)] == 0) { \
+	  if (--MCLREFCNT(p) == 0) { \
 		((union mcluster *)(p))->mcl_next = mclfree; \
 		mclfree = (union mcluster *)(p); \
 		mbstat.m_clfree++; \
@@ -308,7 +350,7 @@ union mcluster {
 			    (m)->m_ext.ext_size); \
 		else { \
 			char *p = (m)->m_ext.ext_buf; \
-			if (--mclrefcnt[mtocl(p)] == 0) { \
+			if (--MCLREFCNT(p) == 0) { \
 				((union mcluster *)(p))->mcl_next = mclfree; \
 				mclfree = (union mcluster *)(p); \
 				mbstat.m_clfree++; \
@@ -427,6 +469,7 @@ void	m_adj(struct mbuf *, int);
 void	m_cat(struct mbuf *,struct mbuf *);
 int	m_mballoc(int, int);
 int	m_clalloc(int, int);
+char	*m_clrefcnt(caddr_t);
 int	m_copyback(struct mbuf *, int, int, caddr_t);
 int	m_copydata(const struct mbuf *, int, int, caddr_t);
 void	m_freem(struct mbuf *);
@@ -104,6 +104,7 @@ struct socket {
 	void	(*so_upcall)(struct socket *, void *arg, int);
 	void 	*so_upcallarg;		/* Arg for above */
 	uid_t	so_uid;			/* who opened the socket */
+	LIST_HEAD(, evnote) so_evnotes;	/* event queues notified on wakeup */
 };
 
 /*
@@ -181,7 +182,7 @@ struct socket {
  */
 #define sblock(sb, wf) ((sb)->sb_flags & SB_LOCK ? \
 		(((wf) == M_WAITOK) ? sb_lock(sb) : EWOULDBLOCK) : \
-		((sb)->sb_flags |= SB_LOCK), 0)
+		((sb)->sb_flags |= SB_LOCK, 0))
 
 /* release lock on sockbuf sb */
 #define	sbunlock(sb) { \
@@ -243,6 +244,8 @@ int	soconnect2(struct socket *so1, struct socket *so2);
 int	socreate(int dom, struct socket **aso, int type, int proto,
 	    struct proc *p);
 int	sodisconnect(struct socket *so);
+void	soevdetach(struct socket *so);
+void	soevwakeup(struct socket *so, struct sockbuf *sb);
 void	sofree(struct socket *so);
 int	sogetopt(struct socket *so, int level, int optname,
 	    struct mbuf **mp);
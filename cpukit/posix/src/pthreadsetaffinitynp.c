@@ -0,0 +1,66 @@
+/**
+ * @file
+ *
+ * @brief Set Thread Processor Affinity
+ * @ingroup POSIXAPI
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/cpuopts.h>
+
+#if HAVE_DECL_PTHREAD_SETAFFINITY_NP && defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+#include <pthread.h>
+#include <errno.h>
+
+#include <rtems/posix/pthreadimpl.h>
+#include <rtems/score/cpusetimpl.h>
+#include <rtems/score/schedulerimpl.h>
+#include <rtems/score/threadimpl.h>
+
+int pthread_setaffinity_np(
+  pthread_t        id,
+  size_t           cpusetsize,
+  const cpu_set_t *cpuset
+)
+{
+  Objects_Locations  location;
+  Thread_Control    *the_thread;
+  bool               ok;
+
+  if ( !cpuset )
+    return EFAULT;
+
+  the_thread = _Thread_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+#if defined( RTEMS_SMP )
+      ok = _Scheduler_Set_affinity( the_thread, cpusetsize, cpuset );
+#else
+      ok = _CPU_set_Has_all_online_processors( cpusetsize, cpuset );
+#endif
+      _Objects_Put( &the_thread->Object );
+      return ok ? 0 : EINVAL;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+#endif
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return ESRCH;
+}
+#endif
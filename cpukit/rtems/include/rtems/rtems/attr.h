@@ -153,6 +153,23 @@ typedef uint32_t   rtems_attribute;
  */
 #define RTEMS_BARRIER_MANUAL_RELEASE    0x00000000
 
+/******************** RTEMS Region Specific Attributes ********************/
+
+/**
+ *  This attribute constant indicates that the Classic API Region
+ *  instance created will use the first fit allocation mode.
+ */
+#define RTEMS_FIRST_FIT                 0x00000000
+
+/**
+ *  This attribute constant indicates that the Classic API Region
+ *  instance created will use the segregated fit allocation mode.  Its
+ *  segment allocation time does not depend on the fragmentation of the
+ *  region, except for requests which need a linear search of the free
+ *  lists, see _Heap_Enable_segregated_fit().
+ */
+#define RTEMS_SEGREGATED_FIT            0x00000010
+
 /**************** RTEMS Internal Task Specific Attributes ****************/
 
 /**
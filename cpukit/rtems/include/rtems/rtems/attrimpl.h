@@ -212,6 +212,20 @@ RTEMS_INLINE_ROUTINE bool _Attributes_Is_barrier_automatic(
    return ( attribute_set & RTEMS_BARRIER_AUTOMATIC_RELEASE ) ? true : false;
 }
 
+/**
+ *  @brief Checks if the region segregated fit
+ *  attribute is enabled in the attribute_set
+ *
+ *  This function returns TRUE if the region segregated fit
+ *  attribute is enabled in the attribute_set and FALSE otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Attributes_Is_segregated_fit(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_SEGREGATED_FIT ) ? true : false;
+}
+
 /**
  *  @brief Checks if the system task attribute
  *  is enabled in the attribute_set.
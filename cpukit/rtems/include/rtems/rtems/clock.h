@@ -72,6 +72,11 @@ typedef enum {
 typedef TOD_Nanoseconds_since_last_tick_routine
   rtems_nanoseconds_extension_routine;
 
+/**
+ *  Type for the next event BSP extension of tickless clock drivers.
+ */
+typedef Watchdog_First_changed_routine rtems_next_event_extension_routine;
+
 /**
  * @brief Obtain Current Time of Day
  *
@@ -203,6 +208,41 @@ rtems_status_code rtems_clock_set(
  */
 rtems_status_code rtems_clock_tick( void );
 
+/**
+ * @brief Announce Elapsed Nanoseconds
+ *
+ * This routine implements the rtems_clock_tick_nanoseconds directive.  It
+ * is the tickless counterpart of rtems_clock_tick().  It is invoked by a
+ * clock driver which uses one-shot events to inform RTEMS of the time
+ * elapsed since the previous announcement.  All ticks which elapsed in the
+ * meantime are processed at once.
+ *
+ * @param[in] nanoseconds is the time elapsed since the previous announcement
+ *
+ * @retval This directive always returns RTEMS_SUCCESSFUL.
+ *
+ * @note The scheduler tick is processed at most once per announcement.
+ *       See rtems_clock_get_nanoseconds_to_next_event().
+ */
+rtems_status_code rtems_clock_tick_nanoseconds( uint32_t nanoseconds );
+
+/**
+ * @brief Obtain the Nanoseconds to the Next Clock Event
+ *
+ * This directive returns the time from the last announcement to the next
+ * event a tickless clock driver must announce.  This is the earliest of the
+ * next ticks watchdog expiration and the next seconds boundary in case
+ * seconds watchdogs are active.  In case an executing thread uses a
+ * timeslice budget, then this is the next tick boundary.
+ *
+ * @return The nanoseconds to the next event relative to the last
+ *         announcement.  The value is UINT32_MAX if there is no event
+ *         pending or the event is further away.
+ *
+ * @note This directive must be called with interrupts disabled.
+ */
+uint32_t rtems_clock_get_nanoseconds_to_next_event( void );
+
 /**
  * @brief Set the BSP specific Nanoseconds Extension
  *
@@ -221,6 +261,27 @@ rtems_status_code rtems_clock_set_nanoseconds_extension(
   rtems_nanoseconds_extension_routine routine
 );
 
+/**
+ * @brief Set the BSP specific Next Event Extension
+ *
+ * Clock Manager
+ *
+ * This directive sets the extension of a tickless clock driver which is
+ * invoked if a new timeout expires before all previously pending timeouts.
+ * The extension should reprogram the clock event using
+ * rtems_clock_get_nanoseconds_to_next_event().  It may be called from
+ * thread or interrupt context.
+ *
+ * @param[in] routine is a pointer to the extension routine
+ *
+ * @return This method returns RTEMS_SUCCESSFUL if there was not an
+ *         error. Otherwise, a status code is returned indicating the
+ *         source of the error.
+ */
+rtems_status_code rtems_clock_set_next_event_extension(
+  rtems_next_event_extension_routine routine
+);
+
 /**
  * @brief Obtain the System Uptime
  *
@@ -229,6 +229,94 @@ rtems_status_code rtems_message_queue_receive(
   rtems_interval  timeout
 );
 
+/**
+ * @brief RTEMS Message Queue Get Buffer
+ *
+ * This routine implements the rtems_message_queue_get_buffer directive.
+ * This directive obtains a free message buffer of the message queue
+ * indicated by ID.  The calling task owns the message buffer and may fill
+ * in a message of up to the maximum message size in place.  The message
+ * buffer must be handed back with rtems_message_queue_send_buffer() or
+ * rtems_message_queue_release_buffer().
+ *
+ * @param[in] id is the queue id
+ * @param[out] buffer is the pointer to the area to store the message buffer
+ *
+ * @retval RTEMS_SUCCESSFUL if successful or error code if unsuccessful
+ * @retval RTEMS_TOO_MANY if no free message buffer is available
+ */
+rtems_status_code rtems_message_queue_get_buffer(
+  rtems_id   id,
+  void     **buffer
+);
+
+/**
+ * @brief RTEMS Message Queue Send Buffer
+ *
+ * This routine implements the rtems_message_queue_send_buffer directive.
+ * This directive sends the message contained in a message buffer obtained
+ * by rtems_message_queue_get_buffer() or
+ * rtems_message_queue_receive_buffer() to the message queue indicated by
+ * ID without a copy of the message.  On success the ownership of the
+ * message buffer passes to the message queue.
+ *
+ * @param[in] id is the queue id
+ * @param[in] buffer is the message buffer
+ * @param[in] size is the size of the message
+ *
+ * @retval RTEMS_SUCCESSFUL if successful or error code if unsuccessful
+ */
+rtems_status_code rtems_message_queue_send_buffer(
+  rtems_id  id,
+  void     *buffer,
+  size_t    size
+);
+
+/**
+ * @brief RTEMS Message Queue Receive Buffer
+ *
+ * This routine implements the rtems_message_queue_receive_buffer directive.
+ * This directive is invoked when the calling task wishes to receive a
+ * message from the message queue indicated by ID without a copy of the
+ * message.  The message buffer containing the message is returned in
+ * BUFFER and the calling task owns it until it is handed back with
+ * rtems_message_queue_release_buffer() or
+ * rtems_message_queue_send_buffer().  The blocking behaviour is the same as
+ * for rtems_message_queue_receive().
+ *
+ * @param[in] id is the queue id
+ * @param[out] buffer is the pointer to the area to store the message buffer
+ * @param[out] size is the pointer to the area to store the message size
+ * @param[in] option_set is the options on receive
+ * @param[in] timeout is the number of ticks to wait
+ *
+ * @retval RTEMS_SUCCESSFUL if successful or error code if unsuccessful
+ */
+rtems_status_code rtems_message_queue_receive_buffer(
+  rtems_id         id,
+  void           **buffer,
+  size_t          *size,
+  rtems_option     option_set,
+  rtems_interval   timeout
+);
+
+/**
+ * @brief RTEMS Message Queue Release Buffer
+ *
+ * This routine implements the rtems_message_queue_release_buffer directive.
+ * This directive hands back a message buffer owned by the calling task to
+ * the message queue indicated by ID.
+ *
+ * @param[in] id is the queue id
+ * @param[in] buffer is the message buffer
+ *
+ * @retval RTEMS_SUCCESSFUL if successful or error code if unsuccessful
+ */
+rtems_status_code rtems_message_queue_release_buffer(
+  rtems_id  id,
+  void     *buffer
+);
+
 /**
  *  @brief rtems_message_queue_flush
  *
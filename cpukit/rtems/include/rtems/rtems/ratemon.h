@@ -179,6 +179,60 @@ typedef struct {
   Rate_monotonic_Period_time_t         total_wall_time;
 }  Rate_monotonic_Statistics;
 
+/**
+ *  This is the number of buckets of a period latency histogram.
+ */
+#define RTEMS_RATE_MONOTONIC_HISTOGRAM_BUCKETS 40
+
+/**
+ *  This is the number of deadline miss timestamps kept for a period.
+ */
+#define RTEMS_RATE_MONOTONIC_MISS_RING_SIZE 16
+
+/**
+ *  The following defines a log-scale latency histogram of a period.
+ *
+ *  The values are in nanoseconds, or in clock ticks if the statistics
+ *  use ticks.  Bucket zero counts the values zero and one.  Bucket @a i
+ *  greater than zero counts the values in [2^i, 2^(i + 1)).  The last
+ *  bucket also counts all larger values.
+ */
+typedef struct {
+  /** This field contains the number of values in the histogram. */
+  uint32_t     count;
+  /** This field contains the number of values in each bucket. */
+  uint32_t     buckets[ RTEMS_RATE_MONOTONIC_HISTOGRAM_BUCKETS ];
+}  rtems_rate_monotonic_histogram;
+
+/**
+ *  The following defines the optional latency histograms and the deadline
+ *  miss ring of a period.  The storage is provided by the application, see
+ *  rtems_rate_monotonic_set_histograms().
+ */
+typedef struct {
+  /**
+   *  This field contains the delay from the release of a period until its
+   *  owner executes again.
+   */
+  rtems_rate_monotonic_histogram release_jitter;
+  /** This field contains the CPU time used in a period. */
+  rtems_rate_monotonic_histogram execution_time;
+  /**
+   *  This field contains the wall time from the release of a period until
+   *  its owner calls rtems_rate_monotonic_period() again.
+   */
+  rtems_rate_monotonic_histogram response_time;
+
+  /** This field contains the number of deadline misses recorded. */
+  uint32_t     miss_count;
+  /**
+   *  This field contains the uptime of the most recent deadline misses in
+   *  nanoseconds, or in clock ticks if the statistics use ticks.  The most
+   *  recent miss is at index (miss_count - 1) modulo the ring size.
+   */
+  uint64_t     miss_timestamps[ RTEMS_RATE_MONOTONIC_MISS_RING_SIZE ];
+}  rtems_rate_monotonic_histograms;
+
 /**
  *  The following defines the period status structure.
  */
@@ -247,6 +301,12 @@ typedef struct {
    * This field contains the statistics maintained for the period.
    */
   Rate_monotonic_Statistics               Statistics;
+
+  /**
+   * This field points to the optional latency histograms of the period.
+   * It is NULL if the histograms are disabled.
+   */
+  rtems_rate_monotonic_histograms        *histograms;
 }   Rate_monotonic_Control;
 
 /**
@@ -371,6 +431,61 @@ rtems_status_code rtems_rate_monotonic_reset_statistics(
  */
 void rtems_rate_monotonic_reset_all_statistics( void );
 
+/**
+ *  @brief RTEMS Rate Monotonic Set Histograms
+ *
+ *  This routine enables the latency histograms and the deadline miss ring
+ *  of a period.  The histograms are stored in the area provided by the
+ *  application, which is cleared.  The area must stay valid until the
+ *  histograms are disabled or the period is deleted.  A NULL area disables
+ *  the histograms.
+ *
+ *  @param[in] id is the rate monotonic id
+ *  @param[in] histograms is the storage area of the histograms
+ *
+ *  @retval RTEMS_SUCCESSFUL if successful or error code if unsuccessful
+ */
+rtems_status_code rtems_rate_monotonic_set_histograms(
+  rtems_id                         id,
+  rtems_rate_monotonic_histograms *histograms
+);
+
+/**
+ *  @brief RTEMS Rate Monotonic Get Histograms
+ *
+ *  This routine returns a consistent copy of the latency histograms and
+ *  the deadline miss ring of a period.
+ *
+ *  @param[in] id is the rate monotonic id
+ *  @param[out] histograms is the pointer to the histograms copy
+ *
+ *  @retval RTEMS_SUCCESSFUL if successful
+ *  @retval RTEMS_NOT_DEFINED if the histograms of the period are disabled
+ */
+rtems_status_code rtems_rate_monotonic_get_histograms(
+  rtems_id                         id,
+  rtems_rate_monotonic_histograms *histograms
+);
+
+/**
+ *  @brief RTEMS Rate Monotonic Histogram Percentile
+ *
+ *  This routine returns an upper bound of a percentile of the values of a
+ *  latency histogram.  It is the upper bound of the bucket which contains
+ *  the percentile.
+ *
+ *  @param[in] histogram is the latency histogram
+ *  @param[in] per_mille is the percentile in tenths of a percent, e.g.
+ *    999 for the 99.9th percentile
+ *
+ *  @return The upper bound of the percentile or zero if the histogram is
+ *    empty.
+ */
+uint64_t rtems_rate_monotonic_histogram_percentile(
+  const rtems_rate_monotonic_histogram *histogram,
+  uint32_t                              per_mille
+);
+
 /**
  *  @brief RTEMS Report Rate Monotonic Statistics
  *
@@ -18,6 +18,7 @@
 #define _RTEMS_RTEMS_RATEMONIMPL_H
 
 #include <rtems/rtems/ratemon.h>
+#include <rtems/score/isrlevel.h>
 #include <rtems/score/objectimpl.h>
 
 #include <string.h>
@@ -270,6 +271,74 @@ void _Rate_monotonic_Initiate_statistics(
     _Rate_monotonic_Reset_wall_time_statistics( _the_period ); \
   } while (0)
 
+/**
+ *  @brief Converts a period time into a histogram value.
+ *
+ *  @param[in] time is the period time.
+ *
+ *  @return The time in nanoseconds, or in clock ticks if the statistics
+ *    use ticks.
+ */
+RTEMS_INLINE_ROUTINE uint64_t _Rate_monotonic_Histogram_value(
+  const Rate_monotonic_Period_time_t *time
+)
+{
+  #ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+    return (uint64_t) _Timestamp_Get_seconds( time ) * 1000000000
+      + (uint64_t) _Timestamp_Get_nanoseconds( time );
+  #else
+    return *time;
+  #endif
+}
+
+/**
+ *  @brief Adds a value to a period latency histogram.
+ *
+ *  @param[in] histogram is the latency histogram.
+ *  @param[in] value is the value to add.
+ */
+RTEMS_INLINE_ROUTINE void _Rate_monotonic_Histogram_add(
+  rtems_rate_monotonic_histogram *histogram,
+  uint64_t                        value
+)
+{
+  uint32_t bucket = 0;
+
+  while ( value > 1 && bucket < RTEMS_RATE_MONOTONIC_HISTOGRAM_BUCKETS - 1 ) {
+    value >>= 1;
+    ++bucket;
+  }
+
+  ++histogram->buckets[ bucket ];
+  ++histogram->count;
+}
+
+/**
+ *  @brief Resets the latency histograms of a period.
+ *
+ *  The deadline miss ring is updated by _Rate_monotonic_Timeout() in
+ *  interrupt context, so the histograms are cleared with interrupts
+ *  disabled.
+ *
+ *  @param[in] the_period is the period.
+ */
+RTEMS_INLINE_ROUTINE void _Rate_monotonic_Reset_histograms(
+  Rate_monotonic_Control *the_period
+)
+{
+  ISR_Level level;
+
+  _ISR_Disable( level );
+  if ( the_period->histograms != NULL ) {
+    memset(
+      the_period->histograms,
+      0,
+      sizeof( *the_period->histograms )
+    );
+  }
+  _ISR_Enable( level );
+}
+
 /**@}*/
 
 #ifdef __cplusplus
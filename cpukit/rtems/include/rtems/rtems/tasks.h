@@ -46,6 +46,9 @@
 #include <rtems/rtems/asr.h>
 #include <rtems/rtems/attr.h>
 #include <rtems/rtems/status.h>
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+  #include <sys/cpuset.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -497,6 +500,102 @@ rtems_status_code rtems_task_variable_delete(
  */
 rtems_id rtems_task_self(void);
 
+/**
+ * @brief RTEMS Get Task Scheduler Cluster
+ *
+ * This directive returns the index of the processor cluster of the task
+ * associated with ID.  The task executes only on processors of its cluster.
+ *
+ * @param[in] id is the thread id
+ * @param[out] cluster is the processor cluster index of the task
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The cluster pointer is NULL.
+ * @retval RTEMS_INVALID_ID Invalid task id.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT The task is on a remote node.
+ */
+rtems_status_code rtems_task_get_scheduler_cluster(
+  rtems_id  id,
+  uint32_t *cluster
+);
+
+/**
+ * @brief RTEMS Set Task Scheduler Cluster
+ *
+ * This directive moves the task associated with ID to the processor cluster
+ * with the specified index.  The processor clusters are defined by the
+ * application configuration, see CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT.  A
+ * task belongs initially to the cluster of the creating task, so it is
+ * advisable to set the cluster of a new task before it is started.
+ *
+ * @param[in] id is the thread id
+ * @param[in] cluster is the index of the new processor cluster
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_NUMBER Invalid processor cluster index.
+ * @retval RTEMS_INVALID_ID Invalid task id.
+ * @retval RTEMS_RESOURCE_IN_USE The task executes or is scheduled to execute
+ * currently on a processor, for example the calling task.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT The task is on a remote node.
+ */
+rtems_status_code rtems_task_set_scheduler_cluster(
+  rtems_id id,
+  uint32_t cluster
+);
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+/**
+ * @brief RTEMS Get Task Affinity
+ *
+ * This directive returns the processor affinity set of the task associated
+ * with ID.  The task executes only on processors of its affinity set.  The
+ * processor set contains only online processors.
+ *
+ * @param[in] id is the thread id
+ * @param[in] cpusetsize is the size of the processor set in bytes
+ * @param[out] cpuset is the processor affinity set of the task
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The cpuset pointer is NULL.
+ * @retval RTEMS_INVALID_NUMBER The processor set is too small to represent
+ * all online processors.
+ * @retval RTEMS_INVALID_ID Invalid task id.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT The task is on a remote node.
+ */
+rtems_status_code rtems_task_get_affinity(
+  rtems_id   id,
+  size_t     cpusetsize,
+  cpu_set_t *cpuset
+);
+
+/**
+ * @brief RTEMS Set Task Affinity
+ *
+ * This directive sets the processor affinity set of the task associated with
+ * ID.  The task will execute only on processors of its affinity set.
+ * Processors which are not online are ignored.  Only the Deterministic
+ * Priority Affinity SMP Scheduler supports processor sets which do not
+ * contain all online processors, see
+ * CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP.
+ *
+ * @param[in] id is the thread id
+ * @param[in] cpusetsize is the size of the processor set in bytes
+ * @param[in] cpuset is the new processor affinity set of the task
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The cpuset pointer is NULL.
+ * @retval RTEMS_INVALID_NUMBER The processor set is not acceptable for the
+ * scheduler, for example it contains no online processor.
+ * @retval RTEMS_INVALID_ID Invalid task id.
+ * @retval RTEMS_ILLEGAL_ON_REMOTE_OBJECT The task is on a remote node.
+ */
+rtems_status_code rtems_task_set_affinity(
+  rtems_id         id,
+  size_t           cpusetsize,
+  const cpu_set_t *cpuset
+);
+#endif
+
 /**@}*/
 
 /**
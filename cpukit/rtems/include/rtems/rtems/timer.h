@@ -124,6 +124,8 @@ typedef struct {
   Watchdog_Control Ticker;
   /** This field indicates what type of timer this currently is. */
   Timer_Classes    the_class;
+  /** This field points to the timer server of a task-based timer. */
+  struct Timer_server_Control *server;
 }   Timer_Control;
 
 /**
@@ -315,6 +317,112 @@ rtems_status_code rtems_timer_initiate_server(
  */
 #define RTEMS_TIMER_SERVER_DEFAULT_PRIORITY (uint32_t) -1
 
+/**
+ *  This value for the processor of a timer server indicates that the
+ *  timer server may execute on any processor.
+ */
+#define RTEMS_TIMER_SERVER_ANY_PROCESSOR (uint32_t) -1
+
+/**
+ * @brief RTEMS Create Timer Server
+ *
+ * This routine implements the rtems_timer_create_server directive.  It
+ * creates and starts an additional server for task-based timers.  The
+ * timer server task has the name @a name.  Timers are scheduled on this
+ * server with rtems_timer_server_fire_after_on() and
+ * rtems_timer_server_fire_when_on().  In contrast to the default timer
+ * server the additional servers are preemptible.  A timer server with a
+ * high priority executes its timers even if a timer server with a lower
+ * priority is busy with a long-running timer service routine.
+ *
+ * The control block of the timer server is allocated from the workspace.
+ * Timer servers cannot be deleted.
+ *
+ * @param[in] name is the name of the timer server task.
+ * @param[in] priority is the timer server priority.  The
+ * RTEMS_TIMER_SERVER_DEFAULT_PRIORITY selects a priority higher than all
+ * Classic API priorities.
+ * @param[in] stack_size is the stack size in bytes.
+ * @param[in] attribute_set is the timer server task attributes.
+ * @param[in] processor is the index of the processor which executes the
+ * timer server on SMP configurations or RTEMS_TIMER_SERVER_ANY_PROCESSOR.
+ * The processor binding needs a scheduler with support for processor
+ * affinity.
+ * @param[out] server_id is the identifier of the timer server.  It is the
+ * identifier of the timer server task.
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INVALID_ADDRESS The server_id pointer is NULL.
+ * @retval RTEMS_INVALID_PRIORITY Invalid timer server priority.
+ * @retval RTEMS_INVALID_NUMBER Invalid processor index or the scheduler
+ * does not support the processor binding.
+ * @retval RTEMS_NO_MEMORY Not enough workspace for the control block.
+ */
+rtems_status_code rtems_timer_create_server(
+  rtems_name       name,
+  uint32_t         priority,
+  uint32_t         stack_size,
+  rtems_attribute  attribute_set,
+  uint32_t         processor,
+  rtems_id        *server_id
+);
+
+/**
+ * @brief RTEMS Timer Server Fire After On
+ *
+ * This routine implements the rtems_timer_server_fire_after_on directive.
+ * It works like rtems_timer_server_fire_after() but the routine is invoked
+ * by the timer server associated with @a server_id.  The identifier of the
+ * default timer server is the identifier of the task with name "TIME".
+ *
+ * @param[in] server_id is the timer server id
+ * @param[in] id is the timer id
+ * @param[in] ticks is the interval until routine is fired
+ * @param[in] routine is the routine to schedule
+ * @param[in] user_data is the passed as argument to routine when it is fired
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INCORRECT_STATE No timer server with this identifier exists.
+ * @retval RTEMS_INVALID_ADDRESS The routine pointer is NULL.
+ * @retval RTEMS_INVALID_NUMBER The interval is zero.
+ * @retval RTEMS_INVALID_ID Invalid timer id.
+ */
+rtems_status_code rtems_timer_server_fire_after_on(
+  rtems_id                           server_id,
+  rtems_id                           id,
+  rtems_interval                     ticks,
+  rtems_timer_service_routine_entry  routine,
+  void                              *user_data
+);
+
+/**
+ * @brief RTEMS Timer Server Fire When On
+ *
+ * This routine implements the rtems_timer_server_fire_when_on directive.
+ * It works like rtems_timer_server_fire_when() but the routine is invoked
+ * by the timer server associated with @a server_id.
+ *
+ * @param[in] server_id is the timer server id
+ * @param[in] id is the timer id
+ * @param[in] wall_time is the time of day to fire timer
+ * @param[in] routine is the routine to schedule
+ * @param[in] user_data is the passed as argument to routine when it is fired
+ *
+ * @retval RTEMS_SUCCESSFUL Successful operation.
+ * @retval RTEMS_INCORRECT_STATE No timer server with this identifier exists.
+ * @retval RTEMS_NOT_DEFINED The time of day is not set.
+ * @retval RTEMS_INVALID_ADDRESS The routine pointer is NULL.
+ * @retval RTEMS_INVALID_CLOCK Invalid or past wall time.
+ * @retval RTEMS_INVALID_ID Invalid timer id.
+ */
+rtems_status_code rtems_timer_server_fire_when_on(
+  rtems_id                            server_id,
+  rtems_id                            id,
+  rtems_time_of_day                  *wall_time,
+  rtems_timer_service_routine_entry   routine,
+  void                               *user_data
+);
+
 /**
  *  This is the structure filled in by the timer get information
  *  service.
@@ -64,9 +64,9 @@ typedef struct {
   Watchdog_Control System_watchdog;
 
   /**
-   * @brief Chain for watchdogs which will be triggered by the timer server.
+   * @brief Header for watchdogs which will be triggered by the timer server.
    */
-  Chain_Control Chain;
+  Watchdog_Header Header;
 
   /**
    * @brief Last known time snapshot of the timer server.
@@ -77,6 +77,11 @@ typedef struct {
 } Timer_server_Watchdogs;
 
 struct Timer_server_Control {
+  /**
+   * @brief Node on the chain of timer servers.
+   */
+  Chain_Node Node;
+
   /**
    * @brief Timer server thread.
    */
@@ -125,6 +130,15 @@ struct Timer_server_Control {
  */
 RTEMS_TIMER_EXTERN Timer_server_Control *volatile _Timer_server;
 
+/**
+ * @brief Chain of all timer servers.
+ *
+ * The chain contains the default timer server and the timer servers created
+ * by rtems_timer_create_server().  Timer servers are never removed.  The
+ * chain is protected by the thread dispatch disable level.
+ */
+RTEMS_TIMER_EXTERN Chain_Control _Timer_server_Chain;
+
 /**
  *  The following defines the information control block used to manage
  *  this class of objects.
@@ -138,6 +152,56 @@ RTEMS_TIMER_EXTERN Objects_Information  _Timer_Information;
  */
 void _Timer_Manager_initialization(void);
 
+/**
+ * @brief Returns the timer server associated with the identifier.
+ *
+ * @param[in] server_id is the identifier of the timer server task.
+ *
+ * @return The timer server control block or @c NULL if no timer server
+ * with this identifier exists.
+ */
+Timer_server_Control *_Timer_server_Get( Objects_Id server_id );
+
+/**
+ * @brief Schedules an interval timer on a timer server.
+ *
+ * This is the implementation of rtems_timer_server_fire_after() and
+ * rtems_timer_server_fire_after_on().
+ *
+ * @param[in] timer_server is the timer server or @c NULL.
+ * @param[in] id is the timer id
+ * @param[in] ticks is the interval until routine is fired
+ * @param[in] routine is the routine to schedule
+ * @param[in] user_data is the passed as argument to routine when it is fired
+ */
+rtems_status_code _Timer_server_Fire_after(
+  Timer_server_Control              *timer_server,
+  Objects_Id                         id,
+  Watchdog_Interval                  ticks,
+  rtems_timer_service_routine_entry  routine,
+  void                              *user_data
+);
+
+/**
+ * @brief Schedules a time of day timer on a timer server.
+ *
+ * This is the implementation of rtems_timer_server_fire_when() and
+ * rtems_timer_server_fire_when_on().
+ *
+ * @param[in] timer_server is the timer server or @c NULL.
+ * @param[in] id is the timer id
+ * @param[in] wall_time is the time of day to fire timer
+ * @param[in] routine is the routine to schedule
+ * @param[in] user_data is the passed as argument to routine when it is fired
+ */
+rtems_status_code _Timer_server_Fire_when(
+  Timer_server_Control              *timer_server,
+  Objects_Id                         id,
+  rtems_time_of_day                 *wall_time,
+  rtems_timer_service_routine_entry  routine,
+  void                              *user_data
+);
+
 /**
  *  @brief Timer_Allocate
  *
@@ -0,0 +1,108 @@
+/**
+ *  @file
+ *
+ *  @brief Obtain the Nanoseconds to the Next Clock Event
+ *  @ingroup ClassicClock
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/clock.h>
+#include <rtems/score/smp.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/todimpl.h>
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/config.h>
+
+/*
+ *  The scheduler tick accounts the timeslice budget in ticks.  It needs an
+ *  event at each tick boundary while a thread with a budget executes.
+ */
+static bool _Clock_Is_scheduler_tick_necessary( void )
+{
+#ifdef __RTEMS_USE_TICKS_FOR_STATISTICS__
+  return true;
+#else
+  uint32_t processor_count = _SMP_Get_processor_count();
+  uint32_t processor;
+
+  for ( processor = 0 ; processor < processor_count ; ++processor ) {
+    const Thread_Control *executing =
+      _Per_CPU_Get_by_index( processor )->executing;
+
+    if (
+      executing->is_preemptible
+        && executing->budget_algorithm != THREAD_CPU_BUDGET_ALGORITHM_NONE
+    ) {
+      return true;
+    }
+  }
+
+  return false;
+#endif
+}
+
+uint32_t rtems_clock_get_nanoseconds_to_next_event( void )
+{
+  TOD_Control *tod = &_TOD;
+  uint32_t     nanoseconds_per_tick;
+  uint32_t     pending_nanoseconds;
+  uint32_t     seconds_trigger;
+  uint64_t     next_event = UINT32_MAX;
+  ISR_Level    level;
+
+  nanoseconds_per_tick = rtems_configuration_get_nanoseconds_per_tick();
+
+  _TOD_Acquire( tod, level );
+  pending_nanoseconds = tod->pending_nanoseconds;
+  seconds_trigger = tod->seconds_trigger;
+  _TOD_Release( tod, level );
+
+  /*
+   *  The delta interval of the first ticks watchdog is relative to the last
+   *  tick boundary.  The last announcement was the pending nanoseconds after
+   *  this boundary.
+   */
+  _ISR_lock_ISR_disable_and_acquire( &_Watchdog_Lock, level );
+
+  if ( !_Watchdog_Is_empty( &_Watchdog_Ticks_header ) ) {
+    Watchdog_Interval delta_interval =
+      _Watchdog_First( &_Watchdog_Ticks_header )->delta_interval;
+
+    if ( delta_interval == 0 ) {
+      delta_interval = 1;
+    }
+
+    next_event = (uint64_t) delta_interval * nanoseconds_per_tick
+      - pending_nanoseconds;
+  }
+
+  if (
+    !_Watchdog_Is_empty( &_Watchdog_Seconds_header )
+      && TOD_NANOSECONDS_PER_SECOND - seconds_trigger < next_event
+  ) {
+    next_event = TOD_NANOSECONDS_PER_SECOND - seconds_trigger;
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &_Watchdog_Lock, level );
+
+  if (
+    nanoseconds_per_tick - pending_nanoseconds < next_event
+      && _Clock_Is_scheduler_tick_necessary()
+  ) {
+    next_event = nanoseconds_per_tick - pending_nanoseconds;
+  }
+
+  return (uint32_t) next_event;
+}
@@ -0,0 +1,35 @@
+/**
+ *  @file
+ *
+ *  @brief Set the BSP specific Next Event Extension
+ *  @ingroup ClassicClock
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/clock.h>
+#include <rtems/score/watchdogimpl.h>
+
+rtems_status_code rtems_clock_set_next_event_extension(
+  rtems_next_event_extension_routine routine
+)
+{
+  if ( !routine )
+    return RTEMS_INVALID_ADDRESS;
+
+  _Watchdog_Ticks_header.first_changed = routine;
+  _Watchdog_Seconds_header.first_changed = routine;
+
+  return RTEMS_SUCCESSFUL;
+}
@@ -0,0 +1,56 @@
+/**
+ *  @file
+ *
+ *  @brief Announce Elapsed Nanoseconds
+ *  @ingroup ClassicClock
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/clock.h>
+#include <rtems/score/schedulerimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/todimpl.h>
+#include <rtems/score/watchdogimpl.h>
+
+rtems_status_code rtems_clock_tick_nanoseconds( uint32_t nanoseconds )
+{
+  uint32_t ticks;
+
+#if defined( RTEMS_SMP )
+  _Thread_Disable_dispatch();
+#endif
+
+  ticks = _TOD_Tickle_nanoseconds( nanoseconds );
+
+  /*
+   *  The ticks watchdogs fire in order of their expiration time, since the
+   *  adjust operation tickles the chain at each expiration on the way.
+   */
+  if ( ticks > 0 ) {
+    _Watchdog_Adjust_ticks( WATCHDOG_FORWARD, ticks );
+
+    _Scheduler_Tick();
+  }
+
+#if defined( RTEMS_SMP )
+  _Thread_Enable_dispatch();
+#else
+  if ( _Thread_Is_context_switch_necessary() &&
+       _Thread_Dispatch_is_enabled() )
+    _Thread_Dispatch();
+#endif
+
+  return RTEMS_SUCCESSFUL;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file
+ *
+ * @brief rtems_message_queue_get_buffer
+ * @ingroup ClassicMessageQueue Message Queues
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/thread.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/messageimpl.h>
+
+rtems_status_code rtems_message_queue_get_buffer(
+  rtems_id   id,
+  void     **buffer
+)
+{
+  Message_queue_Control             *the_message_queue;
+  Objects_Locations                  location;
+  CORE_message_queue_Buffer_control *the_message;
+
+  if ( !buffer )
+    return RTEMS_INVALID_ADDRESS;
+
+  the_message_queue = _Message_queue_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      the_message = _CORE_message_queue_Allocate_message_buffer(
+        &the_message_queue->message_queue
+      );
+      if ( the_message )
+        _CORE_message_queue_Set_buffer_owned( the_message );
+      _Objects_Put( &the_message_queue->Object );
+
+      if ( !the_message )
+        return RTEMS_TOO_MANY;
+
+      *buffer = the_message->Contents.buffer;
+      return RTEMS_SUCCESSFUL;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+#endif
+
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
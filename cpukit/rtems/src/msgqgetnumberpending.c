@@ -30,10 +30,26 @@
 #include <rtems/rtems/options.h>
 #include <rtems/rtems/support.h>
 
+static bool _Message_queue_Read_number_pending(
+  const Objects_Control *the_object,
+  void                  *arg
+)
+{
+  const Message_queue_Control *the_message_queue;
+  uint32_t                    *count;
+
+  the_message_queue = (const Message_queue_Control *) the_object;
+  count = arg;
+  *count = the_message_queue->message_queue.number_of_pending_messages;
+
+  return true;
+}
+
 /*
  *  rtems_message_queue_get_number_pending
  *
- *  This directive returns the number of messages pending.
+ *  This directive returns the number of messages pending.  The count is
+ *  read without disabling thread dispatching, see _Objects_Read().
  *
  *  Input parameters:
  *    id    - queue id
@@ -50,18 +66,20 @@ rtems_status_code rtems_message_queue_get_number_pending(
   uint32_t *count
 )
 {
-  register Message_queue_Control *the_message_queue;
-  Objects_Locations               location;
+  Objects_Locations location;
 
   if ( !count )
     return RTEMS_INVALID_ADDRESS;
 
-  the_message_queue = _Message_queue_Get( id, &location );
+  location = _Objects_Read(
+    &_Message_queue_Information,
+    id,
+    _Message_queue_Read_number_pending,
+    count
+  );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
-      *count = the_message_queue->message_queue.number_of_pending_messages;
-      _Objects_Put( &the_message_queue->Object );
       return RTEMS_SUCCESSFUL;
 
 #if defined(RTEMS_MULTIPROCESSING)
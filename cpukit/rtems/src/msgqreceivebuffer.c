@@ -0,0 +1,83 @@
+/**
+ * @file
+ *
+ * @brief rtems_message_queue_receive_buffer
+ * @ingroup ClassicMessageQueue Message Queues
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/thread.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/messageimpl.h>
+#include <rtems/rtems/optionsimpl.h>
+
+rtems_status_code rtems_message_queue_receive_buffer(
+  rtems_id         id,
+  void           **buffer,
+  size_t          *size,
+  rtems_option     option_set,
+  rtems_interval   timeout
+)
+{
+  Message_queue_Control             *the_message_queue;
+  Objects_Locations                  location;
+  CORE_message_queue_Buffer_control *the_message;
+  Thread_Control                    *executing;
+  rtems_status_code                  sc;
+
+  if ( !buffer )
+    return RTEMS_INVALID_ADDRESS;
+
+  if ( !size )
+    return RTEMS_INVALID_ADDRESS;
+
+  the_message_queue = _Message_queue_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      executing = _Thread_Executing;
+      _CORE_message_queue_Seize_buffer(
+        &the_message_queue->message_queue,
+        executing,
+        the_message_queue->Object.id,
+        &the_message,
+        !_Options_Is_no_wait( option_set ),
+        timeout
+      );
+      _Objects_Put( &the_message_queue->Object );
+
+      sc = _Message_queue_Translate_core_message_queue_return_code(
+        executing->Wait.return_code
+      );
+      if ( sc == RTEMS_SUCCESSFUL ) {
+        *buffer = the_message->Contents.buffer;
+        *size = the_message->Contents.size;
+      }
+
+      return sc;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+#endif
+
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
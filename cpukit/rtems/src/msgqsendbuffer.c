@@ -0,0 +1,79 @@
+/**
+ * @file
+ *
+ * @brief rtems_message_queue_send_buffer
+ * @ingroup ClassicMessageQueue Message Queues
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/system.h>
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/thread.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/messageimpl.h>
+
+#if defined(RTEMS_MULTIPROCESSING)
+#define MESSAGE_QUEUE_MP_HANDLER _Message_queue_Core_message_queue_mp_support
+#else
+#define MESSAGE_QUEUE_MP_HANDLER NULL
+#endif
+
+rtems_status_code rtems_message_queue_send_buffer(
+  rtems_id  id,
+  void     *buffer,
+  size_t    size
+)
+{
+  Message_queue_Control             *the_message_queue;
+  Objects_Locations                  location;
+  CORE_message_queue_Buffer_control *the_message;
+  CORE_message_queue_Status          status;
+
+  the_message_queue = _Message_queue_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      the_message = _CORE_message_queue_Get_message_buffer(
+        &the_message_queue->message_queue,
+        buffer
+      );
+      if ( !the_message ) {
+        _Objects_Put( &the_message_queue->Object );
+        return RTEMS_INVALID_ADDRESS;
+      }
+
+      status = _CORE_message_queue_Submit_buffer(
+        &the_message_queue->message_queue,
+        the_message,
+        size,
+        id,
+        MESSAGE_QUEUE_MP_HANDLER,
+        CORE_MESSAGE_QUEUE_SEND_REQUEST
+      );
+      _Objects_Put( &the_message_queue->Object );
+
+      return _Message_queue_Translate_core_message_queue_return_code(status);
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+#endif
+
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
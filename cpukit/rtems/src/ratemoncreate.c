@@ -70,6 +70,7 @@ rtems_status_code rtems_rate_monotonic_create(
   _Watchdog_Initialize( &the_period->Timer, NULL, 0, NULL );
 
   _Rate_monotonic_Reset_statistics( the_period );
+  the_period->histograms = NULL;
 
   _Objects_Open(
     &_Rate_monotonic_Information,
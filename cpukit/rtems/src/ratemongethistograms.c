@@ -0,0 +1,64 @@
+/**
+ *  @file
+ *
+ *  @brief RTEMS Rate Monotonic Get Histograms
+ *  @ingroup ClassicRateMon
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/ratemonimpl.h>
+
+rtems_status_code rtems_rate_monotonic_get_histograms(
+  rtems_id                         id,
+  rtems_rate_monotonic_histograms *histograms
+)
+{
+  Objects_Locations       location;
+  Rate_monotonic_Control *the_period;
+  rtems_status_code       status;
+  ISR_Level               level;
+
+  if ( !histograms )
+    return RTEMS_INVALID_ADDRESS;
+
+  the_period = _Rate_monotonic_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      status = RTEMS_NOT_DEFINED;
+
+      /*
+       *  The deadline miss ring is updated in interrupt context, so copy
+       *  with interrupts disabled to get a consistent snapshot.
+       */
+      _ISR_Disable( level );
+      if ( the_period->histograms != NULL ) {
+        *histograms = *the_period->histograms;
+        status = RTEMS_SUCCESSFUL;
+      }
+      _ISR_Enable( level );
+
+      _Objects_Put( &the_period->Object );
+      return status;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:            /* should never return this */
+#endif
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
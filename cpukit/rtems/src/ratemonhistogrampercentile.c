@@ -0,0 +1,61 @@
+/**
+ *  @file
+ *
+ *  @brief RTEMS Rate Monotonic Histogram Percentile
+ *  @ingroup ClassicRateMon
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/ratemon.h>
+
+uint64_t rtems_rate_monotonic_histogram_percentile(
+  const rtems_rate_monotonic_histogram *histogram,
+  uint32_t                              per_mille
+)
+{
+  uint64_t rank;
+  uint64_t seen = 0;
+  uint32_t bucket = 0;
+
+  if ( histogram->count == 0 )
+    return 0;
+
+  if ( per_mille > 1000 )
+    per_mille = 1000;
+
+  /*
+   *  The rank of the percentile is rounded up and at least one.
+   */
+  rank = ( (uint64_t) histogram->count * per_mille + 999 ) / 1000;
+  if ( rank == 0 )
+    rank = 1;
+
+  while ( bucket < RTEMS_RATE_MONOTONIC_HISTOGRAM_BUCKETS ) {
+    seen += histogram->buckets[ bucket ];
+
+    if ( seen >= rank )
+      break;
+
+    ++bucket;
+  }
+
+  /*
+   *  The last bucket has no upper bound.
+   */
+  if ( bucket >= RTEMS_RATE_MONOTONIC_HISTOGRAM_BUCKETS - 1 )
+    return UINT64_MAX;
+
+  return ( (uint64_t) 2 << bucket ) - 1;
+}
@@ -225,6 +225,63 @@ static void _Rate_monotonic_Update_statistics(
     if ( since_last_period > stats->max_wall_time )
       stats->max_wall_time = since_last_period;
   #endif
+
+  /*
+   *  Update the optional latency histograms
+   */
+  if ( the_period->histograms != NULL ) {
+    _Rate_monotonic_Histogram_add(
+      &the_period->histograms->execution_time,
+      _Rate_monotonic_Histogram_value( &executed )
+    );
+    _Rate_monotonic_Histogram_add(
+      &the_period->histograms->response_time,
+      _Rate_monotonic_Histogram_value( &since_last_period )
+    );
+  }
+}
+
+/*
+ *  This routine is invoked by the owner of the period when it executes again
+ *  after it blocked on the period.  The period may have been deleted in the
+ *  meantime, so it is obtained again by its identifier.
+ */
+static void _Rate_monotonic_Update_release_jitter(
+  rtems_id id
+)
+{
+  Rate_monotonic_Control       *the_period;
+  Objects_Locations             location;
+  Rate_monotonic_Period_time_t  jitter;
+  #ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+    Timestamp_Control           uptime;
+  #endif
+
+  the_period = _Rate_monotonic_Get( id, &location );
+
+  if ( location != OBJECTS_LOCAL )
+    return;
+
+  if (
+    the_period->histograms != NULL
+      && the_period->state == RATE_MONOTONIC_ACTIVE
+  ) {
+    #ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+      _TOD_Get_uptime( &uptime );
+      _Timestamp_Subtract(
+        &the_period->time_period_initiated, &uptime, &jitter
+      );
+    #else
+      jitter = _Watchdog_Ticks_since_boot - the_period->time_period_initiated;
+    #endif
+
+    _Rate_monotonic_Histogram_add(
+      &the_period->histograms->release_jitter,
+      _Rate_monotonic_Histogram_value( &jitter )
+    );
+  }
+
+  _Objects_Put( &the_period->Object );
 }
 
 rtems_status_code rtems_rate_monotonic_period(
@@ -325,6 +382,8 @@ rtems_status_code rtems_rate_monotonic_period(
           _Thread_Clear_state( _Thread_Executing, STATES_WAITING_FOR_PERIOD );
 
         _Objects_Put( &the_period->Object );
+
+        _Rate_monotonic_Update_release_jitter( id );
         return RTEMS_SUCCESSFUL;
       }
 
@@ -30,6 +30,115 @@
   #define NANOSECONDS_FMT "%06" PRId32
 #endif
 
+/*
+ *  The percentiles printed for each latency histogram in tenths of a percent.
+ */
+static const uint32_t _Rate_monotonic_Report_per_mille[] = {
+  500, 900, 990, 999
+};
+
+/*
+ *  Print the percentiles of a latency histogram.  Values are printed in
+ *  micro-seconds, or in ticks if the statistics use ticks.  The printk
+ *  plugin cannot print 64-bit values, so the values are limited to 32 bits.
+ */
+static void _Rate_monotonic_Report_percentiles(
+  void                                 *context,
+  rtems_printk_plugin_t                 print,
+  const char                           *label,
+  const rtems_rate_monotonic_histogram *histogram
+)
+{
+  size_t i;
+
+  (*print)( context, "           %-8s", label );
+
+  for ( i = 0 ;
+        i < RTEMS_ARRAY_SIZE( _Rate_monotonic_Report_per_mille ) ;
+        ++i ) {
+    uint64_t value = rtems_rate_monotonic_histogram_percentile(
+      histogram,
+      _Rate_monotonic_Report_per_mille[ i ]
+    );
+
+    #ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+      if ( value != UINT64_MAX )
+        value /= 1000;
+    #endif
+
+    if ( value > UINT32_MAX )
+      (*print)( context, "      inf" );
+    else
+      (*print)( context, " %8" PRIu32, (uint32_t) value );
+  }
+
+  (*print)( context, "\n" );
+}
+
+/*
+ *  Print the optional latency histograms and the deadline miss ring of a
+ *  period.
+ */
+static void _Rate_monotonic_Report_histograms(
+  void                  *context,
+  rtems_printk_plugin_t  print,
+  rtems_id               id
+)
+{
+  rtems_rate_monotonic_histograms the_histograms;
+  uint32_t                        misses;
+  uint32_t                        index;
+
+  if ( rtems_rate_monotonic_get_histograms( id, &the_histograms )
+         != RTEMS_SUCCESSFUL )
+    return;
+
+  _Rate_monotonic_Report_percentiles(
+    context, print, "JITTER", &the_histograms.release_jitter
+  );
+  _Rate_monotonic_Report_percentiles(
+    context, print, "EXEC", &the_histograms.execution_time
+  );
+  _Rate_monotonic_Report_percentiles(
+    context, print, "RESPONSE", &the_histograms.response_time
+  );
+
+  /*
+   *  Print the recorded deadline misses, the most recent first.
+   */
+  misses = the_histograms.miss_count;
+  if ( misses > RTEMS_RATE_MONOTONIC_MISS_RING_SIZE )
+    misses = RTEMS_RATE_MONOTONIC_MISS_RING_SIZE;
+
+  if ( misses == 0 )
+    return;
+
+  (*print)( context, "           MISSES  " );
+
+  index = the_histograms.miss_count;
+  while ( misses > 0 ) {
+    uint64_t timestamp;
+
+    --misses;
+    --index;
+    timestamp = the_histograms.miss_timestamps[
+      index % RTEMS_RATE_MONOTONIC_MISS_RING_SIZE
+    ];
+
+    #ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+      (*print)( context,
+        " %" PRIu32 ".%06" PRIu32,
+        (uint32_t) ( timestamp / 1000000000 ),
+        (uint32_t) ( timestamp % 1000000000 ) / 1000
+      );
+    #else
+      (*print)( context, " %" PRIu32, (uint32_t) timestamp );
+    #endif
+  }
+
+  (*print)( context, "\n" );
+}
+
 void rtems_rate_monotonic_report_statistics_with_plugin(
   void                  *context,
   rtems_printk_plugin_t  print
@@ -49,6 +158,15 @@ void rtems_rate_monotonic_report_statistics_with_plugin(
     (*print)( context, "--- CPU times are in seconds ---\n" );
     (*print)( context, "--- Wall times are in seconds ---\n" );
   #endif
+  (*print)( context,
+    "--- Percentiles P50/P90/P99/P99.9 are upper bounds in "
+  #ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+    "micro-seconds"
+  #else
+    "ticks"
+  #endif
+    " ---\n"
+  );
 /*
 Layout by columns -- in memory of Hollerith :)
 
@@ -192,6 +310,11 @@ ididididid NNNN ccccc mmmmmm X
       );
     #endif
     }
+
+    /*
+     *  print the optional latency histograms
+     */
+    _Rate_monotonic_Report_histograms( context, print, id );
   }
 }
 
@@ -52,6 +52,7 @@ rtems_status_code rtems_rate_monotonic_reset_statistics(
 
     case OBJECTS_LOCAL:
       _Rate_monotonic_Reset_statistics( the_period );
+      _Rate_monotonic_Reset_histograms( the_period );
       _Objects_Put( &the_period->Object );
       return RTEMS_SUCCESSFUL;
 
@@ -0,0 +1,57 @@
+/**
+ *  @file
+ *
+ *  @brief RTEMS Rate Monotonic Set Histograms
+ *  @ingroup ClassicRateMon
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/ratemonimpl.h>
+
+rtems_status_code rtems_rate_monotonic_set_histograms(
+  rtems_id                         id,
+  rtems_rate_monotonic_histograms *histograms
+)
+{
+  Objects_Locations       location;
+  Rate_monotonic_Control *the_period;
+  ISR_Level               level;
+
+  the_period = _Rate_monotonic_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      if ( histograms != NULL )
+        memset( histograms, 0, sizeof( *histograms ) );
+
+      /*
+       *  The deadline miss ring is used by _Rate_monotonic_Timeout().
+       */
+      _ISR_Disable( level );
+        the_period->histograms = histograms;
+      _ISR_Enable( level );
+
+      _Objects_Put( &the_period->Object );
+      return RTEMS_SUCCESSFUL;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:            /* should never return this */
+#endif
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
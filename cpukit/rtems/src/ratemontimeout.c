@@ -20,8 +20,36 @@
 
 #include <rtems/rtems/ratemonimpl.h>
 #include <rtems/score/threadimpl.h>
+#include <rtems/score/todimpl.h>
 #include <rtems/score/watchdogimpl.h>
 
+/*
+ *  This routine records a deadline miss in the optional deadline miss ring
+ *  of the period.
+ */
+static void _Rate_monotonic_Record_miss(
+  Rate_monotonic_Control *the_period
+)
+{
+  rtems_rate_monotonic_histograms *histograms = the_period->histograms;
+  Rate_monotonic_Period_time_t     now;
+  uint32_t                         index;
+
+  if ( histograms == NULL )
+    return;
+
+  #ifndef __RTEMS_USE_TICKS_FOR_STATISTICS__
+    _TOD_Get_uptime( &now );
+  #else
+    now = _Watchdog_Ticks_since_boot;
+  #endif
+
+  index = histograms->miss_count % RTEMS_RATE_MONOTONIC_MISS_RING_SIZE;
+  histograms->miss_timestamps[ index ] =
+    _Rate_monotonic_Histogram_value( &now );
+  ++histograms->miss_count;
+}
+
 void _Rate_monotonic_Timeout(
   Objects_Id  id,
   void       *ignored
@@ -53,8 +81,11 @@ void _Rate_monotonic_Timeout(
         _Rate_monotonic_Initiate_statistics( the_period );
 
         _Watchdog_Insert_ticks( &the_period->Timer, the_period->next_length );
-      } else
+      } else {
         the_period->state = RATE_MONOTONIC_EXPIRED;
+
+        _Rate_monotonic_Record_miss( the_period );
+      }
       _Objects_Put_without_thread_dispatch( &the_period->Object );
       break;
 
@@ -79,6 +79,17 @@ rtems_status_code rtems_region_create(
         &the_region->Memory, starting_address, length, page_size
       );
 
+      if (
+        the_region->maximum_segment_size != 0
+          && _Attributes_Is_segregated_fit( attribute_set )
+      ) {
+        if ( _Heap_Enable_segregated_fit( &the_region->Memory ) ) {
+          the_region->maximum_segment_size -= sizeof( Heap_Segregated_fit );
+        } else {
+          the_region->maximum_segment_size = 0;
+        }
+      }
+
       if ( !the_region->maximum_segment_size ) {
         _Region_Free( the_region );
         return_status = RTEMS_INVALID_SIZE;
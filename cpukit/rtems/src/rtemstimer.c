@@ -25,6 +25,7 @@
 #include <rtems/score/thread.h>
 #include <rtems/rtems/timerimpl.h>
 #include <rtems/score/watchdog.h>
+#include <rtems/score/chainimpl.h>
 
 void _Timer_Manager_initialization(void)
 {
@@ -50,4 +51,5 @@ void _Timer_Manager_initialization(void)
    */
 
   _Timer_server = NULL;
+  _Chain_Initialize_empty( &_Timer_server_Chain );
 }
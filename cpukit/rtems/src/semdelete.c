@@ -68,7 +68,26 @@ rtems_status_code rtems_semaphore_delete(
         );
      }
 
-      _Objects_Close( &_Semaphore_Information, &the_semaphore->Object );
+      if ( _Attributes_Is_counting_semaphore(the_semaphore->attribute_set) ) {
+        ISR_Level level;
+
+        /*
+         *  Obtain and release of a counting semaphore may release the Giant
+         *  lock once they own the thread queue lock.  Close the object under
+         *  this lock to wait for them.
+         */
+        _ISR_lock_ISR_disable_and_acquire(
+          &the_semaphore->Core_control.semaphore.Wait_queue.Lock,
+          level
+        );
+        _Objects_Close( &_Semaphore_Information, &the_semaphore->Object );
+        _ISR_lock_Release_and_ISR_enable(
+          &the_semaphore->Core_control.semaphore.Wait_queue.Lock,
+          level
+        );
+      } else {
+        _Objects_Close( &_Semaphore_Information, &the_semaphore->Object );
+      }
 
       _Semaphore_Free( the_semaphore );
 
@@ -70,7 +70,6 @@ rtems_status_code rtems_semaphore_obtain(
         timeout,
         level
       );
-      _Objects_Put_for_get_isr_disable( &the_semaphore->Object );
       return _Semaphore_Translate_core_semaphore_return_code(
                   executing->Wait.return_code );
 
@@ -73,11 +73,26 @@ rtems_status_code rtems_semaphore_release(
   Objects_Locations           location;
   CORE_mutex_Status           mutex_status;
   CORE_semaphore_Status       semaphore_status;
+  ISR_Level                   level;
 
-  the_semaphore = _Semaphore_Get( id, &location );
+  the_semaphore = _Semaphore_Get_interrupt_disable( id, &location, &level );
   switch ( location ) {
 
     case OBJECTS_LOCAL:
+      if (
+        _Attributes_Is_counting_semaphore( the_semaphore->attribute_set )
+          && _CORE_semaphore_Try_surrender_isr_disable(
+            &the_semaphore->Core_control.semaphore,
+            &semaphore_status,
+            level
+          )
+      ) {
+        return
+          _Semaphore_Translate_core_semaphore_return_code( semaphore_status );
+      }
+
+      _Objects_ISR_enable_for_get_isr_disable( &the_semaphore->Object, level );
+
       if ( !_Attributes_Is_counting_semaphore(the_semaphore->attribute_set) ) {
         mutex_status = _CORE_mutex_Surrender(
           &the_semaphore->Core_control.mutex,
@@ -0,0 +1,73 @@
+/**
+ *  @file
+ *
+ *  @brief RTEMS Get Task Affinity
+ *  @ingroup ClassicTasks
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/tasks.h>
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+
+#include <rtems/rtems/tasksimpl.h>
+#include <rtems/score/cpusetimpl.h>
+#include <rtems/score/schedulerimpl.h>
+#include <rtems/score/threadimpl.h>
+
+rtems_status_code rtems_task_get_affinity(
+  rtems_id   id,
+  size_t     cpusetsize,
+  cpu_set_t *cpuset
+)
+{
+  Thread_Control    *the_thread;
+  Objects_Locations  location;
+  rtems_status_code  sc;
+
+  if ( !cpuset )
+    return RTEMS_INVALID_ADDRESS;
+
+  the_thread = _Thread_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      sc = RTEMS_SUCCESSFUL;
+#if defined( RTEMS_SMP )
+      if ( !_Scheduler_Get_affinity( the_thread, cpusetsize, cpuset ) )
+        sc = RTEMS_INVALID_NUMBER;
+#else
+      if ( _CPU_set_Is_large_enough( cpusetsize ) )
+        _CPU_set_Fill_with_online_processors( cpusetsize, cpuset );
+      else
+        sc = RTEMS_INVALID_NUMBER;
+#endif
+      _Objects_Put( &the_thread->Object );
+      return sc;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+      _Thread_Dispatch();
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+#endif
+
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
+
+#endif /* defined(__RTEMS_HAVE_SYS_CPUSET_H__) */
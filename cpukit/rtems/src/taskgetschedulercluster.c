@@ -0,0 +1,59 @@
+/**
+ *  @file
+ *
+ *  @brief RTEMS Get Task Scheduler Cluster
+ *  @ingroup ClassicTasks
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/tasksimpl.h>
+#include <rtems/score/schedulerimpl.h>
+#include <rtems/score/threadimpl.h>
+
+rtems_status_code rtems_task_get_scheduler_cluster(
+  rtems_id  id,
+  uint32_t *cluster
+)
+{
+  Thread_Control    *the_thread;
+  Objects_Locations  location;
+
+  if ( !cluster )
+    return RTEMS_INVALID_ADDRESS;
+
+  the_thread = _Thread_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+#if defined( RTEMS_SMP )
+      *cluster = _Scheduler_Get_cluster( the_thread );
+#else
+      *cluster = 0;
+#endif
+      _Objects_Put( &the_thread->Object );
+      return RTEMS_SUCCESSFUL;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+      _Thread_Dispatch();
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+#endif
+
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
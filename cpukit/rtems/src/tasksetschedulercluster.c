@@ -0,0 +1,61 @@
+/**
+ *  @file
+ *
+ *  @brief RTEMS Set Task Scheduler Cluster
+ *  @ingroup ClassicTasks
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/tasksimpl.h>
+#include <rtems/score/schedulerimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/config.h>
+
+rtems_status_code rtems_task_set_scheduler_cluster(
+  rtems_id id,
+  uint32_t cluster
+)
+{
+  Thread_Control    *the_thread;
+  Objects_Locations  location;
+  rtems_status_code  sc;
+
+  if ( cluster >= rtems_configuration_get_scheduler_cluster_count() )
+    return RTEMS_INVALID_NUMBER;
+
+  the_thread = _Thread_Get( id, &location );
+  switch ( location ) {
+
+    case OBJECTS_LOCAL:
+      sc = RTEMS_SUCCESSFUL;
+#if defined( RTEMS_SMP )
+      if ( !_Scheduler_Set_cluster( the_thread, cluster ) )
+        sc = RTEMS_RESOURCE_IN_USE;
+#endif
+      _Objects_Put( &the_thread->Object );
+      return sc;
+
+#if defined(RTEMS_MULTIPROCESSING)
+    case OBJECTS_REMOTE:
+      _Thread_Dispatch();
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+#endif
+
+    case OBJECTS_ERROR:
+      break;
+  }
+
+  return RTEMS_INVALID_ID;
+}
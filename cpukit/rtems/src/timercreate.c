@@ -48,6 +48,7 @@ rtems_status_code rtems_timer_create(
   }
 
   the_timer->the_class = TIMER_DORMANT;
+  the_timer->server = NULL;
   _Watchdog_Initialize( &the_timer->Ticker, NULL, 0, NULL );
 
   _Objects_Open(
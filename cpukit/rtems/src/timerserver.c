@@ -28,10 +28,13 @@
 
 #include <rtems/rtems/timerimpl.h>
 #include <rtems/rtems/tasksimpl.h>
+#include <rtems/rtems/smp.h>
+#include <rtems/score/chainimpl.h>
 #include <rtems/score/isrlevel.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/todimpl.h>
 #include <rtems/score/watchdogimpl.h>
+#include <rtems/score/wkspace.h>
 
 static Timer_server_Control _Timer_server_Default;
 
@@ -51,9 +54,9 @@ static void _Timer_server_Reset_interval_system_watchdog(
   _Timer_server_Stop_interval_system_watchdog( ts );
 
   _ISR_Disable( level );
-  if ( !_Chain_Is_empty( &ts->Interval_watchdogs.Chain ) ) {
+  if ( !_Watchdog_Is_empty( &ts->Interval_watchdogs.Header ) ) {
     Watchdog_Interval delta_interval =
-      _Watchdog_First( &ts->Interval_watchdogs.Chain )->delta_interval;
+      _Watchdog_First( &ts->Interval_watchdogs.Header )->delta_interval;
     _ISR_Enable( level );
 
     /*
@@ -84,9 +87,9 @@ static void _Timer_server_Reset_tod_system_watchdog(
   _Timer_server_Stop_tod_system_watchdog( ts );
 
   _ISR_Disable( level );
-  if ( !_Chain_Is_empty( &ts->TOD_watchdogs.Chain ) ) {
+  if ( !_Watchdog_Is_empty( &ts->TOD_watchdogs.Header ) ) {
     Watchdog_Interval delta_interval =
-      _Watchdog_First( &ts->TOD_watchdogs.Chain )->delta_interval;
+      _Watchdog_First( &ts->TOD_watchdogs.Header )->delta_interval;
     _ISR_Enable( level );
 
     /*
@@ -107,9 +110,9 @@ static void _Timer_server_Insert_timer(
 )
 {
   if ( timer->the_class == TIMER_INTERVAL_ON_TASK ) {
-    _Watchdog_Insert( &ts->Interval_watchdogs.Chain, &timer->Ticker );
+    _Watchdog_Insert( &ts->Interval_watchdogs.Header, &timer->Ticker );
   } else if ( timer->the_class == TIMER_TIME_OF_DAY_ON_TASK ) {
-    _Watchdog_Insert( &ts->TOD_watchdogs.Chain, &timer->Ticker );
+    _Watchdog_Insert( &ts->TOD_watchdogs.Header, &timer->Ticker );
   }
 }
 
@@ -144,8 +147,8 @@ static void _Timer_server_Insert_timer_and_make_snapshot(
     _ISR_Disable( level );
     snapshot = _Watchdog_Ticks_since_boot;
     last_snapshot = ts->Interval_watchdogs.last_snapshot;
-    if ( !_Chain_Is_empty( &ts->Interval_watchdogs.Chain ) ) {
-      first_watchdog = _Watchdog_First( &ts->Interval_watchdogs.Chain );
+    if ( !_Watchdog_Is_empty( &ts->Interval_watchdogs.Header ) ) {
+      first_watchdog = _Watchdog_First( &ts->Interval_watchdogs.Header );
 
       /*
        *  We assume adequate unsigned arithmetic here.
@@ -163,7 +166,7 @@ static void _Timer_server_Insert_timer_and_make_snapshot(
     ts->Interval_watchdogs.last_snapshot = snapshot;
     _ISR_Enable( level );
 
-    _Watchdog_Insert( &ts->Interval_watchdogs.Chain, &timer->Ticker );
+    _Watchdog_Insert( &ts->Interval_watchdogs.Header, &timer->Ticker );
 
     if ( !ts->active ) {
       _Timer_server_Reset_interval_system_watchdog( ts );
@@ -176,8 +179,8 @@ static void _Timer_server_Insert_timer_and_make_snapshot(
     _ISR_Disable( level );
     snapshot = (Watchdog_Interval) _TOD_Seconds_since_epoch();
     last_snapshot = ts->TOD_watchdogs.last_snapshot;
-    if ( !_Chain_Is_empty( &ts->TOD_watchdogs.Chain ) ) {
-      first_watchdog = _Watchdog_First( &ts->TOD_watchdogs.Chain );
+    if ( !_Watchdog_Is_empty( &ts->TOD_watchdogs.Header ) ) {
+      first_watchdog = _Watchdog_First( &ts->TOD_watchdogs.Header );
       delta_interval = first_watchdog->delta_interval;
       if ( snapshot > last_snapshot ) {
         /*
@@ -201,7 +204,7 @@ static void _Timer_server_Insert_timer_and_make_snapshot(
     ts->TOD_watchdogs.last_snapshot = snapshot;
     _ISR_Enable( level );
 
-    _Watchdog_Insert( &ts->TOD_watchdogs.Chain, &timer->Ticker );
+    _Watchdog_Insert( &ts->TOD_watchdogs.Header, &timer->Ticker );
 
     if ( !ts->active ) {
       _Timer_server_Reset_tod_system_watchdog( ts );
@@ -220,11 +223,14 @@ static void _Timer_server_Schedule_operation_method(
     _Timer_server_Insert_timer_and_make_snapshot( ts, timer );
   } else {
     /*
-     *  We interrupted a critical section of the timer server.  The timer
-     *  server is not preemptible, so we must be in interrupt context here.  No
-     *  thread dispatch will happen until the timer server finishes its
-     *  critical section.  We have to use the protected chain methods because
-     *  we may be interrupted by a higher priority interrupt.
+     *  We interrupted or preempted the timer server in
+     *  _Timer_server_Get_watchdogs_that_fire_now().  An interrupt may do this
+     *  for every timer server and a higher priority task may do this for a
+     *  preemptible timer server.  In both cases thread dispatching is
+     *  disabled here, so the timer server cannot continue before we are
+     *  done.  It processes the insert chain until it is empty before it
+     *  leaves this section.  We have to use the protected chain methods
+     *  because we may be interrupted by a higher priority interrupt.
      */
     _Chain_Append( ts->insert_chain, &timer->Object.Node );
   }
@@ -244,7 +250,7 @@ static void _Timer_server_Process_interval_watchdogs(
 
   watchdogs->last_snapshot = snapshot;
 
-  _Watchdog_Adjust_to_chain( &watchdogs->Chain, delta, fire_chain );
+  _Watchdog_Adjust_to_chain( &watchdogs->Header, delta, fire_chain );
 }
 
 static void _Timer_server_Process_tod_watchdogs(
@@ -259,7 +265,7 @@ static void _Timer_server_Process_tod_watchdogs(
   /*
    *  Process the seconds chain.  Start by checking that the Time
    *  of Day (TOD) has not been set backwards.  If it has then
-   *  we want to adjust the watchdogs->Chain to indicate this.
+   *  we want to adjust the watchdogs->Header to indicate this.
    */
   if ( snapshot > last_snapshot ) {
     /*
@@ -267,7 +273,7 @@ static void _Timer_server_Process_tod_watchdogs(
      *  TOD has been set forward.
      */
     delta = snapshot - last_snapshot;
-    _Watchdog_Adjust_to_chain( &watchdogs->Chain, delta, fire_chain );
+    _Watchdog_Adjust_to_chain( &watchdogs->Header, delta, fire_chain );
 
   } else if ( snapshot < last_snapshot ) {
      /*
@@ -275,7 +281,7 @@ static void _Timer_server_Process_tod_watchdogs(
       *  TOD has been set backwards.
       */
      delta = last_snapshot - snapshot;
-     _Watchdog_Adjust( &watchdogs->Chain, WATCHDOG_BACKWARD, delta );
+     _Watchdog_Adjust( &watchdogs->Header, WATCHDOG_BACKWARD, delta );
   }
 
   watchdogs->last_snapshot = snapshot;
@@ -447,60 +453,57 @@ static rtems_task _Timer_server_Body(
 }
 
 /**
- *  @brief rtems_timer_initiate_server
- *
- *  This directive creates and starts the server for task-based timers.
- *  It must be invoked before any task-based timers can be initiated.
+ *  @brief Returns true if the timer server may be bound to the processor.
+ */
+static bool _Timer_server_Is_processor_valid( uint32_t processor )
+{
+  if ( processor == RTEMS_TIMER_SERVER_ANY_PROCESSOR )
+    return true;
+
+#if !defined( RTEMS_SMP ) || !defined( __RTEMS_HAVE_SYS_CPUSET_H__ )
+  /*
+   *  Without processor affinity support the timer server can only be bound
+   *  to the one and only processor.
+   */
+  if ( rtems_smp_get_processor_count() != 1 )
+    return false;
+#endif
+
+  return processor < rtems_smp_get_processor_count();
+}
+
+/**
+ *  @brief Creates and starts a timer server.
  *
+ *  @param[in] ts is the timer server control block
+ *  @param[in] name is the name of the timer server task
  *  @param[in] priority is the timer server priority
  *  @param[in] stack_size is the stack size in bytes
+ *  @param[in] mode is the initial mode of the timer server task
  *  @param[in] attribute_set is the timer server attributes
+ *  @param[in] processor is the processor of the timer server
+ *  @param[out] id is the identifier of the timer server task
  *
  *  @return This method returns RTEMS_SUCCESSFUL if successful and an
  *          error code otherwise.
  */
-rtems_status_code rtems_timer_initiate_server(
-  uint32_t             priority,
-  uint32_t             stack_size,
-  rtems_attribute      attribute_set
+static rtems_status_code _Timer_server_Initiate(
+  Timer_server_Control *ts,
+  rtems_name            name,
+  rtems_task_priority   priority,
+  uint32_t              stack_size,
+  rtems_mode            mode,
+  rtems_attribute       attribute_set,
+  uint32_t              processor,
+  rtems_id             *id
 )
 {
-  rtems_id              id;
-  rtems_status_code     status;
-  rtems_task_priority   _priority;
-  static bool           initialized = false;
-  bool                  tmpInitialized;
-  Timer_server_Control *ts = &_Timer_server_Default;
-
-  /*
-   *  Make sure the requested priority is valid.  The if is
-   *  structured so we check it is invalid before looking for
-   *  a specific invalid value as the default.
-   */
-  _priority = priority;
-  if ( !_RTEMS_tasks_Priority_is_valid( priority ) ) {
-    if ( priority != RTEMS_TIMER_SERVER_DEFAULT_PRIORITY )
-      return RTEMS_INVALID_PRIORITY;
-    _priority = 0;
-  }
-
-  /*
-   *  Just to make sure this is only called once.
-   */
-  _Thread_Disable_dispatch();
-    tmpInitialized  = initialized;
-    initialized = true;
-  _Thread_Enable_dispatch();
-
-  if ( tmpInitialized )
-    return RTEMS_INCORRECT_STATE;
+  rtems_status_code status;
 
   /*
-   *  Create the Timer Server with the name the name of "TIME".  The attribute
-   *  RTEMS_SYSTEM_TASK allows us to set a priority to 0 which will makes it
-   *  higher than any other task in the system.  It can be viewed as a low
-   *  priority interrupt.  It is also always NO_PREEMPT so it looks like
-   *  an interrupt to other tasks.
+   *  The attribute RTEMS_SYSTEM_TASK allows us to set a priority to 0 which
+   *  will makes it higher than any other task in the system.  It can be
+   *  viewed as a low priority interrupt.
    *
    *  We allow the user to override the default priority because the Timer
    *  Server can invoke TSRs which must adhere to language run-time or
@@ -510,19 +513,34 @@ rtems_status_code rtems_timer_initiate_server(
    *  GNAT run-time is violated.
    */
   status = rtems_task_create(
-    _Objects_Build_name('T','I','M','E'),           /* "TIME" */
-    _priority,            /* create with priority 1 since 0 is illegal */
+    name,
+    priority,
     stack_size,           /* let user specify stack size */
-    RTEMS_NO_PREEMPT,     /* no preempt is like an interrupt */
+    mode,
                           /* user may want floating point but we need */
                           /*   system task specified for 0 priority */
     attribute_set | RTEMS_SYSTEM_TASK,
-    &id                   /* get the id back */
+    id                    /* get the id back */
   );
-  if (status) {
-    initialized = false;
+  if (status)
     return status;
+
+#if defined( RTEMS_SMP ) && defined( __RTEMS_HAVE_SYS_CPUSET_H__ )
+  if ( processor != RTEMS_TIMER_SERVER_ANY_PROCESSOR ) {
+    cpu_set_t cpuset;
+
+    CPU_ZERO( &cpuset );
+    CPU_SET( (int) processor, &cpuset );
+
+    status = rtems_task_set_affinity( *id, sizeof( cpuset ), &cpuset );
+    if (status) {
+      rtems_task_delete( *id );
+      return status;
+    }
   }
+#else
+  (void) processor;
+#endif
 
   /*
    *  Do all the data structure initialization before starting the
@@ -535,14 +553,14 @@ rtems_status_code rtems_timer_initiate_server(
    */
   ts->thread = (Thread_Control *)_Objects_Get_local_object(
     &_RTEMS_tasks_Information,
-    _Objects_Get_index(id)
+    _Objects_Get_index(*id)
   );
 
   /*
    *  Initialize the timer lists that the server will manage.
    */
-  _Chain_Initialize_empty( &ts->Interval_watchdogs.Chain );
-  _Chain_Initialize_empty( &ts->TOD_watchdogs.Chain );
+  _Watchdog_Header_initialize( &ts->Interval_watchdogs.Header );
+  _Watchdog_Header_initialize( &ts->TOD_watchdogs.Header );
 
   /*
    *  Initialize the timers that will be used to control when the
@@ -551,13 +569,13 @@ rtems_status_code rtems_timer_initiate_server(
   _Watchdog_Initialize(
     &ts->Interval_watchdogs.System_watchdog,
     _Thread_Delay_ended,
-    id,
+    *id,
     NULL
   );
   _Watchdog_Initialize(
     &ts->TOD_watchdogs.System_watchdog,
     _Thread_Delay_ended,
-    id,
+    *id,
     NULL
   );
 
@@ -573,32 +591,204 @@ rtems_status_code rtems_timer_initiate_server(
   ts->insert_chain = NULL;
   ts->active = false;
 
-  /*
-   * The default timer server is now available.
-   */
-  _Timer_server = ts;
-
   /*
    *  Start the timer server
    */
   status = rtems_task_start(
-    id,
+    *id,
     _Timer_server_Body,
     (rtems_task_argument) ts
   );
 
-  #if defined(RTEMS_DEBUG)
-    /*
-     *  One would expect a call to rtems_task_delete() here to clean up
-     *  but there is actually no way (in normal circumstances) that the
-     *  start can fail.  The id and starting address are known to be
-     *  be good.  If this service fails, something is weirdly wrong on the
-     *  target such as a stray write in an ISR or incorrect memory layout.
-     */
-    if (status) {
-      initialized = false;
+  /*
+   *  One would expect a call to rtems_task_delete() here to clean up
+   *  but there is actually no way (in normal circumstances) that the
+   *  start can fail.  The id and starting address are known to be
+   *  be good.  If this service fails, something is weirdly wrong on the
+   *  target such as a stray write in an ISR or incorrect memory layout.
+   */
+  if (status)
+    return status;
+
+  /*
+   *  The timer server is now available for _Timer_server_Get().
+   */
+  _Thread_Disable_dispatch();
+    _Chain_Append_unprotected( &_Timer_server_Chain, &ts->Node );
+  _Thread_Enable_dispatch();
+
+  return status;
+}
+
+/**
+ *  @brief Returns the valid timer server priority for the requested one.
+ */
+static bool _Timer_server_Get_priority(
+  uint32_t             priority,
+  rtems_task_priority *_priority
+)
+{
+  /*
+   *  Make sure the requested priority is valid.  The if is
+   *  structured so we check it is invalid before looking for
+   *  a specific invalid value as the default.
+   */
+  *_priority = priority;
+  if ( !_RTEMS_tasks_Priority_is_valid( priority ) ) {
+    if ( priority != RTEMS_TIMER_SERVER_DEFAULT_PRIORITY )
+      return false;
+    *_priority = 0;
+  }
+
+  return true;
+}
+
+Timer_server_Control *_Timer_server_Get( Objects_Id server_id )
+{
+  Timer_server_Control *ts = NULL;
+  Chain_Node           *node;
+
+  _Thread_Disable_dispatch();
+
+  for (
+    node = _Chain_First( &_Timer_server_Chain ) ;
+    !_Chain_Is_tail( &_Timer_server_Chain, node ) ;
+    node = _Chain_Next( node )
+  ) {
+    Timer_server_Control *candidate = (Timer_server_Control *) node;
+
+    if ( candidate->thread->Object.id == server_id ) {
+      ts = candidate;
+      break;
     }
-  #endif
+  }
+
+  _Thread_Enable_dispatch();
+
+  return ts;
+}
+
+/**
+ *  @brief rtems_timer_initiate_server
+ *
+ *  This directive creates and starts the server for task-based timers.
+ *  It must be invoked before any task-based timers can be initiated.
+ *
+ *  @param[in] priority is the timer server priority
+ *  @param[in] stack_size is the stack size in bytes
+ *  @param[in] attribute_set is the timer server attributes
+ *
+ *  @return This method returns RTEMS_SUCCESSFUL if successful and an
+ *          error code otherwise.
+ */
+rtems_status_code rtems_timer_initiate_server(
+  uint32_t             priority,
+  uint32_t             stack_size,
+  rtems_attribute      attribute_set
+)
+{
+  rtems_id              id;
+  rtems_status_code     status;
+  rtems_task_priority   _priority;
+  static bool           initialized = false;
+  bool                  tmpInitialized;
+  Timer_server_Control *ts = &_Timer_server_Default;
+
+  if ( !_Timer_server_Get_priority( priority, &_priority ) )
+    return RTEMS_INVALID_PRIORITY;
+
+  /*
+   *  Just to make sure this is only called once.
+   */
+  _Thread_Disable_dispatch();
+    tmpInitialized  = initialized;
+    initialized = true;
+  _Thread_Enable_dispatch();
+
+  if ( tmpInitialized )
+    return RTEMS_INCORRECT_STATE;
+
+  /*
+   *  Create the Timer Server with the name the name of "TIME".  It is
+   *  always NO_PREEMPT so it looks like an interrupt to other tasks.
+   */
+  status = _Timer_server_Initiate(
+    ts,
+    _Objects_Build_name('T','I','M','E'),           /* "TIME" */
+    _priority,
+    stack_size,
+    RTEMS_NO_PREEMPT,     /* no preempt is like an interrupt */
+    attribute_set,
+    RTEMS_TIMER_SERVER_ANY_PROCESSOR,
+    &id
+  );
+  if (status) {
+    initialized = false;
+    return status;
+  }
+
+  /*
+   * The default timer server is now available.
+   */
+  _Timer_server = ts;
+
+  return status;
+}
+
+/**
+ *  @brief rtems_timer_create_server
+ *
+ *  This directive creates and starts an additional server for task-based
+ *  timers.  The additional timer servers are preemptible, so that a timer
+ *  server with a higher priority can execute its timers while a timer
+ *  server with a lower priority executes a long-running timer service
+ *  routine.  The timer server may preempt a timer server critical section
+ *  only in the same way as an interrupt does.
+ */
+rtems_status_code rtems_timer_create_server(
+  rtems_name       name,
+  uint32_t         priority,
+  uint32_t         stack_size,
+  rtems_attribute  attribute_set,
+  uint32_t         processor,
+  rtems_id        *server_id
+)
+{
+  rtems_status_code     status;
+  rtems_task_priority   _priority;
+  Timer_server_Control *ts;
+
+  if ( !server_id )
+    return RTEMS_INVALID_ADDRESS;
+
+  if ( !_Timer_server_Get_priority( priority, &_priority ) )
+    return RTEMS_INVALID_PRIORITY;
+
+  if ( !_Timer_server_Is_processor_valid( processor ) )
+    return RTEMS_INVALID_NUMBER;
+
+  _Thread_Disable_dispatch();
+    ts = _Workspace_Allocate( sizeof( *ts ) );
+  _Thread_Enable_dispatch();
+
+  if ( ts == NULL )
+    return RTEMS_NO_MEMORY;
+
+  status = _Timer_server_Initiate(
+    ts,
+    name,
+    _priority,
+    stack_size,
+    RTEMS_PREEMPT,
+    attribute_set,
+    processor,
+    server_id
+  );
+  if (status) {
+    _Thread_Disable_dispatch();
+      _Workspace_Free( ts );
+    _Thread_Enable_dispatch();
+  }
 
   return status;
 }
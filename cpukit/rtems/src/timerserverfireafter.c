@@ -25,9 +25,10 @@
 #include <rtems/rtems/timerimpl.h>
 #include <rtems/score/watchdogimpl.h>
 
-rtems_status_code rtems_timer_server_fire_after(
-  rtems_id                           id,
-  rtems_interval                     ticks,
+rtems_status_code _Timer_server_Fire_after(
+  Timer_server_Control              *timer_server,
+  Objects_Id                         id,
+  Watchdog_Interval                  ticks,
   rtems_timer_service_routine_entry  routine,
   void                              *user_data
 )
@@ -35,7 +36,6 @@ rtems_status_code rtems_timer_server_fire_after(
   Timer_Control        *the_timer;
   Objects_Locations     location;
   ISR_Level             level;
-  Timer_server_Control *timer_server = _Timer_server;
 
   if ( !timer_server )
     return RTEMS_INCORRECT_STATE;
@@ -71,6 +71,7 @@ rtems_status_code rtems_timer_server_fire_after(
          */
 
         the_timer->the_class = TIMER_INTERVAL_ON_TASK;
+        the_timer->server = timer_server;
         _Watchdog_Initialize( &the_timer->Ticker, routine, id, user_data );
         the_timer->Ticker.initial = ticks;
       _ISR_Enable( level );
@@ -89,3 +90,19 @@ rtems_status_code rtems_timer_server_fire_after(
 
   return RTEMS_INVALID_ID;
 }
+
+rtems_status_code rtems_timer_server_fire_after(
+  rtems_id                           id,
+  rtems_interval                     ticks,
+  rtems_timer_service_routine_entry  routine,
+  void                              *user_data
+)
+{
+  return _Timer_server_Fire_after(
+    _Timer_server,
+    id,
+    ticks,
+    routine,
+    user_data
+  );
+}
@@ -0,0 +1,38 @@
+/**
+ *  @file
+ *
+ *  @brief RTEMS Timer Server Fire After On
+ *  @ingroup ClassicTimer
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/timerimpl.h>
+
+rtems_status_code rtems_timer_server_fire_after_on(
+  rtems_id                           server_id,
+  rtems_id                           id,
+  rtems_interval                     ticks,
+  rtems_timer_service_routine_entry  routine,
+  void                              *user_data
+)
+{
+  return _Timer_server_Fire_after(
+    _Timer_server_Get( server_id ),
+    id,
+    ticks,
+    routine,
+    user_data
+  );
+}
@@ -40,9 +40,10 @@
  *    error code       - if unsuccessful
  */
 
-rtems_status_code rtems_timer_server_fire_when(
-  rtems_id                           id,
-  rtems_time_of_day                  *wall_time,
+rtems_status_code _Timer_server_Fire_when(
+  Timer_server_Control              *timer_server,
+  Objects_Id                         id,
+  rtems_time_of_day                 *wall_time,
   rtems_timer_service_routine_entry  routine,
   void                              *user_data
 )
@@ -50,7 +51,6 @@ rtems_status_code rtems_timer_server_fire_when(
   Timer_Control        *the_timer;
   Objects_Locations     location;
   rtems_interval        seconds;
-  Timer_server_Control *timer_server = _Timer_server;
 
   if ( !timer_server )
     return RTEMS_INCORRECT_STATE;
@@ -74,6 +74,7 @@ rtems_status_code rtems_timer_server_fire_when(
     case OBJECTS_LOCAL:
       (void) _Watchdog_Remove( &the_timer->Ticker );
       the_timer->the_class = TIMER_TIME_OF_DAY_ON_TASK;
+      the_timer->server = timer_server;
       _Watchdog_Initialize( &the_timer->Ticker, routine, id, user_data );
       the_timer->Ticker.initial = seconds - _TOD_Seconds_since_epoch();
 
@@ -91,3 +92,19 @@ rtems_status_code rtems_timer_server_fire_when(
 
   return RTEMS_INVALID_ID;
 }
+
+rtems_status_code rtems_timer_server_fire_when(
+  rtems_id                           id,
+  rtems_time_of_day                  *wall_time,
+  rtems_timer_service_routine_entry  routine,
+  void                              *user_data
+)
+{
+  return _Timer_server_Fire_when(
+    _Timer_server,
+    id,
+    wall_time,
+    routine,
+    user_data
+  );
+}
@@ -211,6 +211,21 @@ const rtems_libio_helper rtems_fs_init_helper =
       #error "CONFIGURE_SMP_MAXIMUM_PROCESSORS not specified for SMP Application"
     #endif
   #endif
+
+  /*
+   *  The Deterministic Priority SMP Scheduler may partition the processors
+   *  into clusters.  CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT defines the count
+   *  of clusters and CONFIGURE_SMP_SCHEDULER_CLUSTER_OF_PROCESSOR is an
+   *  initializer for the table of the cluster index of each processor, e.g.
+   *  { 0, 0, 1, 1 }.  By default there is one cluster with all processors.
+   */
+  #if !defined(CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT)
+    #define CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT 1
+  #endif
+
+  #if !defined(CONFIGURE_SMP_SCHEDULER_CLUSTER_OF_PROCESSOR)
+    #define CONFIGURE_SMP_SCHEDULER_CLUSTER_OF_PROCESSOR { 0 }
+  #endif
 #endif
 
 /*
@@ -607,6 +622,8 @@ const rtems_libio_helper rtems_fs_init_helper =
  *  CONFIGURE_SCHEDULER_USER       - user provided scheduler
  *  CONFIGURE_SCHEDULER_PRIORITY   - Deterministic Priority Scheduler
  *  CONFIGURE_SCHEDULER_PRIORITY_SMP - Deterministic Priority SMP Scheduler
+ *  CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP - Deterministic Priority SMP
+ *                                 Scheduler with processor affinity support
  *  CONFIGURE_SCHEDULER_SIMPLE     - Light-weight Priority Scheduler
  *  CONFIGURE_SCHEDULER_SIMPLE_SMP - Simple SMP Priority Scheduler
  *  CONFIGURE_SCHEDULER_EDF        - EDF Scheduler
@@ -627,10 +644,15 @@ const rtems_libio_helper rtems_fs_init_helper =
   #undef CONFIGURE_SCHEDULER_SIMPLE_SMP
 #endif
 
+#if !defined(RTEMS_SMP) || !defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+  #undef CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP
+#endif
+
 /* If no scheduler is specified, the priority scheduler is default. */
 #if !defined(CONFIGURE_SCHEDULER_USER) && \
     !defined(CONFIGURE_SCHEDULER_PRIORITY) && \
     !defined(CONFIGURE_SCHEDULER_PRIORITY_SMP) && \
+    !defined(CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP) && \
     !defined(CONFIGURE_SCHEDULER_SIMPLE) && \
     !defined(CONFIGURE_SCHEDULER_SIMPLE_SMP) && \
     !defined(CONFIGURE_SCHEDULER_EDF) && \
@@ -642,6 +664,11 @@ const rtems_libio_helper rtems_fs_init_helper =
   #endif
 #endif
 
+#if defined(RTEMS_SMP) && CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT > 1 && \
+    !defined(CONFIGURE_SCHEDULER_PRIORITY_SMP)
+  #error "Processor clusters require CONFIGURE_SCHEDULER_PRIORITY_SMP"
+#endif
+
 /*
  * If the Priority Scheduler is selected, then configure for it.
  */
@@ -673,11 +700,39 @@ const rtems_libio_helper rtems_fs_init_helper =
    */
   #define CONFIGURE_MEMORY_FOR_SCHEDULER ( \
     _Configure_From_workspace( \
-      sizeof(Scheduler_SMP_Control) +  \
+      sizeof(Scheduler_priority_SMP_Control) + \
+      ((CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT - 1) * \
+        sizeof(Scheduler_priority_SMP_Cluster *)) ) + \
+    CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT * _Configure_From_workspace( \
+      sizeof(Scheduler_priority_SMP_Cluster) +  \
       ((CONFIGURE_MAXIMUM_PRIORITY) * sizeof(Chain_Control)) ) \
   )
   #define CONFIGURE_MEMORY_PER_TASK_FOR_SCHEDULER ( \
-    _Configure_From_workspace(sizeof(Scheduler_priority_Per_thread)) )
+    _Configure_From_workspace(sizeof(Scheduler_priority_SMP_Per_thread)) )
+#endif
+
+/*
+ * If the Deterministic Priority Affinity SMP Scheduler is selected, then
+ * configure for it.
+ */
+#if defined(CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP)
+  #include <rtems/score/schedulerpriorityaffinitysmp.h>
+  #define CONFIGURE_SCHEDULER_ENTRY_POINTS \
+    SCHEDULER_PRIORITY_AFFINITY_SMP_ENTRY_POINTS
+
+  /**
+   * This defines the memory used by the priority affinity scheduler.
+   */
+  #define CONFIGURE_MEMORY_FOR_SCHEDULER ( \
+    _Configure_From_workspace( \
+      sizeof(Scheduler_priority_affinity_SMP_Control) + \
+      ((CONFIGURE_MAXIMUM_PRIORITY) * sizeof(Chain_Control)) ) + \
+    _Configure_From_workspace( \
+      CONFIGURE_SMP_MAXIMUM_PROCESSORS * sizeof(Thread_Control *) ) \
+  )
+  #define CONFIGURE_MEMORY_PER_TASK_FOR_SCHEDULER ( \
+    _Configure_From_workspace( \
+      sizeof(Scheduler_priority_affinity_SMP_Per_thread)) )
 #endif
 
 /*
@@ -924,6 +979,24 @@ const rtems_libio_helper rtems_fs_init_helper =
     #endif
 #endif
 
+#ifdef CONFIGURE_INIT
+  /**
+   * This configures the per-CPU malloc caches.  Each processor caches small
+   * objects in front of the C program heap.  By default no caches are used.
+   */
+  #ifdef CONFIGURE_MALLOC_PER_CPU_CACHES
+    #if defined(RTEMS_SMP)
+      rtems_malloc_cache Malloc_caches[ CONFIGURE_SMP_MAXIMUM_PROCESSORS ];
+    #else
+      rtems_malloc_cache Malloc_caches[ 1 ];
+    #endif
+
+    rtems_malloc_cache * const rtems_malloc_caches = &Malloc_caches[ 0 ];
+  #else
+    rtems_malloc_cache * const rtems_malloc_caches = NULL;
+  #endif
+#endif
+
 #ifdef CONFIGURE_INIT
   /**
    * This configures the sbrk() support for the malloc family.
@@ -2179,14 +2252,35 @@ const rtems_libio_helper rtems_fs_init_helper =
   )
 
 #if defined(RTEMS_SMP)
+  #if defined(RTEMS_ATOMIC)
+    #include <rtems/score/smpjob.h>
+
+    #define CONFIGURE_MEMORY_FOR_SMP_JOB_QUEUE \
+      _Configure_From_workspace( sizeof( SMP_Job_queue ) )
+  #else
+    #define CONFIGURE_MEMORY_FOR_SMP_JOB_QUEUE 0
+  #endif
+
   #define CONFIGURE_MEMORY_FOR_SMP \
      (CONFIGURE_SMP_MAXIMUM_PROCESSORS * \
-      _Configure_From_workspace( CONFIGURE_INTERRUPT_STACK_SIZE ) \
+      (_Configure_From_workspace( CONFIGURE_INTERRUPT_STACK_SIZE ) + \
+       CONFIGURE_MEMORY_FOR_SMP_JOB_QUEUE) \
      )
 #else
   #define CONFIGURE_MEMORY_FOR_SMP 0
 #endif
 
+/**
+ * This macro reserves the memory required by the free lists of the
+ * segregated fit allocation mode of the RTEMS Workspace.
+ */
+#ifdef CONFIGURE_SEGREGATED_FIT_HEAPS
+  #define CONFIGURE_MEMORY_FOR_SEGREGATED_FIT_HEAPS \
+    _Configure_From_workspace( sizeof( Heap_Segregated_fit ) )
+#else
+  #define CONFIGURE_MEMORY_FOR_SEGREGATED_FIT_HEAPS 0
+#endif
+
 /**
  * This calculates the memory required for the executive workspace.
  */
@@ -2200,6 +2294,7 @@ const rtems_libio_helper rtems_fs_init_helper =
    CONFIGURE_MEMORY_FOR_STATIC_EXTENSIONS + \
    CONFIGURE_MEMORY_FOR_MP + \
    CONFIGURE_MEMORY_FOR_SMP + \
+   CONFIGURE_MEMORY_FOR_SEGREGATED_FIT_HEAPS + \
    CONFIGURE_MESSAGE_BUFFER_MEMORY + \
    (CONFIGURE_MEMORY_OVERHEAD * 1024) \
 ) & ~0x7)
@@ -2365,6 +2460,15 @@ const rtems_libio_helper rtems_fs_init_helper =
    */
   uint8_t rtems_maximum_priority = CONFIGURE_MAXIMUM_PRIORITY;
 
+  #ifdef RTEMS_SMP
+    /**
+     * This table specifies the processor cluster index of each processor.
+     */
+    const uint32_t Configuration_Scheduler_cluster_of_processor[
+      CONFIGURE_SMP_MAXIMUM_PROCESSORS
+    ] = CONFIGURE_SMP_SCHEDULER_CLUSTER_OF_PROCESSOR;
+  #endif
+
   /**
    * This is the primary Configuration Table for this application.
    */
@@ -2394,6 +2498,12 @@ const rtems_libio_helper rtems_fs_init_helper =
     #else
       false,
     #endif
+    #ifdef CONFIGURE_SEGREGATED_FIT_HEAPS     /* true for segregated fit
+                                                 heaps */
+      true,
+    #else
+      false,
+    #endif
     #ifdef RTEMS_SMP
       #ifdef CONFIGURE_SMP_APPLICATION
         true,
@@ -2410,7 +2520,9 @@ const rtems_libio_helper rtems_fs_init_helper =
       CONFIGURE_MULTIPROCESSING_TABLE,        /* pointer to MP config table */
     #endif
     #ifdef RTEMS_SMP
-      CONFIGURE_SMP_MAXIMUM_PROCESSORS
+      CONFIGURE_SMP_MAXIMUM_PROCESSORS,
+      CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT,  /* processor cluster count */
+      Configuration_Scheduler_cluster_of_processor /* cluster of processor */
     #endif
   };
 #endif
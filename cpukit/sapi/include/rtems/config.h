@@ -222,6 +222,17 @@ typedef struct {
    */
   bool                           stack_allocator_avoids_work_space;
 
+  /**
+   * @brief Specifies if the RTEMS Workspace and the C Program Heap use the
+   * segregated fit allocation mode.
+   *
+   * If this element is @a true, then the heaps use the segregated fit
+   * allocation mode, otherwise they use the first fit allocation mode.  The
+   * segregated fit allocation finds a suitable free list in constant time,
+   * but may fall back to a linear search of the free blocks.
+   */
+  bool                           segregated_fit_heaps;
+
   #ifdef RTEMS_SMP
     bool                         smp_enabled;
   #endif
@@ -236,6 +247,19 @@ typedef struct {
   #endif
   #ifdef RTEMS_SMP
     uint32_t                     maximum_processors;
+
+    /**
+     * @brief The count of processor clusters of the scheduler.
+     */
+    uint32_t                     scheduler_cluster_count;
+
+    /**
+     * @brief The processor cluster index of each processor.
+     *
+     * The table has an entry for each of the configured maximum count of
+     * processors.
+     */
+    const uint32_t              *scheduler_cluster_of_processor;
   #endif
 } rtems_configuration_table;
 
@@ -273,6 +297,9 @@ extern const rtems_configuration_table Configuration;
 #define rtems_configuration_get_stack_allocator_avoids_work_space() \
         (Configuration.stack_allocator_avoids_work_space)
 
+#define rtems_configuration_get_segregated_fit_heaps() \
+        (Configuration.segregated_fit_heaps)
+
 #define rtems_configuration_get_stack_space_size() \
         (Configuration.stack_space_size)
 
@@ -379,6 +406,40 @@ extern const rtems_configuration_table Configuration;
         1
 #endif
 
+/**
+ * @brief Returns the configured count of processor clusters of the scheduler.
+ *
+ * On single-processor configurations this is a compile time constant which
+ * evaluates to one.
+ *
+ * @return The configured count of processor clusters.
+ */
+#ifdef RTEMS_SMP
+  #define rtems_configuration_get_scheduler_cluster_count() \
+        (Configuration.scheduler_cluster_count)
+#else
+  #define rtems_configuration_get_scheduler_cluster_count() \
+        1
+#endif
+
+/**
+ * @brief Returns the configured processor cluster index of a processor.
+ *
+ * On single-processor configurations this is a compile time constant which
+ * evaluates to zero.
+ *
+ * @param[in] cpu_index The index of the processor.
+ *
+ * @return The processor cluster index of the processor.
+ */
+#ifdef RTEMS_SMP
+  #define rtems_configuration_get_scheduler_cluster_of_processor( cpu_index ) \
+        (Configuration.scheduler_cluster_of_processor[ cpu_index ])
+#else
+  #define rtems_configuration_get_scheduler_cluster_of_processor( cpu_index ) \
+        0
+#endif
+
 #define rtems_configuration_get_rtems_api_configuration() \
         (&Configuration_RTEMS_API)
 
@@ -51,7 +51,8 @@ static const char *const internal_error_desc [] = {
   "INTERNAL_ERROR_GXX_KEY_ADD_FAILED",
   "INTERNAL_ERROR_GXX_MUTEX_INIT_FAILED",
   "INTERNAL_ERROR_NO_MEMORY_FOR_HEAP",
-  "INTERNAL_ERROR_CPU_ISR_INSTALL_VECTOR"
+  "INTERNAL_ERROR_CPU_ISR_INSTALL_VECTOR",
+  "INTERNAL_ERROR_SCHEDULER_INVALID_CLUSTER"
 };
 
 const char *rtems_internal_error_description( rtems_fatal_code error )
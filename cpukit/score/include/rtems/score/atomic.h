@@ -288,6 +288,19 @@ static inline bool _Atomic_Compare_exchange_ptr(
     order_succ, order_fail );
 }
 
+/**
+ * @brief Establishes a memory synchronization ordering without an
+ * associated atomic operation.
+ *
+ * @param[in] order The atomic memory order.
+ */
+static inline void _Atomic_Fence(
+  Atomic_Order order
+)
+{
+  _CPU_atomic_Fence( order );
+}
+
 /**
  * @brief Atomically clears an atomic flag.
  *
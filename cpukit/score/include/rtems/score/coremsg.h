@@ -46,6 +46,29 @@ extern "C" {
   #define RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY
 #endif
 
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+  /**
+   *  This is the highest message priority with an own message priority
+   *  group.  It covers the POSIX message priorities up to MQ_PRIO_MAX.
+   */
+  #define CORE_MESSAGE_QUEUE_PRIORITY_MAXIMUM 32
+
+  /**
+   *  This is the count of message priority groups.  Group zero contains the
+   *  urgent messages, the other groups contain the messages of the message
+   *  priorities up to and including
+   *  @ref CORE_MESSAGE_QUEUE_PRIORITY_MAXIMUM.
+   */
+  #define CORE_MESSAGE_QUEUE_PRIORITY_GROUP_COUNT \
+    ( CORE_MESSAGE_QUEUE_PRIORITY_MAXIMUM + 2 )
+
+  /**
+   *  This is the count of words of the message priority group bit map.
+   */
+  #define CORE_MESSAGE_QUEUE_PRIORITY_MAP_SIZE \
+    ( ( CORE_MESSAGE_QUEUE_PRIORITY_GROUP_COUNT + 31 ) / 32 )
+#endif
+
 #if defined(RTEMS_POSIX_API)
   /**
    *  This macro is defined when an API is enabled that requires that the
@@ -161,6 +184,21 @@ typedef struct {
    *  message priority or in FIFO order.
    */
   Chain_Control                      Pending_messages;
+  #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    /** This is the bit map of the non-empty message priority groups.  The
+     *  pending messages of a group are contiguous in the pending messages
+     *  chain.
+     */
+    uint32_t                           priority_map[
+      CORE_MESSAGE_QUEUE_PRIORITY_MAP_SIZE
+    ];
+    /** This is the last pending message of each non-empty message priority
+     *  group.  It is the insert position for the next message of the group.
+     */
+    CORE_message_queue_Buffer_control *priority_group_last[
+      CORE_MESSAGE_QUEUE_PRIORITY_GROUP_COUNT
+    ];
+  #endif
   /** This is the address of the memory allocated for message buffers.
    *  It is allocated are part of message queue initialization and freed
    *  as part of destroying it.
@@ -24,6 +24,7 @@
 #include <rtems/score/threadqimpl.h>
 
 #include <limits.h>
+#include <stddef.h>
 #include <string.h>
 
 #ifdef __cplusplus
@@ -303,7 +304,7 @@ CORE_message_queue_Status _CORE_message_queue_Submit(
  *  @param[in] id is the RTEMS object Id associated with this message queue.
  *         It is used when unblocking a remote thread.
  *  @param[in] buffer is the starting address of the message buffer to
- *         to be filled in with a message
+ *         to be filled in with a message.  It must not be NULL.
  *  @param[in] size_p is a pointer to the size of the @a buffer and
  *         indicates the maximum size message that the caller can receive.
  *  @param[in] wait indicates whether the calling thread is willing to block
@@ -352,6 +353,87 @@ void _CORE_message_queue_Insert_message(
   CORE_message_queue_Submit_types    submit_type
 );
 
+/**
+ *  @brief Submit a message buffer to the message queue.
+ *
+ *  This routine implements the zero-copy send.  The message is already
+ *  contained in a message buffer of the message queue which was obtained
+ *  by _CORE_message_queue_Allocate_message_buffer() and filled in by the
+ *  caller.  The ownership of the message buffer passes to the message queue.
+ *  A thread waiting in _CORE_message_queue_Seize_buffer() receives the
+ *  message buffer itself.  A thread waiting in _CORE_message_queue_Seize()
+ *  receives a copy of the message and the message buffer is freed.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] the_message is the message buffer to submit
+ *  @param[in] size is the size of the message being send
+ *  @param[in] id is the RTEMS object Id associated with this message queue.
+ *         It is used when unblocking a remote thread.
+ *  @param[in] api_message_queue_mp_support is the routine to invoke if
+ *         a thread that is unblocked is actually a remote thread.
+ *  @param[in] submit_type determines whether the message is prepended,
+ *         appended, or enqueued in priority order.
+ *  @retval indication of the successful completion or reason for failure
+ *
+ *  @note In case of an error the caller still owns the message buffer.
+ */
+CORE_message_queue_Status _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control                *the_message_queue,
+  CORE_message_queue_Buffer_control         *the_message,
+  size_t                                     size,
+  Objects_Id                                 id,
+  CORE_message_queue_API_mp_support_callout  api_message_queue_mp_support,
+  CORE_message_queue_Submit_types            submit_type
+);
+
+/**
+ *  @brief Seize a message buffer from the message queue.
+ *
+ *  This kernel routine dequeues a message and returns the message buffer
+ *  itself instead of a copy of the message.  The ownership of the message
+ *  buffer passes to the caller which must hand it back with
+ *  _CORE_message_queue_Release_buffer() or
+ *  _CORE_message_queue_Submit_buffer().  The thread will be blocked if wait
+ *  is true, otherwise an error will be given to the thread if no messages are
+ *  available.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] executing is the executing thread.
+ *  @param[in] id is the RTEMS object Id associated with this message queue.
+ *  @param[out] the_message_p points to the variable that will contain the
+ *         received message buffer.
+ *  @param[in] wait indicates whether the calling thread is willing to block
+ *         if the message queue is empty.
+ *  @param[in] timeout is the maximum number of clock ticks that the calling
+ *         thread is willing to block if the message queue is empty.
+ *
+ *  @note Returns message priority via return area in TCB.
+ */
+void _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control         *the_message_queue,
+  Thread_Control                     *executing,
+  Objects_Id                          id,
+  CORE_message_queue_Buffer_control **the_message_p,
+  bool                                wait,
+  Watchdog_Interval                   timeout
+);
+
+/**
+ *  @brief Release a message buffer to the message queue.
+ *
+ *  This routine hands back a message buffer owned by the caller.  In case a
+ *  thread is blocked sending to the message queue, then the message buffer
+ *  is used for its message, otherwise it is freed to the inactive message
+ *  pool.
+ *
+ *  @param[in] the_message_queue points to the message queue
+ *  @param[in] the_message is the message buffer to release
+ */
+void _CORE_message_queue_Release_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message
+);
+
 /**
  * This routine sends a message to the end of the specified message queue.
  */
@@ -442,6 +524,84 @@ RTEMS_INLINE_ROUTINE void _CORE_message_queue_Free_message_buffer (
   _Chain_Append( &the_message_queue->Inactive_messages, &the_message->Node );
 }
 
+/**
+ * This routine marks @a the_message as owned by the application.  A message
+ * buffer owned by the application is on neither the inactive nor the
+ * pending message chain.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_message_queue_Set_buffer_owned (
+  CORE_message_queue_Buffer_control *the_message
+)
+{
+  _Chain_Set_off_chain( &the_message->Node );
+}
+
+/**
+ * This function returns the message buffer containing the message area
+ * @a buffer of @a the_message_queue.  It returns NULL if @a buffer is not
+ * the message area of a message buffer of @a the_message_queue or if the
+ * message buffer is not owned by the application, e.g. because it was
+ * already released or sent.
+ */
+RTEMS_INLINE_ROUTINE CORE_message_queue_Buffer_control *
+_CORE_message_queue_Get_message_buffer (
+  const CORE_message_queue_Control *the_message_queue,
+  const void                       *buffer
+)
+{
+  CORE_message_queue_Buffer_control *the_message;
+  uintptr_t                          begin;
+  uintptr_t                          offset;
+  uintptr_t                          stride;
+
+  begin = (uintptr_t) the_message_queue->message_buffers
+    + offsetof( CORE_message_queue_Buffer_control, Contents.buffer );
+  offset = (uintptr_t) buffer - begin;
+  stride = the_message_queue->maximum_message_size + sizeof( uintptr_t ) - 1;
+  stride &= ~( (uintptr_t) sizeof( uintptr_t ) - 1 );
+  stride += sizeof( CORE_message_queue_Buffer_control );
+
+  if (
+    (uintptr_t) buffer < begin
+      || offset % stride != 0
+      || offset / stride >= the_message_queue->maximum_pending_messages
+  ) {
+    return NULL;
+  }
+
+  the_message = (CORE_message_queue_Buffer_control *) ( (uintptr_t) buffer
+    - offsetof( CORE_message_queue_Buffer_control, Contents.buffer ) );
+
+  if ( !_Chain_Is_node_off_chain( &the_message->Node ) ) {
+    return NULL;
+  }
+
+  return the_message;
+}
+
+/**
+ * This function returns true if @a the_thread waits in
+ * _CORE_message_queue_Seize_buffer() and false otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_message_queue_Is_buffer_receiver (
+  const Thread_Control *the_thread
+)
+{
+  return the_thread->Wait.return_argument_second.mutable_object == NULL;
+}
+
+/**
+ * This function returns true if @a the_thread is blocked in
+ * _CORE_message_queue_Submit() until a message buffer is free and false if
+ * it waits to receive a message.  A blocked sender has no return argument.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_message_queue_Is_blocked_sender (
+  const Thread_Control *the_thread
+)
+{
+  return the_thread->Wait.return_argument == NULL;
+}
+
 /**
  * This function returns the priority of @a the_message.
  *
@@ -475,6 +635,60 @@ RTEMS_INLINE_ROUTINE void _CORE_message_queue_Set_message_priority (
   #endif
 }
 
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+  /**
+   * This function returns the message priority group of @a priority.  Urgent
+   * messages belong to group zero.  Messages sent with
+   * @ref CORE_MESSAGE_QUEUE_SEND_REQUEST and messages with a priority out of
+   * the range of the groups belong to no group and this function returns
+   * @ref CORE_MESSAGE_QUEUE_PRIORITY_GROUP_COUNT for them.
+   */
+  RTEMS_INLINE_ROUTINE uint32_t _CORE_message_queue_Get_priority_group (
+    int priority
+  )
+  {
+    if ( priority == CORE_MESSAGE_QUEUE_URGENT_REQUEST )
+      return 0;
+
+    if ( priority < -CORE_MESSAGE_QUEUE_PRIORITY_MAXIMUM || priority > 0 )
+      return CORE_MESSAGE_QUEUE_PRIORITY_GROUP_COUNT;
+
+    return (uint32_t) ( priority + CORE_MESSAGE_QUEUE_PRIORITY_MAXIMUM + 1 );
+  }
+
+  /**
+   * This routine marks message priority @a group of @a the_message_queue as
+   * empty.
+   */
+  RTEMS_INLINE_ROUTINE void _CORE_message_queue_Clear_priority_group (
+    CORE_message_queue_Control *the_message_queue,
+    uint32_t                    group
+  )
+  {
+    the_message_queue->priority_map[ group / 32 ] &=
+      ~( (uint32_t) 1 << ( group % 32 ) );
+  }
+#endif
+
+/**
+ * This routine marks all message priority groups of @a the_message_queue as
+ * empty.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_message_queue_Initialize_priority_groups (
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    memset(
+      the_message_queue->priority_map,
+      0,
+      sizeof( the_message_queue->priority_map )
+    );
+  #else
+    (void) the_message_queue;
+  #endif
+}
+
 /**
  * This function removes the first message from the_message_queue
  * and returns a pointer to it.
@@ -484,8 +698,30 @@ RTEMS_INLINE_ROUTINE
   CORE_message_queue_Control *the_message_queue
 )
 {
-  return (CORE_message_queue_Buffer_control *)
+  CORE_message_queue_Buffer_control *the_message;
+
+  the_message = (CORE_message_queue_Buffer_control *)
     _Chain_Get_unprotected( &the_message_queue->Pending_messages );
+
+  #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    /*
+     *  The first message is the last message of its group only if it is
+     *  the only message of this group.
+     */
+    if ( the_message != NULL ) {
+      uint32_t group;
+
+      group = _CORE_message_queue_Get_priority_group( the_message->priority );
+      if (
+        group < CORE_MESSAGE_QUEUE_PRIORITY_GROUP_COUNT
+          && the_message_queue->priority_group_last[ group ] == the_message
+      ) {
+        _CORE_message_queue_Clear_priority_group( the_message_queue, group );
+      }
+    }
+  #endif
+
+  return the_message;
 }
 
 /**
@@ -195,6 +195,21 @@ RTEMS_INLINE_ROUTINE uint32_t  _CORE_semaphore_Get_count(
   return the_semaphore->count;
 }
 
+/**
+ * This routine releases the Giant lock acquired by _Objects_Get_isr_disable()
+ * on SMP configurations.
+ *
+ * The thread queue lock must be owned by the caller.  A delete operation
+ * owns the Giant lock and acquires the thread queue lock to close the
+ * semaphore object, so it waits until the caller is done with the semaphore.
+ */
+RTEMS_INLINE_ROUTINE void _CORE_semaphore_Release_giant( void )
+{
+#if defined(RTEMS_SMP)
+  _Thread_Unnest_dispatch();
+#endif
+}
+
 /**
  * This routine attempts to receive a unit from the_semaphore.
  * If a unit is available or if the wait flag is false, then the routine
@@ -209,6 +224,12 @@ RTEMS_INLINE_ROUTINE uint32_t  _CORE_semaphore_Get_count(
  * @param[in] level is a temporary variable used to contain the ISR
  *        disable level cookie
  *
+ * The semaphore count is protected by the thread queue lock.  On SMP
+ * configurations the caller owns the Giant lock due to
+ * _Objects_Get_isr_disable().  In case a unit is available or the thread
+ * does not wait, then the Giant lock is released once the thread queue lock
+ * is owned, so operations on different semaphores run in parallel.
+ *
  * @note There is currently no MACRO version of this routine.
  */
 RTEMS_INLINE_ROUTINE void _CORE_semaphore_Seize_isr_disable(
@@ -223,28 +244,79 @@ RTEMS_INLINE_ROUTINE void _CORE_semaphore_Seize_isr_disable(
   /* disabled when you get here */
 
   executing->Wait.return_code = CORE_SEMAPHORE_STATUS_SUCCESSFUL;
+  _ISR_lock_Acquire( &the_semaphore->Wait_queue.Lock );
   if ( the_semaphore->count != 0 ) {
     the_semaphore->count -= 1;
-    _ISR_Enable( level );
+    _CORE_semaphore_Release_giant();
+    _ISR_lock_Release_and_ISR_enable( &the_semaphore->Wait_queue.Lock, level );
     return;
   }
 
   if ( !wait ) {
-    _ISR_Enable( level );
+    _CORE_semaphore_Release_giant();
+    _ISR_lock_Release_and_ISR_enable( &the_semaphore->Wait_queue.Lock, level );
     executing->Wait.return_code = CORE_SEMAPHORE_STATUS_UNSATISFIED_NOWAIT;
     return;
   }
 
+#if !defined(RTEMS_SMP)
   _Thread_Disable_dispatch();
+#endif
   _Thread_queue_Enter_critical_section( &the_semaphore->Wait_queue );
   executing->Wait.queue          = &the_semaphore->Wait_queue;
   executing->Wait.id             = id;
-  _ISR_Enable( level );
+  _ISR_lock_Release_and_ISR_enable( &the_semaphore->Wait_queue.Lock, level );
 
   _Thread_queue_Enqueue( &the_semaphore->Wait_queue, executing, timeout );
   _Thread_Enable_dispatch();
 }
 
+/**
+ * This routine surrenders a unit to the_semaphore in case no thread waits
+ * for it.
+ *
+ * Interrupts must be disabled by the caller via _Objects_Get_isr_disable().
+ * In case no thread waits for the_semaphore and no blocking operation is in
+ * progress, then the count is updated under protection of the thread queue
+ * lock, the Giant lock is released on SMP configurations and interrupts are
+ * enabled.  Otherwise interrupts remain disabled and the caller must use
+ * _CORE_semaphore_Surrender() with thread dispatching disabled.
+ *
+ * @param[in] the_semaphore is the semaphore to surrender
+ * @param[out] status is the status of the surrender operation
+ * @param[in] level is the ISR disable level cookie
+ *
+ * @retval true The surrender operation is complete.
+ * @retval false Threads wait for the semaphore.
+ */
+RTEMS_INLINE_ROUTINE bool _CORE_semaphore_Try_surrender_isr_disable(
+  CORE_semaphore_Control  *the_semaphore,
+  CORE_semaphore_Status   *status,
+  ISR_Level                level
+)
+{
+  /* disabled when you get here */
+
+  _ISR_lock_Acquire( &the_semaphore->Wait_queue.Lock );
+
+  if ( !_Thread_queue_Is_idle( &the_semaphore->Wait_queue ) ) {
+    _ISR_lock_Release( &the_semaphore->Wait_queue.Lock );
+    return false;
+  }
+
+  if ( the_semaphore->count < the_semaphore->Attributes.maximum_count ) {
+    the_semaphore->count += 1;
+    *status = CORE_SEMAPHORE_STATUS_SUCCESSFUL;
+  } else {
+    *status = CORE_SEMAPHORE_MAXIMUM_COUNT_EXCEEDED;
+  }
+
+  _CORE_semaphore_Release_giant();
+  _ISR_lock_Release_and_ISR_enable( &the_semaphore->Wait_queue.Lock, level );
+
+  return true;
+}
+
 /** @} */
 
 #ifdef __cplusplus
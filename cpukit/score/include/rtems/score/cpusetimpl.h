@@ -0,0 +1,153 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreCpuset
+ *
+ * @brief Processor Set Implementation
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifndef _RTEMS_SCORE_CPUSETIMPL_H
+#define _RTEMS_SCORE_CPUSETIMPL_H
+
+#include <rtems/score/basedefs.h>
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+
+#include <sys/cpuset.h>
+#include <limits.h>
+
+#include <rtems/score/smp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ScoreCpuset Processor Set Handler
+ *
+ * @ingroup Score
+ *
+ * This handler provides the processor set support for the processor affinity
+ * of threads.  A processor set of a particular size in bytes may represent
+ * the processors with an index less than the size times CHAR_BIT.
+ *
+ * @{
+ */
+
+/**
+ * @brief Returns true if a processor set of the specified size can represent
+ * all online processors.
+ *
+ * @param[in] setsize The size of the processor set in bytes.
+ *
+ * @retval true The processor set is large enough.
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _CPU_set_Is_large_enough( size_t setsize )
+{
+  return _SMP_Get_processor_count() <= setsize * CHAR_BIT;
+}
+
+/**
+ * @brief Sets the processor set to the set of online processors.
+ *
+ * The processor set must be large enough to represent all online processors.
+ *
+ * @param[in] setsize The size of the processor set in bytes.
+ * @param[out] cpuset The processor set.
+ *
+ * @see _CPU_set_Is_large_enough().
+ */
+RTEMS_INLINE_ROUTINE void _CPU_set_Fill_with_online_processors(
+  size_t     setsize,
+  cpu_set_t *cpuset
+)
+{
+  uint32_t cpu_count = _SMP_Get_processor_count();
+  uint32_t cpu_index;
+
+  CPU_ZERO_S( setsize, cpuset );
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    CPU_SET_S( (int) cpu_index, setsize, cpuset );
+  }
+}
+
+/**
+ * @brief Returns true if the processor set contains at least one online
+ * processor.
+ *
+ * @param[in] setsize The size of the processor set in bytes.
+ * @param[in] cpuset The processor set.
+ *
+ * @retval true The processor set contains an online processor.
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _CPU_set_Has_online_processor(
+  size_t           setsize,
+  const cpu_set_t *cpuset
+)
+{
+  uint32_t cpu_count = _SMP_Get_processor_count();
+  uint32_t cpu_index;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    if (
+      cpu_index < setsize * CHAR_BIT
+        && CPU_ISSET_S( (int) cpu_index, setsize, cpuset )
+    ) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/**
+ * @brief Returns true if the processor set contains all online processors.
+ *
+ * @param[in] setsize The size of the processor set in bytes.
+ * @param[in] cpuset The processor set.
+ *
+ * @retval true The processor set contains all online processors.
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _CPU_set_Has_all_online_processors(
+  size_t           setsize,
+  const cpu_set_t *cpuset
+)
+{
+  uint32_t cpu_count = _SMP_Get_processor_count();
+  uint32_t cpu_index;
+
+  if ( !_CPU_set_Is_large_enough( setsize ) ) {
+    return false;
+  }
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    if ( !CPU_ISSET_S( (int) cpu_index, setsize, cpuset ) ) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* defined(__RTEMS_HAVE_SYS_CPUSET_H__) */
+
+#endif /* _RTEMS_SCORE_CPUSETIMPL_H */
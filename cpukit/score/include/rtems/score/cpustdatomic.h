@@ -323,6 +323,13 @@ static inline bool _CPU_atomic_Compare_exchange_ptr(
     new_pointer, order_succ, order_fail );
 }
 
+static inline void _CPU_atomic_Fence(
+  Atomic_Order order
+)
+{
+  atomic_thread_fence( order );
+}
+
 static inline void _CPU_atomic_Flag_clear(
   volatile Atomic_Flag *object,
   Atomic_Order order
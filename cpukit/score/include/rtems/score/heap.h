@@ -36,8 +36,10 @@ extern "C" {
  * @brief The Heap Handler provides a heap.
  *
  * A heap is a doubly linked list of variable size blocks which are allocated
- * using the first fit method.  Garbage collection is performed each time a
- * block is returned to the heap by coalescing neighbor blocks.  Control
+ * using the first fit method.  Optionally a heap may use the segregated fit
+ * method, see _Heap_Enable_segregated_fit().  Garbage collection is
+ * performed each time a block is returned to the heap by coalescing neighbor
+ * blocks.  Control
  * information for both allocated and free blocks is contained in the heap
  * area.  A heap control structure contains control information for the heap.
  *
@@ -322,6 +324,68 @@ typedef struct {
   uint32_t resizes;
 } Heap_Statistics;
 
+/**
+ * @brief Logarithm to base two of the count of second level free lists per
+ * first level size class in the segregated fit allocation mode.
+ */
+#define HEAP_SEGREGATED_FIT_SECOND_LEVEL_SHIFT 2
+
+/**
+ * @brief Count of second level free lists per first level size class in the
+ * segregated fit allocation mode.
+ */
+#define HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT \
+  (1U << HEAP_SEGREGATED_FIT_SECOND_LEVEL_SHIFT)
+
+/**
+ * @brief Logarithm to base two of the smallest block size in the segregated
+ * fit allocation mode.
+ *
+ * The minimum block size is at least the size of a @ref Heap_Block which
+ * consists of four pointer sized values, so it is at least eight bytes.
+ */
+#define HEAP_SEGREGATED_FIT_FIRST_LEVEL_MIN 3
+
+/**
+ * @brief Count of first level size classes in the segregated fit allocation
+ * mode.
+ */
+#define HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT \
+  (8 * sizeof(uintptr_t) - HEAP_SEGREGATED_FIT_FIRST_LEVEL_MIN)
+
+/**
+ * @brief Free lists of the segregated fit allocation mode.
+ *
+ * The free blocks are kept on two-level segregated free lists.  The first
+ * level size class of a block is the index of the most significant bit set
+ * in its size.  Each first level size class is divided into
+ * @ref HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT second level free lists of
+ * equal size ranges.  A bitmap per level indicates the non-empty free lists.
+ * Thus a free list with blocks large enough for a request is found in
+ * constant time.
+ *
+ * @see _Heap_Enable_segregated_fit().
+ */
+typedef struct {
+  /**
+   * @brief Bit @a i is set if the first level size class @a i contains a
+   * non-empty second level free list.
+   */
+  uintptr_t first_level_map;
+
+  /**
+   * @brief Bit @a j of element @a i is set if the second level free list
+   * @a j of the first level size class @a i is not empty.
+   */
+  uint32_t second_level_map [HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT];
+
+  /**
+   * @brief The free list heads.
+   */
+  Heap_Block free_lists [HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT]
+    [HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT];
+} Heap_Segregated_fit;
+
 /**
  * @brief Control block used to manage a heap.
  */
@@ -334,6 +398,14 @@ struct Heap_Control {
   Heap_Block *first_block;
   Heap_Block *last_block;
   Heap_Statistics stats;
+
+  /**
+   * @brief The free lists of the segregated fit allocation mode.
+   *
+   * This field is @c NULL in the first fit allocation mode.  In this case the
+   * free blocks are on the @a free_list.
+   */
+  Heap_Segregated_fit *segregated_fit;
   #ifdef HEAP_PROTECTION
     Heap_Protection Protection;
   #endif
@@ -91,6 +91,25 @@ uintptr_t _Heap_Initialize(
   uintptr_t page_size
 );
 
+/**
+ * @brief Switches the heap @a heap to the segregated fit allocation mode.
+ *
+ * The free lists of the segregated fit allocation mode are allocated from
+ * the heap itself.  The free blocks of the heap are moved to these free
+ * lists.  Afterwards the allocation time and the time to free a block do not
+ * depend on the count of free blocks, with the exception of requests with an
+ * alignment or boundary constraint and requests which can be satisfied only
+ * by a block of the size class of the request.  For these the free lists are
+ * searched linearly block by block.  The heap remains in this mode until it
+ * is initialized again.
+ *
+ * Returns @c true in case of success, and @c false if not enough memory is
+ * available for the free lists.
+ *
+ * @see Heap_Segregated_fit.
+ */
+bool _Heap_Enable_segregated_fit( Heap_Control *heap );
+
 /**
  * @brief Allocates a memory area of size @a size bytes from the heap @a heap.
  *
@@ -417,6 +436,236 @@ RTEMS_INLINE_ROUTINE void _Heap_Free_list_insert_before(
   block_next->prev = new_block;
 }
 
+RTEMS_INLINE_ROUTINE bool _Heap_Is_segregated_fit( const Heap_Control *heap )
+{
+  return heap->segregated_fit != NULL;
+}
+
+RTEMS_INLINE_ROUTINE uint32_t _Heap_Most_significant_bit( uintptr_t value )
+{
+  return (uint32_t) ( 8 * sizeof( unsigned long ) - 1 )
+    - (uint32_t) __builtin_clzl( (unsigned long) value );
+}
+
+RTEMS_INLINE_ROUTINE uint32_t _Heap_Least_significant_bit( uintptr_t value )
+{
+  return (uint32_t) __builtin_ctzl( (unsigned long) value );
+}
+
+/**
+ * @brief Returns the first and second level free list indices of a block
+ * with size @a block_size in the segregated fit allocation mode.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Segregated_fit_mapping(
+  uintptr_t block_size,
+  uint32_t *first_level,
+  uint32_t *second_level
+)
+{
+  uint32_t const msb = _Heap_Most_significant_bit( block_size );
+
+  *first_level = msb - HEAP_SEGREGATED_FIT_FIRST_LEVEL_MIN;
+  *second_level = (uint32_t)
+    ( block_size >> ( msb - HEAP_SEGREGATED_FIT_SECOND_LEVEL_SHIFT ) )
+      & ( HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT - 1 );
+}
+
+RTEMS_INLINE_ROUTINE Heap_Block *_Heap_Segregated_fit_head(
+  Heap_Segregated_fit *segregated_fit,
+  uint32_t first_level,
+  uint32_t second_level
+)
+{
+  return &segregated_fit->free_lists [first_level] [second_level];
+}
+
+/**
+ * @brief Returns the head of the first non-empty free list at or above the
+ * indices @a first_level and @a second_level in the segregated fit
+ * allocation mode.
+ *
+ * The indices are updated to the ones of the free list found.  Returns
+ * @c NULL if no such free list exists.
+ */
+RTEMS_INLINE_ROUTINE Heap_Block *_Heap_Segregated_fit_find(
+  Heap_Segregated_fit *segregated_fit,
+  uint32_t *first_level,
+  uint32_t *second_level
+)
+{
+  uint32_t fl = *first_level;
+  uint32_t sl_map =
+    segregated_fit->second_level_map [fl] & ( ~0U << *second_level );
+
+  if ( sl_map == 0 ) {
+    uintptr_t const fl_map =
+      segregated_fit->first_level_map & ( ~(uintptr_t) 0 << ( fl + 1 ) );
+
+    if ( fl_map == 0 ) {
+      return NULL;
+    }
+
+    fl = _Heap_Least_significant_bit( fl_map );
+    sl_map = segregated_fit->second_level_map [fl];
+  }
+
+  *first_level = fl;
+  *second_level = _Heap_Least_significant_bit( sl_map );
+
+  return _Heap_Segregated_fit_head( segregated_fit, fl, *second_level );
+}
+
+RTEMS_INLINE_ROUTINE void _Heap_Segregated_fit_insert(
+  Heap_Segregated_fit *segregated_fit,
+  Heap_Block *block,
+  uintptr_t block_size
+)
+{
+  uint32_t fl;
+  uint32_t sl;
+
+  _Heap_Segregated_fit_mapping( block_size, &fl, &sl );
+  _Heap_Free_list_insert_after(
+    _Heap_Segregated_fit_head( segregated_fit, fl, sl ),
+    block
+  );
+  segregated_fit->first_level_map |= (uintptr_t) 1 << fl;
+  segregated_fit->second_level_map [fl] |= 1U << sl;
+}
+
+RTEMS_INLINE_ROUTINE void _Heap_Segregated_fit_remove(
+  Heap_Segregated_fit *segregated_fit,
+  Heap_Block *block,
+  uintptr_t block_size
+)
+{
+  Heap_Block *head;
+  uint32_t fl;
+  uint32_t sl;
+
+  _Heap_Segregated_fit_mapping( block_size, &fl, &sl );
+  _Heap_Free_list_remove( block );
+
+  head = _Heap_Segregated_fit_head( segregated_fit, fl, sl );
+  if ( head->next == head ) {
+    segregated_fit->second_level_map [fl] &= ~( 1U << sl );
+
+    if ( segregated_fit->second_level_map [fl] == 0 ) {
+      segregated_fit->first_level_map &= ~( (uintptr_t) 1 << fl );
+    }
+  }
+}
+
+/**
+ * @brief Inserts the free block @a block of size @a block_size into the free
+ * lists of the heap @a heap.
+ *
+ * In the first fit allocation mode the block is inserted after
+ * @a free_list_anchor.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_insert(
+  Heap_Control *heap,
+  Heap_Block *free_list_anchor,
+  Heap_Block *block,
+  uintptr_t block_size
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_fit_insert( heap->segregated_fit, block, block_size );
+  } else {
+    _Heap_Free_list_insert_after( free_list_anchor, block );
+  }
+}
+
+/**
+ * @brief Removes the free block @a block from the free lists of the heap
+ * @a heap.
+ *
+ * The block size must be the one of the insert operation.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_remove(
+  Heap_Control *heap,
+  Heap_Block *block
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_fit_remove(
+      heap->segregated_fit,
+      block,
+      block->size_and_flag & ~HEAP_PREV_BLOCK_USED
+    );
+  } else {
+    _Heap_Free_list_remove( block );
+  }
+}
+
+/**
+ * @brief Replaces the free block @a old_block with the free block
+ * @a new_block of size @a new_block_size in the free lists of the heap
+ * @a heap.
+ *
+ * The size of the old block must be the one of its insert operation.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_replace(
+  Heap_Control *heap,
+  Heap_Block *old_block,
+  Heap_Block *new_block,
+  uintptr_t new_block_size
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Free_block_remove( heap, old_block );
+    _Heap_Segregated_fit_insert(
+      heap->segregated_fit,
+      new_block,
+      new_block_size
+    );
+  } else {
+    _Heap_Free_list_replace( old_block, new_block );
+  }
+}
+
+/**
+ * @brief Moves the free block @a block to the free list for the new size
+ * @a new_block_size in the heap @a heap.
+ *
+ * This must be called before the block size changes.  In the first fit
+ * allocation mode the block stays at its position in the free list.
+ */
+RTEMS_INLINE_ROUTINE void _Heap_Free_block_resize(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t new_block_size
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Free_block_replace( heap, block, block, new_block_size );
+  }
+}
+
+/**
+ * @brief Returns a free block of the heap @a heap, or @c NULL if no free
+ * block exists.
+ */
+RTEMS_INLINE_ROUTINE Heap_Block *_Heap_Free_block_any( Heap_Control *heap )
+{
+  Heap_Block *head;
+
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    uint32_t fl = 0;
+    uint32_t sl = 0;
+
+    head = _Heap_Segregated_fit_find( heap->segregated_fit, &fl, &sl );
+    if ( head == NULL ) {
+      return NULL;
+    }
+  } else {
+    head = _Heap_Free_list_head( heap );
+  }
+
+  return head->next != head ? head->next : NULL;
+}
+
 RTEMS_INLINE_ROUTINE bool _Heap_Is_aligned(
   uintptr_t value,
   uintptr_t alignment
@@ -147,7 +147,8 @@ typedef enum {
   INTERNAL_ERROR_GXX_KEY_ADD_FAILED,
   INTERNAL_ERROR_GXX_MUTEX_INIT_FAILED,
   INTERNAL_ERROR_NO_MEMORY_FOR_HEAP,
-  INTERNAL_ERROR_CPU_ISR_INSTALL_VECTOR
+  INTERNAL_ERROR_CPU_ISR_INSTALL_VECTOR,
+  INTERNAL_ERROR_SCHEDULER_INVALID_CLUSTER
 } Internal_errors_Core_list;
 
 typedef uint32_t Internal_errors_t;
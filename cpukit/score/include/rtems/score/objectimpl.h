@@ -21,6 +21,9 @@
 
 #include <rtems/score/object.h>
 #include <rtems/score/isrlevel.h>
+#if defined(RTEMS_SMP)
+  #include <rtems/score/atomic.h>
+#endif
 #include <rtems/score/threaddispatch.h>
 
 #ifdef __cplusplus
@@ -119,6 +122,16 @@ typedef enum {
  */
 typedef void ( *Objects_Thread_queue_Extract_callout )( void * );
 
+/**
+ *  The following type defines the visitor used by _Objects_Read() to
+ *  copy the state of an object.  It returns false if the object is about to
+ *  be deleted and its state is no longer available.
+ */
+typedef bool ( *Objects_Read_visitor )(
+  const Objects_Control *the_object,
+  void                  *arg
+);
+
 /**
  *  The following defines the structure for the information used to
  *  manage each class of objects.
@@ -142,6 +155,15 @@ typedef struct {
   size_t            size;
   /** This points to the table of local objects. */
   Objects_Control **local_table;
+  /**
+   *  This is the sequence counter of the local table.  It is odd while the
+   *  local table changes, see _Objects_Read().
+   */
+  #if defined(RTEMS_SMP)
+    Atomic_Ulong    sequence;
+  #else
+    volatile unsigned long sequence;
+  #endif
   /** This is the chain of inactive control blocks. */
   Chain_Control     Inactive;
   /** This is the number of objects on the Inactive list. */
@@ -444,7 +466,8 @@ Objects_Control *_Objects_Get (
  *  @note _Objects_Get returns with dispatching disabled for
  *  local and remote objects.  _Objects_Get_isr_disable returns with
  *  dispatchng disabled for remote objects and interrupts for local
- *  objects.
+ *  objects.  On SMP configurations thread dispatching is disabled for local
+ *  objects as well.
  */
 Objects_Control *_Objects_Get_isr_disable(
   Objects_Information *information,
@@ -485,6 +508,44 @@ Objects_Control *_Objects_Get_no_protection(
   Objects_Locations   *location
 );
 
+/**
+ *  @brief Reads the state of an object without a lock.
+ *
+ *  This function maps the object id to the object control block like
+ *  _Objects_Get() and calls the visitor for a local object.  Thread
+ *  dispatching and interrupts are not disabled and on SMP configurations
+ *  the Giant lock is not acquired.  The lookup is protected by the sequence
+ *  counter of the object information.  If the local table changed during
+ *  the visit, the lookup and the visit are repeated.
+ *
+ *  The visitor must only copy the state of the object into its argument
+ *  since it may be called more than once.  It may observe an object which
+ *  is deleted concurrently.  In this case the copied state is discarded and
+ *  the lookup is repeated.  The visitor must not write to the object and
+ *  must not follow pointers to memory which was allocated separately from
+ *  the object, for example the API extensions of a thread.  Such memory may
+ *  be already freed and reused.  The visitor may return false if the state
+ *  of the object is not available.  A state which consists of more than one
+ *  field may be inconsistent.  Thus this function is only suitable for
+ *  read-only queries of a single value.
+ *
+ *  @param[in] information points to an object class information block.
+ *  @param[in] id is the Id of the object to read.
+ *  @param[in] visitor is the visitor called for a local object.
+ *  @param[in] arg is the argument of the visitor.
+ *
+ *  @retval OBJECTS_LOCAL The visitor copied the state of the local object.
+ *  @retval OBJECTS_REMOTE The object is remote and the visitor was not
+ *  called.
+ *  @retval OBJECTS_ERROR The id is invalid or the visitor returned false.
+ */
+Objects_Locations _Objects_Read(
+  Objects_Information  *information,
+  Objects_Id            id,
+  Objects_Read_visitor  visitor,
+  void                 *arg
+);
+
 /**
  *  Like @ref _Objects_Get, but is used to find "next" open object.
  *
@@ -691,6 +752,110 @@ RTEMS_INLINE_ROUTINE bool _Objects_Are_ids_equal(
   return ( left == right );
 }
 
+/**
+ * @brief Begins a read of the local table.
+ *
+ * @param[in] information points to an Object Information Table
+ *
+ * @return The sequence counter value to pass to
+ *         _Objects_Sequence_read_retry().
+ */
+RTEMS_INLINE_ROUTINE unsigned long _Objects_Sequence_read_begin(
+  Objects_Information *information
+)
+{
+  unsigned long sequence;
+
+#if defined(RTEMS_SMP)
+  sequence = _Atomic_Load_ulong( &information->sequence, ATOMIC_ORDER_ACQUIRE );
+#else
+  sequence = information->sequence;
+  RTEMS_COMPILER_MEMORY_BARRIER();
+#endif
+
+  return sequence;
+}
+
+/**
+ * @brief Ends a read of the local table.
+ *
+ * @param[in] information points to an Object Information Table
+ * @param[in] sequence is the value returned by _Objects_Sequence_read_begin()
+ *
+ * @retval true The local table changed during the read and the read must be
+ *         repeated.
+ * @retval false Otherwise.
+ */
+RTEMS_INLINE_ROUTINE bool _Objects_Sequence_read_retry(
+  Objects_Information *information,
+  unsigned long        sequence
+)
+{
+  unsigned long current;
+
+#if defined(RTEMS_SMP)
+  _Atomic_Fence( ATOMIC_ORDER_ACQUIRE );
+  current = _Atomic_Load_ulong( &information->sequence, ATOMIC_ORDER_RELAXED );
+#else
+  RTEMS_COMPILER_MEMORY_BARRIER();
+  current = information->sequence;
+#endif
+
+  return ( sequence & 1 ) != 0 || current != sequence;
+}
+
+/**
+ * @brief Begins a change of the local table.
+ *
+ * The changes of the local table must be serialized and interrupts must be
+ * disabled.
+ *
+ * @param[in] information points to an Object Information Table
+ */
+RTEMS_INLINE_ROUTINE void _Objects_Sequence_write_begin(
+  Objects_Information *information
+)
+{
+#if defined(RTEMS_SMP)
+  unsigned long sequence;
+
+  sequence = _Atomic_Load_ulong( &information->sequence, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_ulong(
+    &information->sequence,
+    sequence + 1,
+    ATOMIC_ORDER_RELAXED
+  );
+  _Atomic_Fence( ATOMIC_ORDER_RELEASE );
+#else
+  ++information->sequence;
+  RTEMS_COMPILER_MEMORY_BARRIER();
+#endif
+}
+
+/**
+ * @brief Ends a change of the local table.
+ *
+ * @param[in] information points to an Object Information Table
+ */
+RTEMS_INLINE_ROUTINE void _Objects_Sequence_write_end(
+  Objects_Information *information
+)
+{
+#if defined(RTEMS_SMP)
+  unsigned long sequence;
+
+  sequence = _Atomic_Load_ulong( &information->sequence, ATOMIC_ORDER_RELAXED );
+  _Atomic_Store_ulong(
+    &information->sequence,
+    sequence + 1,
+    ATOMIC_ORDER_RELEASE
+  );
+#else
+  RTEMS_COMPILER_MEMORY_BARRIER();
+  ++information->sequence;
+#endif
+}
+
 /**
  * This function returns a pointer to the local_table object
  * referenced by the index.
@@ -738,6 +903,8 @@ RTEMS_INLINE_ROUTINE void _Objects_Set_local_object(
   Objects_Control     *the_object
 )
 {
+  ISR_Level level;
+
   /*
    *  This routine is ONLY to be called from places in the code
    *  where the Id is known to be good.  Therefore, this should NOT
@@ -748,7 +915,23 @@ RTEMS_INLINE_ROUTINE void _Objects_Set_local_object(
       return;
   #endif
 
+  /*
+   *  Interrupts are disabled so that a reader in an interrupt service
+   *  routine never waits for the sequence counter on this processor.
+   */
+#if defined(RTEMS_SMP)
+  _ISR_Disable_without_giant( level );
+#else
+  _ISR_Disable( level );
+#endif
+  _Objects_Sequence_write_begin( information );
   information->local_table[ index ] = the_object;
+  _Objects_Sequence_write_end( information );
+#if defined(RTEMS_SMP)
+  _ISR_Enable_without_giant( level );
+#else
+  _ISR_Enable( level );
+#endif
 }
 
 /**
@@ -896,6 +1079,27 @@ RTEMS_INLINE_ROUTINE void _Objects_Put_and_keep_thread_dispatch_disabled(
 #endif
 }
 
+/**
+ * @brief Enables interrupts for an object obtained with
+ * _Objects_Get_isr_disable() and keeps thread dispatching disabled.
+ *
+ * Use _Objects_Put() to put back the object.
+ *
+ * @param[in] the_object is the object.
+ * @param[in] level is the ISR disable level cookie.
+ */
+RTEMS_INLINE_ROUTINE void _Objects_ISR_enable_for_get_isr_disable(
+  Objects_Control *the_object,
+  ISR_Level        level
+)
+{
+  (void) the_object;
+#if !defined(RTEMS_SMP)
+  _Thread_Disable_dispatch();
+#endif
+  _ISR_Enable( level );
+}
+
 /**
  * @brief Puts back an object obtained with _Objects_Get_isr_disable().
  */
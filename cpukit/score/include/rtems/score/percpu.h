@@ -51,6 +51,11 @@ extern "C" {
 typedef struct Thread_Control_struct Thread_Control;
 #endif
 
+#if defined( RTEMS_SMP )
+struct Scheduler_SMP_Control;
+struct SMP_Job_queue;
+#endif
+
 /**
  *  @defgroup PerCPU RTEMS Per CPU Information
  *
@@ -194,10 +199,21 @@ typedef struct {
     /**
      *  This is the request for the interrupt.
      *
-     *  @note This may become a chain protected by atomic instructions.
+     *  @note Requests which need an argument or must not be merged use the
+     *  job queue.
      */
     uint32_t message;
 
+    /**
+     * @brief The lock-free job queue of this processor.
+     *
+     * This field is set once during system initialization and is NULL if
+     * atomic operations are not available.
+     *
+     * @see _SMP_Job_post() and _SMP_Job_process().
+     */
+    struct SMP_Job_queue *job_queue;
+
     /**
      * @brief Indicates the current state of the CPU.
      *
@@ -206,6 +222,14 @@ typedef struct {
      * @see _Per_CPU_Change_state() and _Per_CPU_Wait_for_state().
      */
     Per_CPU_State state;
+
+    /**
+     * @brief The SMP scheduler instance which owns this processor.
+     *
+     * This field is set once during system initialization by the start idle
+     * operation of the scheduler.
+     */
+    struct Scheduler_SMP_Control *scheduler_instance;
   #endif
 } Per_CPU_Control;
 
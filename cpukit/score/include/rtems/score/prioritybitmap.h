@@ -54,6 +54,20 @@ typedef struct {
   Priority_bit_map_Control  block_minor;
 } Priority_bit_map_Information;
 
+/**
+ *  @brief A priority bit map of its own.
+ *
+ *  Scheduler instances which must not share the global priority bit map
+ *  (_Priority_Major_bit_map and _Priority_Bit_map) use this structure to
+ *  maintain a private one.
+ */
+typedef struct {
+  /** This is the major bit map. */
+  Priority_bit_map_Control major_bit_map;
+  /** This is the minor bit map indexed by the major bit number. */
+  Priority_bit_map_Control bit_map[ 16 ] CPU_STRUCTURE_ALIGNMENT;
+} Priority_bit_map_Table;
+
 /**@}*/
 
 #ifdef __cplusplus
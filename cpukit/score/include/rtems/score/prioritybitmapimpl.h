@@ -279,6 +279,98 @@ RTEMS_INLINE_ROUTINE void _Priority_bit_map_Initialize_information(
   the_priority_map->block_minor = (Priority_bit_map_Control)(~((uint32_t)mask));
 }
 
+/**
+ * This routine initializes the_table to indicate that no threads are
+ * ready.
+ */
+
+RTEMS_INLINE_ROUTINE void _Priority_bit_map_Table_initialize(
+  Priority_bit_map_Table *the_table
+)
+{
+  size_t index;
+
+  the_table->major_bit_map = 0;
+
+  for ( index = 0 ; index < RTEMS_ARRAY_SIZE( the_table->bit_map ) ; ++index )
+    the_table->bit_map[ index ] = 0;
+}
+
+/**
+ * This routine uses the_priority_map to update the_table to indicate that
+ * a thread has been readied.
+ */
+
+RTEMS_INLINE_ROUTINE void _Priority_bit_map_Table_add(
+  Priority_bit_map_Table       *the_table,
+  Priority_bit_map_Information *the_priority_map
+)
+{
+  *the_priority_map->minor |= the_priority_map->ready_minor;
+  the_table->major_bit_map |= the_priority_map->ready_major;
+}
+
+/**
+ * This routine uses the_priority_map to update the_table to indicate that
+ * a thread has been removed from the ready state.
+ */
+
+RTEMS_INLINE_ROUTINE void _Priority_bit_map_Table_remove(
+  Priority_bit_map_Table       *the_table,
+  Priority_bit_map_Information *the_priority_map
+)
+{
+  *the_priority_map->minor &= the_priority_map->block_minor;
+  if ( *the_priority_map->minor == 0 )
+    the_table->major_bit_map &= the_priority_map->block_major;
+}
+
+/**
+ * This function returns the priority of the highest priority
+ * ready thread of the_table.
+ */
+
+RTEMS_INLINE_ROUTINE Priority_Control _Priority_bit_map_Table_get_highest(
+  const Priority_bit_map_Table *the_table
+)
+{
+  Priority_bit_map_Control minor;
+  Priority_bit_map_Control major;
+
+  _Bitfield_Find_first_bit( the_table->major_bit_map, major );
+  _Bitfield_Find_first_bit( the_table->bit_map[major], minor );
+
+  return (_Priority_Bits_index( major ) << 4) +
+          _Priority_Bits_index( minor );
+}
+
+RTEMS_INLINE_ROUTINE bool _Priority_bit_map_Table_is_empty(
+  const Priority_bit_map_Table *the_table
+)
+{
+  return the_table->major_bit_map == 0;
+}
+
+/**
+ * This routine initializes the_priority_map so that it
+ * contains the information necessary to manage a thread
+ * at new_priority in the_table.
+ */
+
+RTEMS_INLINE_ROUTINE void _Priority_bit_map_Table_initialize_information(
+  Priority_bit_map_Table       *the_table,
+  Priority_bit_map_Information *the_priority_map,
+  Priority_Control              new_priority
+)
+{
+  Priority_bit_map_Control major = _Priority_Major( new_priority );
+
+  _Priority_bit_map_Initialize_information( the_priority_map, new_priority );
+
+  the_priority_map->minor =
+    &the_table->bit_map[ _Priority_Bits_index(major) ];
+}
+
 /** @} */
 
 #ifdef __cplusplus
@@ -22,6 +22,9 @@
 #include <rtems/score/percpu.h>
 #include <rtems/score/chain.h>
 #include <rtems/score/priority.h>
+#if defined(RTEMS_SMP) && defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+  #include <sys/cpuset.h>
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -98,6 +101,46 @@ typedef struct {
    * @see _Scheduler_Start_idle().
    */
   void ( *start_idle )( Thread_Control *thread, Per_CPU_Control *processor );
+
+#if defined(RTEMS_SMP)
+  /**
+   * @brief Returns the index of the processor cluster of the thread.
+   *
+   * @see _Scheduler_Get_cluster().
+   */
+  uint32_t ( *get_cluster )( Thread_Control *thread );
+
+  /**
+   * @brief Moves the thread to another processor cluster.
+   *
+   * @see _Scheduler_Set_cluster().
+   */
+  bool ( *set_cluster )( Thread_Control *thread, uint32_t cluster );
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+  /**
+   * @brief Returns the processor affinity set of the thread.
+   *
+   * @see _Scheduler_Get_affinity().
+   */
+  bool ( *get_affinity )(
+    Thread_Control *thread,
+    size_t          cpusetsize,
+    cpu_set_t      *cpuset
+  );
+
+  /**
+   * @brief Sets the processor affinity set of the thread.
+   *
+   * @see _Scheduler_Set_affinity().
+   */
+  bool ( *set_affinity )(
+    Thread_Control  *thread,
+    size_t           cpusetsize,
+    const cpu_set_t *cpuset
+  );
+#endif
+#endif
 } Scheduler_Operations;
 
 /**
@@ -184,6 +227,97 @@ void _Scheduler_default_Start_idle(
   Per_CPU_Control *processor
 );
 
+#if defined(RTEMS_SMP)
+  /**
+   * @brief Returns zero, the index of the only processor cluster.
+   *
+   * @param[in] thread Unused.
+   *
+   * @return Zero.
+   */
+  uint32_t _Scheduler_default_Get_cluster(
+    Thread_Control *thread
+  );
+
+  /**
+   * @brief Does nothing.
+   *
+   * Schedulers without processor cluster support have exactly one cluster
+   * which contains all processors.
+   *
+   * @param[in] thread Unused.
+   * @param[in] cluster Unused.
+   *
+   * @retval true Always.
+   */
+  bool _Scheduler_default_Set_cluster(
+    Thread_Control *thread,
+    uint32_t        cluster
+  );
+
+  /**
+   * @brief Entry points of the processor cluster operations for schedulers
+   * without processor cluster support.
+   *
+   * This must be the last part of the entry points initializer.
+   */
+  #define SCHEDULER_OPERATION_DEFAULT_CLUSTER \
+    , _Scheduler_default_Get_cluster \
+    , _Scheduler_default_Set_cluster
+#else
+  #define SCHEDULER_OPERATION_DEFAULT_CLUSTER
+#endif
+
+#if defined(RTEMS_SMP) && defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+  /**
+   * @brief Returns the set of online processors.
+   *
+   * @param[in] thread Unused.
+   * @param[in] cpusetsize The size of the processor set in bytes.
+   * @param[out] cpuset The processor set.
+   *
+   * @retval true Successful operation.
+   * @retval false The processor set is too small to represent all online
+   * processors.
+   */
+  bool _Scheduler_default_Get_affinity(
+    Thread_Control *thread,
+    size_t          cpusetsize,
+    cpu_set_t      *cpuset
+  );
+
+  /**
+   * @brief Accepts only the set of all online processors.
+   *
+   * Schedulers without processor affinity support may use every online
+   * processor for every thread.
+   *
+   * @param[in] thread Unused.
+   * @param[in] cpusetsize The size of the processor set in bytes.
+   * @param[in] cpuset The processor set.
+   *
+   * @retval true The processor set contains all online processors.
+   * @retval false Otherwise.
+   */
+  bool _Scheduler_default_Set_affinity(
+    Thread_Control  *thread,
+    size_t           cpusetsize,
+    const cpu_set_t *cpuset
+  );
+
+  /**
+   * @brief Entry points of the processor affinity operations for schedulers
+   * without processor affinity support.
+   *
+   * This must be the last part of the entry points initializer.
+   */
+  #define SCHEDULER_OPERATION_DEFAULT_GET_SET_AFFINITY \
+    , _Scheduler_default_Get_affinity \
+    , _Scheduler_default_Set_affinity
+#else
+  #define SCHEDULER_OPERATION_DEFAULT_GET_SET_AFFINITY
+#endif
+
 /**@}*/
 
 #ifdef __cplusplus
@@ -240,6 +240,93 @@ RTEMS_INLINE_ROUTINE void _Scheduler_Start_idle(
   ( *_Scheduler.Operations.start_idle )( thread, processor );
 }
 
+#if defined(RTEMS_SMP)
+/**
+ * @brief Returns the index of the processor cluster of the thread.
+ *
+ * @param[in] thread The thread.
+ *
+ * @return The processor cluster index.
+ */
+RTEMS_INLINE_ROUTINE uint32_t _Scheduler_Get_cluster(
+  Thread_Control *thread
+)
+{
+  return ( *_Scheduler.Operations.get_cluster )( thread );
+}
+
+/**
+ * @brief Moves the thread to the processor cluster with the specified index.
+ *
+ * The thread must neither execute on a processor nor be scheduled to execute
+ * on a processor.  The cluster index must be less than the configured count
+ * of processor clusters.  This function must be called with thread
+ * dispatching disabled.
+ *
+ * @param[in,out] thread The thread.
+ * @param[in] cluster The index of the new processor cluster.
+ *
+ * @retval true Successful operation.
+ * @retval false The thread executes or is scheduled to execute on a
+ * processor.
+ */
+RTEMS_INLINE_ROUTINE bool _Scheduler_Set_cluster(
+  Thread_Control *thread,
+  uint32_t        cluster
+)
+{
+  return ( *_Scheduler.Operations.set_cluster )( thread, cluster );
+}
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+/**
+ * @brief Returns the processor affinity set of the thread.
+ *
+ * The processor set contains only online processors.  This function must be
+ * called with thread dispatching disabled.
+ *
+ * @param[in] thread The thread.
+ * @param[in] cpusetsize The size of the processor set in bytes.
+ * @param[out] cpuset The processor affinity set of the thread.
+ *
+ * @retval true Successful operation.
+ * @retval false The processor set is too small to represent all online
+ * processors.
+ */
+RTEMS_INLINE_ROUTINE bool _Scheduler_Get_affinity(
+  Thread_Control *thread,
+  size_t          cpusetsize,
+  cpu_set_t      *cpuset
+)
+{
+  return ( *_Scheduler.Operations.get_affinity )( thread, cpusetsize, cpuset );
+}
+
+/**
+ * @brief Sets the processor affinity set of the thread.
+ *
+ * The thread will execute only on processors of its affinity set.  Processors
+ * which are not online are ignored.  This function must be called with thread
+ * dispatching disabled.
+ *
+ * @param[in,out] thread The thread.
+ * @param[in] cpusetsize The size of the processor set in bytes.
+ * @param[in] cpuset The new processor affinity set of the thread.
+ *
+ * @retval true Successful operation.
+ * @retval false The processor set is not acceptable for the scheduler.
+ */
+RTEMS_INLINE_ROUTINE bool _Scheduler_Set_affinity(
+  Thread_Control  *thread,
+  size_t           cpusetsize,
+  const cpu_set_t *cpuset
+)
+{
+  return ( *_Scheduler.Operations.set_affinity )( thread, cpusetsize, cpuset );
+}
+#endif
+#endif
+
 RTEMS_INLINE_ROUTINE void _Scheduler_Update_heir(
   Thread_Control *heir,
   bool force_dispatch
@@ -0,0 +1,185 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreSchedulerPriorityAffinitySMP
+ *
+ * @brief Deterministic Priority Affinity SMP Scheduler API
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifndef _RTEMS_SCORE_SCHEDULERPRIORITYAFFINITYSMP_H
+#define _RTEMS_SCORE_SCHEDULERPRIORITYAFFINITYSMP_H
+
+#include <rtems/score/scheduler.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/prioritybitmap.h>
+#include <rtems/score/schedulerpriority.h>
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+
+#include <sys/cpuset.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup ScoreSchedulerPriorityAffinitySMP Deterministic Priority Affinity
+ * SMP Scheduler
+ *
+ * @ingroup ScoreScheduler
+ *
+ * This is an implementation of the global fixed priority scheduler (G-FP)
+ * which honours the processor affinity set of each thread.  It uses one ready
+ * chain per priority.  All ready threads including the executing threads are
+ * on the ready chains.
+ *
+ * After each change of the ready set the heir of each processor is determined
+ * anew.  The ready threads are visited in priority order and each thread gets
+ * a processor of its affinity set which is not yet taken by a thread of
+ * higher priority.  A thread prefers its current processor.  Otherwise it
+ * takes the processor with the lowest priority heir to keep the set of
+ * scheduled threads stable.  An executing thread may only keep its current
+ * processor since its context may not be saved yet.  The next scheduler
+ * operation or the next clock tick moves it to another processor of its
+ * affinity set once it stopped executing.
+ *
+ * The scheduler operations are not constant time.  In the worst case all
+ * ready threads are visited and for each thread all processors are visited.
+ *
+ * The thread preempt mode will be ignored.
+ *
+ * @{
+ */
+
+/**
+ * @brief Scheduler control referenced by the scheduler information pointer.
+ */
+typedef struct {
+  /**
+   * @brief Protects the ready chains and the processor affinity sets.
+   *
+   * This lock may be held while a per-CPU lock is acquired, but not vice
+   * versa.
+   */
+  ISR_lock_Control Lock;
+
+  /**
+   * @brief Scratch area for the new heir of each processor indexed by the
+   * processor index.
+   */
+  Thread_Control **heirs;
+
+  /**
+   * @brief The priority bit map of the ready chains.
+   */
+  Priority_bit_map_Table Bit_map;
+
+  /**
+   * @brief One ready chain per priority.
+   *
+   * This must be the last member since the ready chains of the other
+   * priorities follow it.
+   */
+  Chain_Control Ready[ 1 ];
+} Scheduler_priority_affinity_SMP_Control;
+
+/**
+ * @brief Per-thread data of the Deterministic Priority Affinity SMP
+ * Scheduler.
+ */
+typedef struct {
+  /**
+   * @brief The ready chain and priority bit map information of the thread.
+   *
+   * This must be the first member so that the ready queue routines of the
+   * Deterministic Priority Scheduler can be used.
+   */
+  Scheduler_priority_Per_thread Base;
+
+  /**
+   * @brief The processor affinity set of the thread.
+   */
+  cpu_set_t Affinity;
+} Scheduler_priority_affinity_SMP_Per_thread;
+
+/**
+ * @brief Entry points for the Deterministic Priority Affinity SMP Scheduler.
+ */
+#define SCHEDULER_PRIORITY_AFFINITY_SMP_ENTRY_POINTS \
+  { \
+    _Scheduler_priority_affinity_SMP_Initialize, \
+    _Scheduler_priority_affinity_SMP_Schedule, \
+    _Scheduler_priority_affinity_SMP_Yield, \
+    _Scheduler_priority_affinity_SMP_Block, \
+    _Scheduler_priority_affinity_SMP_Enqueue, \
+    _Scheduler_priority_affinity_SMP_Allocate, \
+    _Scheduler_priority_Free, \
+    _Scheduler_priority_affinity_SMP_Update, \
+    _Scheduler_priority_affinity_SMP_Enqueue, \
+    _Scheduler_priority_affinity_SMP_Enqueue_first, \
+    _Scheduler_priority_affinity_SMP_Extract, \
+    _Scheduler_priority_Priority_compare, \
+    _Scheduler_default_Release_job, \
+    _Scheduler_priority_affinity_SMP_Tick, \
+    _Scheduler_priority_affinity_SMP_Start_idle, \
+    _Scheduler_default_Get_cluster, \
+    _Scheduler_default_Set_cluster, \
+    _Scheduler_priority_affinity_SMP_Get_affinity, \
+    _Scheduler_priority_affinity_SMP_Set_affinity \
+  }
+
+void _Scheduler_priority_affinity_SMP_Initialize( void );
+
+void _Scheduler_priority_affinity_SMP_Schedule( Thread_Control *thread );
+
+void _Scheduler_priority_affinity_SMP_Yield( Thread_Control *thread );
+
+void _Scheduler_priority_affinity_SMP_Block( Thread_Control *thread );
+
+void _Scheduler_priority_affinity_SMP_Enqueue( Thread_Control *thread );
+
+void _Scheduler_priority_affinity_SMP_Enqueue_first( Thread_Control *thread );
+
+void _Scheduler_priority_affinity_SMP_Extract( Thread_Control *thread );
+
+void *_Scheduler_priority_affinity_SMP_Allocate( Thread_Control *thread );
+
+void _Scheduler_priority_affinity_SMP_Update( Thread_Control *thread );
+
+void _Scheduler_priority_affinity_SMP_Tick( void );
+
+void _Scheduler_priority_affinity_SMP_Start_idle(
+  Thread_Control  *thread,
+  Per_CPU_Control *cpu
+);
+
+bool _Scheduler_priority_affinity_SMP_Get_affinity(
+  Thread_Control *thread,
+  size_t          cpusetsize,
+  cpu_set_t      *cpuset
+);
+
+bool _Scheduler_priority_affinity_SMP_Set_affinity(
+  Thread_Control  *thread,
+  size_t           cpusetsize,
+  const cpu_set_t *cpuset
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* defined(__RTEMS_HAVE_SYS_CPUSET_H__) */
+
+#endif /* _RTEMS_SCORE_SCHEDULERPRIORITYAFFINITYSMP_H */
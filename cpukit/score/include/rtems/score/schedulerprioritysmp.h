@@ -24,6 +24,7 @@
 #define _RTEMS_SCORE_SCHEDULERPRIORITYSMP_H
 
 #include <rtems/score/scheduler.h>
+#include <rtems/score/prioritybitmap.h>
 #include <rtems/score/schedulerpriority.h>
 #include <rtems/score/schedulersmp.h>
 
@@ -44,9 +45,71 @@ extern "C" {
  *
  * The thread preempt mode will be ignored.
  *
+ * The processors may be partitioned into clusters.  Each cluster has its own
+ * scheduler instance with a ready set, a scheduled chain and a priority bit
+ * map of its own.  A thread belongs to exactly one cluster and executes only
+ * on processors of its cluster.  The cluster count and the cluster of each
+ * processor are defined by the application configuration.  New threads
+ * belong to the cluster of the creating thread.
+ *
  * @{
  */
 
+/**
+ * @brief Scheduler instance of a processor cluster.
+ */
+typedef struct {
+  /**
+   * @brief The priority bit map of the ready chains of this cluster.
+   */
+  Priority_bit_map_Table Bit_map;
+
+  /**
+   * @brief The SMP scheduler instance of this cluster.
+   *
+   * This must be the last member since the ready chains follow it.
+   */
+  Scheduler_SMP_Control Base;
+} Scheduler_priority_SMP_Cluster;
+
+/**
+ * @brief Scheduler control referenced by the scheduler information pointer.
+ */
+typedef struct {
+  /**
+   * @brief The count of processor clusters.
+   */
+  uint32_t cluster_count;
+
+  /**
+   * @brief The processor clusters indexed by the cluster index.
+   */
+  Scheduler_priority_SMP_Cluster *clusters[ 1 ];
+} Scheduler_priority_SMP_Control;
+
+/**
+ * @brief Per-thread data of the Deterministic Priority SMP Scheduler.
+ */
+typedef struct {
+  /**
+   * @brief The ready chain and priority bit map information of the thread.
+   *
+   * This must be the first member so that the ready queue routines of the
+   * Deterministic Priority Scheduler can be used.
+   */
+  Scheduler_priority_Per_thread Base;
+
+  /**
+   * @brief The processor cluster of the thread.
+   */
+  Scheduler_priority_SMP_Cluster *cluster;
+
+  /**
+   * @brief The index of the processor cluster of the thread.
+   */
+  uint32_t cluster_index;
+} Scheduler_priority_SMP_Per_thread;
+
 /**
  * @brief Entry points for the Simple SMP Scheduler.
  */
@@ -57,7 +120,7 @@ extern "C" {
     _Scheduler_priority_SMP_Yield, \
     _Scheduler_priority_SMP_Block, \
     _Scheduler_priority_SMP_Enqueue_fifo, \
-    _Scheduler_priority_Allocate, \
+    _Scheduler_priority_SMP_Allocate, \
     _Scheduler_priority_Free, \
     _Scheduler_priority_SMP_Update, \
     _Scheduler_priority_SMP_Enqueue_fifo, \
@@ -66,7 +129,10 @@ extern "C" {
     _Scheduler_priority_Priority_compare, \
     _Scheduler_default_Release_job, \
     _Scheduler_default_Tick, \
-    _Scheduler_SMP_Start_idle \
+    _Scheduler_priority_SMP_Start_idle, \
+    _Scheduler_priority_SMP_Get_cluster, \
+    _Scheduler_priority_SMP_Set_cluster \
+    SCHEDULER_OPERATION_DEFAULT_GET_SET_AFFINITY \
   }
 
 void _Scheduler_priority_SMP_Initialize( void );
@@ -85,6 +151,20 @@ void _Scheduler_priority_SMP_Extract( Thread_Control *thread );
 
 void _Scheduler_priority_SMP_Yield( Thread_Control *thread );
 
+void *_Scheduler_priority_SMP_Allocate( Thread_Control *thread );
+
+void _Scheduler_priority_SMP_Start_idle(
+  Thread_Control *thread,
+  Per_CPU_Control *cpu
+);
+
+uint32_t _Scheduler_priority_SMP_Get_cluster( Thread_Control *thread );
+
+bool _Scheduler_priority_SMP_Set_cluster(
+  Thread_Control *thread,
+  uint32_t cluster
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -69,6 +69,8 @@ extern "C" {
     _Scheduler_default_Release_job, \
     _Scheduler_default_Tick, \
     _Scheduler_SMP_Start_idle \
+    SCHEDULER_OPERATION_DEFAULT_CLUSTER \
+    SCHEDULER_OPERATION_DEFAULT_GET_SET_AFFINITY \
   }
 
 void _Scheduler_simple_smp_Initialize( void );
@@ -24,6 +24,7 @@
 #define _RTEMS_SCORE_SCHEDULERSMP_H
 
 #include <rtems/score/chain.h>
+#include <rtems/score/isrlock.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/thread.h>
 
@@ -39,7 +40,17 @@ extern "C" {
  * @{
  */
 
-typedef struct {
+typedef struct Scheduler_SMP_Control {
+  /**
+   * @brief Protects the scheduled and ready chains of this scheduler
+   * instance.
+   *
+   * The scheduler lock is independent of the Giant lock.  It may be acquired
+   * while a thread queue lock is held and it may be held while a per-CPU
+   * lock is acquired, but not vice versa.
+   */
+  ISR_lock_Control Lock;
+
   Chain_Control scheduled;
   Chain_Control ready[ 1 ];
 } Scheduler_SMP_Control;
@@ -62,7 +62,16 @@ static inline Scheduler_SMP_Control *_Scheduler_SMP_Instance( void )
   return _Scheduler.information;
 }
 
+static inline bool _Scheduler_SMP_Is_processor_owned_by_us(
+  const Scheduler_SMP_Control *self,
+  const Per_CPU_Control *cpu
+)
+{
+  return cpu->scheduler_instance == self;
+}
+
 static inline void _Scheduler_SMP_Allocate_processor(
+  Scheduler_SMP_Control *self,
   Thread_Control *scheduled,
   Thread_Control *victim
 )
@@ -76,7 +85,14 @@ static inline void _Scheduler_SMP_Allocate_processor(
 
   _Per_CPU_Acquire( cpu_of_scheduled );
 
-  if ( scheduled->is_executing ) {
+  /*
+   * An executing thread stays on its processor to avoid a migration.  This is
+   * only possible if the processor belongs to this scheduler instance.
+   */
+  if (
+    scheduled->is_executing
+      && _Scheduler_SMP_Is_processor_owned_by_us( self, cpu_of_scheduled )
+  ) {
     heir = cpu_of_scheduled->heir;
     cpu_of_scheduled->heir = scheduled;
   } else {
@@ -129,6 +145,10 @@ static inline void _Scheduler_SMP_Enqueue_ordered(
   Scheduler_SMP_Move move_from_scheduled_to_ready
 )
 {
+  ISR_Level level;
+
+  _ISR_lock_ISR_disable_and_acquire( &self->Lock, level );
+
   if ( thread->is_in_the_air ) {
     Thread_Control *highest_ready = ( *get_highest_ready )( self );
 
@@ -144,7 +164,7 @@ static inline void _Scheduler_SMP_Enqueue_ordered(
       highest_ready != NULL
         && !( *order )( &thread->Object.Node, &highest_ready->Object.Node )
     ) {
-      _Scheduler_SMP_Allocate_processor( highest_ready, thread );
+      _Scheduler_SMP_Allocate_processor( self, highest_ready, thread );
 
       ( *insert_ready )( self, thread );
       ( *move_from_ready_to_scheduled )( self, highest_ready );
@@ -164,7 +184,7 @@ static inline void _Scheduler_SMP_Enqueue_ordered(
       lowest_scheduled != NULL
         && ( *order )( &thread->Object.Node, &lowest_scheduled->Object.Node )
     ) {
-      _Scheduler_SMP_Allocate_processor( thread, lowest_scheduled );
+      _Scheduler_SMP_Allocate_processor( self, thread, lowest_scheduled );
 
       ( *insert_scheduled )( self, thread );
       ( *move_from_scheduled_to_ready )( self, lowest_scheduled );
@@ -172,6 +192,8 @@ static inline void _Scheduler_SMP_Enqueue_ordered(
       ( *insert_ready )( self, thread );
     }
   }
+
+  _ISR_lock_Release_and_ISR_enable( &self->Lock, level );
 }
 
 static inline void _Scheduler_SMP_Schedule_highest_ready(
@@ -183,7 +205,7 @@ static inline void _Scheduler_SMP_Schedule_highest_ready(
 {
   Thread_Control *highest_ready = ( *get_highest_ready )( self );
 
-  _Scheduler_SMP_Allocate_processor( highest_ready, victim );
+  _Scheduler_SMP_Allocate_processor( self, highest_ready, victim );
 
   ( *move_from_ready_to_scheduled )( self, highest_ready );
 }
@@ -196,6 +218,10 @@ static inline void _Scheduler_SMP_Block(
   Scheduler_SMP_Move move_from_ready_to_scheduled
 )
 {
+  ISR_Level level;
+
+  _ISR_lock_ISR_disable_and_acquire( &self->Lock, level );
+
   ( *extract )( self, thread );
 
   if ( thread->is_in_the_air ) {
@@ -208,6 +234,8 @@ static inline void _Scheduler_SMP_Block(
       move_from_ready_to_scheduled
     );
   }
+
+  _ISR_lock_Release_and_ISR_enable( &self->Lock, level );
 }
 
 static inline void _Scheduler_SMP_Extract(
@@ -216,7 +244,11 @@ static inline void _Scheduler_SMP_Extract(
   Scheduler_SMP_Extract extract
 )
 {
+  ISR_Level level;
+
+  _ISR_lock_ISR_disable_and_acquire( &self->Lock, level );
   ( *extract )( self, thread );
+  _ISR_lock_Release_and_ISR_enable( &self->Lock, level );
 }
 
 static inline void _Scheduler_SMP_Schedule(
@@ -226,6 +258,10 @@ static inline void _Scheduler_SMP_Schedule(
   Scheduler_SMP_Move move_from_ready_to_scheduled
 )
 {
+  ISR_Level level;
+
+  _ISR_lock_ISR_disable_and_acquire( &self->Lock, level );
+
   if ( thread->is_in_the_air ) {
     thread->is_in_the_air = false;
 
@@ -236,6 +272,24 @@ static inline void _Scheduler_SMP_Schedule(
       move_from_ready_to_scheduled
     );
   }
+
+  _ISR_lock_Release_and_ISR_enable( &self->Lock, level );
+}
+
+static inline void _Scheduler_SMP_Start_idle_on_instance(
+  Scheduler_SMP_Control *self,
+  Thread_Control *thread,
+  Per_CPU_Control *cpu
+)
+{
+  ISR_Level level;
+
+  _ISR_lock_ISR_disable_and_acquire( &self->Lock, level );
+  cpu->scheduler_instance = self;
+  thread->is_scheduled = true;
+  thread->cpu = cpu;
+  _Chain_Append_unprotected( &self->scheduled, &thread->Object.Node );
+  _ISR_lock_Release_and_ISR_enable( &self->Lock, level );
 }
 
 static inline void _Scheduler_SMP_Insert_scheduled_lifo(
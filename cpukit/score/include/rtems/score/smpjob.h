@@ -0,0 +1,201 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreSMPJob
+ *
+ * @brief SMP Job Queue API
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifndef _RTEMS_SCORE_SMPJOB_H
+#define _RTEMS_SCORE_SMPJOB_H
+
+#include <rtems/score/cpuopts.h>
+
+#if defined( RTEMS_SMP ) && defined( RTEMS_ATOMIC )
+
+#include <rtems/score/percpu.h>
+#include <rtems/score/atomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup ScoreSMPJob SMP Job Queue Handler
+ *
+ * @ingroup ScoreSMP
+ *
+ * Each processor owns a bounded job queue.  Any processor may post a job to
+ * it, e.g. a request to run a function on this particular processor.  Only
+ * the owner processor removes jobs from its queue.  This happens in the
+ * inter-processor interrupt service via rtems_smp_process_interrupt().
+ *
+ * The queue is an array based ring buffer with a sequence number per slot.
+ * Producers reserve a slot with a compare and exchange on the enqueue
+ * position and publish the job with a release store of the slot sequence
+ * number.  No lock is used.  Several jobs posted in a row are processed
+ * under a single inter-processor interrupt since only the first job after
+ * the last notification of the owner triggers a new interrupt.
+ *
+ * @{
+ */
+
+/**
+ * @brief The count of slots in each job queue.
+ *
+ * This must be a power of two.
+ */
+#define SMP_JOB_QUEUE_SIZE 32
+
+/**
+ * @brief Job handler.
+ *
+ * The job handler runs in interrupt context on the owner processor of the
+ * job queue.  It must not block.
+ *
+ * @param[in] arg The job handler argument.
+ */
+typedef void ( *SMP_Job_handler )( void *arg );
+
+/**
+ * @brief A job queue slot.
+ */
+typedef struct {
+  /**
+   * @brief The slot sequence number.
+   *
+   * The slot is free for the enqueue position equal to the sequence number.
+   * It contains a job for the dequeue position equal to the sequence number
+   * minus one.
+   */
+  Atomic_Ulong sequence;
+
+  /**
+   * @brief The job handler.
+   */
+  SMP_Job_handler handler;
+
+  /**
+   * @brief The job handler argument.
+   */
+  void *arg;
+} SMP_Job_slot;
+
+/**
+ * @brief A processor job queue.
+ */
+typedef struct SMP_Job_queue {
+  /**
+   * @brief The enqueue position shared by all producers.
+   */
+  Atomic_Ulong enqueue_position;
+
+  /**
+   * @brief Indicates that an inter-processor interrupt is on its way to the
+   * owner processor.
+   */
+  Atomic_Ulong notification_pending;
+
+  /**
+   * @brief The dequeue position.
+   *
+   * This field is only used by the owner processor.
+   */
+  unsigned long dequeue_position;
+
+  /**
+   * @brief The job slots.
+   */
+  SMP_Job_slot slots[ SMP_JOB_QUEUE_SIZE ];
+} SMP_Job_queue;
+
+/**
+ * @brief Initializes an empty job queue.
+ *
+ * @param[in] queue The job queue.
+ */
+void _SMP_Job_queue_initialize( SMP_Job_queue *queue );
+
+/**
+ * @brief Posts a job to the job queue of a processor.
+ *
+ * The owner processor will not be notified.  This allows batching of several
+ * jobs under one inter-processor interrupt.
+ *
+ * @param[in] per_cpu The target processor.  It may be the current processor.
+ * @param[in] handler The job handler.
+ * @param[in] arg The job handler argument.
+ *
+ * @retval true The job was posted.
+ * @retval false The job queue is full.
+ *
+ * @see _SMP_Job_notify().
+ */
+bool _SMP_Job_post(
+  Per_CPU_Control *per_cpu,
+  SMP_Job_handler  handler,
+  void            *arg
+);
+
+/**
+ * @brief Notifies a processor that its job queue contains new jobs.
+ *
+ * An inter-processor interrupt is sent only if no notification is pending.
+ *
+ * @param[in] per_cpu The target processor.  It may be the current processor.
+ */
+void _SMP_Job_notify( Per_CPU_Control *per_cpu );
+
+/**
+ * @brief Posts a job to the job queue of a processor and notifies it.
+ *
+ * @param[in] per_cpu The target processor.  It may be the current processor.
+ * @param[in] handler The job handler.
+ * @param[in] arg The job handler argument.
+ *
+ * @retval true The job was posted.
+ * @retval false The job queue is full.
+ */
+RTEMS_INLINE_ROUTINE bool _SMP_Job_submit(
+  Per_CPU_Control *per_cpu,
+  SMP_Job_handler  handler,
+  void            *arg
+)
+{
+  bool posted = _SMP_Job_post( per_cpu, handler, arg );
+
+  if ( posted ) {
+    _SMP_Job_notify( per_cpu );
+  }
+
+  return posted;
+}
+
+/**
+ * @brief Runs the jobs of the job queue of the current processor.
+ *
+ * This function must be called with interrupts disabled on the owner
+ * processor of the job queue.
+ *
+ * @param[in] per_cpu The current processor.
+ */
+void _SMP_Job_process( Per_CPU_Control *per_cpu );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* defined( RTEMS_SMP ) && defined( RTEMS_ATOMIC ) */
+
+#endif /* _RTEMS_SCORE_SMPJOB_H */
@@ -271,10 +271,10 @@ typedef struct {
    */
   uint32_t              return_code;
 
-  /** This field is the chain header for the second through Nth tasks
-   *  of the same priority blocked waiting on the same object.
+  /** This field is the node on the red-black tree of a thread queue
+   *  with priority discipline.
    */
-  Chain_Control         Block2n;
+  RBTree_Node           Node;
   /** This field points to the thread queue on which this thread is blocked. */
   Thread_queue_Control *queue;
 }   Thread_Wait_information;
@@ -20,6 +20,8 @@
 #define _RTEMS_SCORE_THREADQ_H
 
 #include <rtems/score/chain.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/rbtree.h>
 #include <rtems/score/states.h>
 #include <rtems/score/threadsync.h>
 
@@ -47,22 +49,6 @@ typedef enum {
   THREAD_QUEUE_DISCIPLINE_PRIORITY  /* PRIORITY queue discipline */
 }   Thread_queue_Disciplines;
 
-/**
- *  This is one of the constants used to manage the priority queues.
- *
- *  There are four chains used to maintain a priority -- each chain
- *  manages a distinct set of task priorities.  The number of chains
- *  is determined by TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS.
- *  The following set must be consistent.
- *
- *  The set below configures 4 headers -- each contains 64 priorities.
- *  Header x manages priority range (x*64) through ((x*64)+63).  If
- *  the priority is more than half way through the priority range it
- *  is in, then the search is performed from the rear of the chain.
- *  This halves the search time to find the insertion point.
- */
-#define TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS 4
-
 /**
  *  This is the structure used to manage sets of tasks which are blocked
  *  waiting to acquire a resource.
@@ -74,8 +60,12 @@ typedef struct {
   union {
     /** This is the FIFO discipline list. */
     Chain_Control Fifo;
-    /** This is the set of lists for priority discipline waiting. */
-    Chain_Control Priority[TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS];
+    /** This is the red-black tree for priority discipline waiting.  The
+     *  threads are ordered by their current priority.  Threads of equal
+     *  priority are in FIFO order.  The enqueue and extract operations
+     *  need O(log n) time for n waiting threads.
+     */
+    RBTree_Control Priority;
   } Queues;
   /** This field is used to manage the critical section. */
   Thread_blocking_operation_States sync_state;
@@ -89,6 +79,11 @@ typedef struct {
    *  waiting on this thread queue.
    */
   uint32_t                 timeout_status;
+  /** This lock protects the queues and the synchronization state of this
+   *  thread queue.  On SMP configurations operations on different thread
+   *  queues may run in parallel on different processors.
+   */
+  ISR_lock_Control         Lock;
 }   Thread_queue_Control;
 
 /**@}*/
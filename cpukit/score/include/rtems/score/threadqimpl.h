@@ -20,6 +20,7 @@
 #define _RTEMS_SCORE_THREADQIMPL_H
 
 #include <rtems/score/threadq.h>
+#include <rtems/score/chainimpl.h>
 #include <rtems/score/thread.h>
 
 #ifdef __cplusplus
@@ -36,18 +37,6 @@ extern "C" {
  */
 #define THREAD_QUEUE_WAIT_FOREVER  WATCHDOG_NO_TIMEOUT
 
-/**
- *  This is one of the constants used to manage the priority queues.
- *  @ref TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS for more details.
- */
-#define TASK_QUEUE_DATA_PRIORITIES_PER_HEADER      64
-
-/**
- *  This is one of the constants used to manage the priority queues.
- *  @ref TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS for more details.
- */
-#define TASK_QUEUE_DATA_REVERSE_SEARCH_MASK        0x20
-
 /**
  *  The following type defines the callout used when a remote task
  *  is extracted from a local thread queue.
@@ -239,10 +228,12 @@ Thread_Control *_Thread_queue_Dequeue_priority(
  *
  *  @retval This methods returns an indication of the blocking state as
  *          well as filling in *@ level_p with the previous interrupt level.
+ *          In case the blocking operation was already completed, then this
+ *          method returns with interrupts disabled and the thread queue lock
+ *          acquired.
  *
  *  - INTERRUPT LATENCY:
- *    + forward less than
- *    + forward equal
+ *    + red-black tree insert, O(log n) for n waiting threads
  */
 Thread_blocking_operation_States _Thread_queue_Enqueue_priority (
   Thread_queue_Control *the_thread_queue,
@@ -266,6 +257,7 @@ Thread_blocking_operation_States _Thread_queue_Enqueue_priority (
  *  @retval false Otherwise.
  */
 bool _Thread_queue_Extract_priority_helper(
+  Thread_queue_Control *the_thread_queue,
   Thread_Control       *the_thread,
   bool                  requeuing
 );
@@ -276,8 +268,8 @@ bool _Thread_queue_Extract_priority_helper(
  * This macro wraps the underlying call and hides the requeuing argument.
  */
 
-#define _Thread_queue_Extract_priority( _the_thread ) \
-  _Thread_queue_Extract_priority_helper( _the_thread, false )
+#define _Thread_queue_Extract_priority( _the_thread_queue, _the_thread ) \
+  _Thread_queue_Extract_priority_helper( _the_thread_queue, _the_thread, false )
 /**
  *  @brief Get highest priority thread on the_thread_queue.
  *
@@ -322,6 +314,9 @@ Thread_Control *_Thread_queue_Dequeue_fifo(
  *    @param[in] the_thread pointer to the thread to block
  *    @param[in] level_p interrupt level in case the operation blocks actually
  *
+ *  In case the blocking operation was already completed, then this method
+ *  returns with interrupts disabled and the thread queue lock acquired.
+ *
  *  - INTERRUPT LATENCY:
  *    + single case
  */
@@ -338,6 +333,7 @@ Thread_blocking_operation_States _Thread_queue_Enqueue_fifo (
  *  and cancels any timeouts associated with this blocking.
  */
 bool _Thread_queue_Extract_fifo(
+  Thread_queue_Control *the_thread_queue,
   Thread_Control       *the_thread
 );
 
@@ -389,28 +385,32 @@ void _Thread_queue_Process_timeout(
 );
 
 /**
- * This function returns the index of the priority chain on which
- * a thread of the_priority should be placed.
+ *  @brief Compares the thread priorities of two thread queue nodes.
+ *
+ *  This is the compare function of the red-black tree of a thread queue
+ *  with priority discipline.
+ *
+ *  @param[in] left is the node of the thread to insert.
+ *  @param[in] right is the node of a thread on the thread queue.
+ *
+ *  @retval 1 The left thread has a lower priority than the right thread.
+ *  @retval 0 Both threads have the same priority.
+ *  @retval -1 The left thread has a higher priority than the right thread.
  */
-
-RTEMS_INLINE_ROUTINE uint32_t   _Thread_queue_Header_number (
-  Priority_Control the_priority
-)
-{
-  return (the_priority / TASK_QUEUE_DATA_PRIORITIES_PER_HEADER);
-}
+int _Thread_queue_Compare_priority(
+  const RBTree_Node *left,
+  const RBTree_Node *right
+);
 
 /**
- * This function returns true if the_priority indicates that the
- * enqueue search should start at the front of this priority
- * group chain, and false if the search should start at the rear.
+ * This function returns the thread of a thread queue node.
  */
 
-RTEMS_INLINE_ROUTINE bool _Thread_queue_Is_reverse_search (
-  Priority_Control the_priority
+RTEMS_INLINE_ROUTINE Thread_Control *_Thread_queue_Node_to_thread(
+  RBTree_Node *the_node
 )
 {
-  return ( the_priority & TASK_QUEUE_DATA_REVERSE_SEARCH_MASK );
+  return _RBTree_Container_of( the_node, Thread_Control, Wait.Node );
 }
 
 /**
@@ -425,6 +425,28 @@ RTEMS_INLINE_ROUTINE void _Thread_queue_Enter_critical_section (
   the_thread_queue->sync_state = THREAD_BLOCKING_OPERATION_NOTHING_HAPPENED;
 }
 
+/**
+ * This function returns true if no thread waits on the_thread_queue and no
+ * blocking operation is in progress.  The thread queue lock must be held by
+ * the caller.
+ */
+
+RTEMS_INLINE_ROUTINE bool _Thread_queue_Is_idle(
+  const Thread_queue_Control *the_thread_queue
+)
+{
+  bool is_empty;
+
+  if ( the_thread_queue->discipline == THREAD_QUEUE_DISCIPLINE_PRIORITY ) {
+    is_empty = _RBTree_Is_empty( &the_thread_queue->Queues.Priority );
+  } else { /* must be THREAD_QUEUE_DISCIPLINE_FIFO */
+    is_empty = _Chain_Is_empty( &the_thread_queue->Queues.Fifo );
+  }
+
+  return is_empty
+    && the_thread_queue->sync_state == THREAD_BLOCKING_OPERATION_SYNCHRONIZED;
+}
+
 /**@}*/
 
 #ifdef __cplusplus
@@ -153,11 +153,23 @@ typedef struct {
    * @brief Time of day seconds trigger.
    *
    * This value specifies the nanoseconds since the last time of day second.
-   * It is updated and evaluated in _TOD_Tickle_ticks().  It is set in
-   * _TOD_Set_with_timestamp().
+   * It is updated and evaluated in _TOD_Tickle_ticks() and
+   * _TOD_Tickle_nanoseconds().  It is set in _TOD_Set_with_timestamp().
    */
   uint32_t seconds_trigger;
 
+  /**
+   * @brief Nanoseconds since the last tick boundary.
+   *
+   * In tickless mode the clock driver announces elapsed nanoseconds instead
+   * of ticks.  This value specifies the announced nanoseconds which do not
+   * yet add up to a full tick.  It is always less than the nanoseconds per
+   * tick and stays zero if only _TOD_Tickle_ticks() is used.
+   *
+   * This field is protected by the lock.
+   */
+  uint32_t pending_nanoseconds;
+
   /**
    * @brief The current nanoseconds since last tick handler.
    *
@@ -286,6 +298,22 @@ uint32_t _TOD_Seconds_since_epoch( void );
  */
 void _TOD_Tickle_ticks( void );
 
+/**
+ *  @brief Increments time of day by elapsed nanoseconds.
+ *
+ *  This routine is the tickless counterpart of _TOD_Tickle_ticks().  The
+ *  uptime and the current time of day advance by @a nanoseconds.  The
+ *  nanoseconds which do not add up to a full tick are carried over to the
+ *  next call.  The ticks since boot advance by the count of tick boundaries
+ *  crossed and the seconds watchdogs are tickled for each second boundary
+ *  crossed.
+ *
+ *  @param[in] nanoseconds is the time elapsed since the previous call.
+ *
+ *  @return The count of tick boundaries crossed.
+ */
+uint32_t _TOD_Tickle_nanoseconds( uint32_t nanoseconds );
+
 /**
  *  @brief Gets number of ticks in a second.
  *
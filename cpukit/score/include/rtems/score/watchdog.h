@@ -21,6 +21,7 @@
 #define _RTEMS_SCORE_WATCHDOG_H
 
 #include <rtems/score/object.h>
+#include <rtems/score/rbtree.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -81,10 +82,6 @@ typedef Watchdog_Service_routine ( *Watchdog_Service_routine_entry )(
 typedef enum {
   /** This is the state when the watchdog is off all chains */
   WATCHDOG_INACTIVE,
-  /** This is the state when the watchdog is off all chains, but we are
-   *  currently searching for the insertion point.
-   */
-  WATCHDOG_BEING_INSERTED,
   /** This is the state when the watchdog is on a chain, and allowed to fire. */
   WATCHDOG_ACTIVE,
   /** This is the state when the watchdog is on a chain, but we should
@@ -122,8 +119,43 @@ typedef struct {
    *  watchdog handler routine.
    */
   void                           *user_data;
+  /** This field is the node of the watchdog header index.  It is off the
+   *  index tree if the watchdog is not on a watchdog header.
+   */
+  RBTree_Node                     Index_node;
+  /** This field is the expiration time in the time base of the watchdog
+   *  header index.
+   */
+  int64_t                         expire;
 }   Watchdog_Control;
 
+/**
+ *  @brief Routine invoked if a watchdog header has a new first watchdog.
+ *
+ *  A tickless clock driver uses this to program its next event.
+ */
+typedef void ( *Watchdog_First_changed_routine )( void );
+
+/**
+ *  @brief The header of a set of watchdog timers.
+ *
+ *  The watchdog timers are kept on a delta chain ordered by their expiration
+ *  time.  The index tree contains the same watchdog timers ordered by their
+ *  expiration time and yields the insert position on the delta chain in
+ *  logarithmic time.
+ */
+typedef struct {
+  /** This field is the delta chain of the watchdog timers. */
+  Chain_Control                  Watchdogs;
+  /** This field is the index tree of the delta chain. */
+  RBTree_Control                 Index;
+  /** This field is the routine invoked after an insert placed a watchdog
+   *  at the head of the delta chain.  It is invoked with the watchdog lock
+   *  released.  It may be NULL.
+   */
+  Watchdog_First_changed_routine first_changed;
+}   Watchdog_Header;
+
 /**@}*/
 
 #ifdef __cplusplus
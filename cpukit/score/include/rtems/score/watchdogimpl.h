@@ -21,6 +21,7 @@
 
 #include <rtems/score/watchdog.h>
 #include <rtems/score/chainimpl.h>
+#include <rtems/score/isrlock.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -69,20 +70,13 @@ typedef enum {
 } Watchdog_Adjust_directions;
 
 /**
- *  @brief Watchdog synchronization level.
+ *  @brief Watchdog lock.
  *
- *  This used for synchronization purposes
- *  during an insert on a watchdog delta chain.
+ *  This lock protects the watchdog headers.  It is independent of the Giant
+ *  lock, so on SMP configurations timeouts may be inserted and removed
+ *  without thread dispatching disabled.
  */
-SCORE_EXTERN volatile uint32_t    _Watchdog_Sync_level;
-
-/**
- *  @brief Watchdog synchronization count.
- *
- *  This used for synchronization purposes
- *  during an insert on a watchdog delta chain.
- */
-SCORE_EXTERN volatile uint32_t    _Watchdog_Sync_count;
+SCORE_EXTERN ISR_lock_Control _Watchdog_Lock;
 
 /**
  *  @brief The number of ticks since the system was booted.
@@ -93,28 +87,34 @@ SCORE_EXTERN volatile uint32_t    _Watchdog_Sync_count;
 SCORE_EXTERN volatile Watchdog_Interval _Watchdog_Ticks_since_boot;
 
 /**
- *  @brief Watchdog chain which is managed at ticks.
+ *  @brief Watchdog header which is managed at ticks.
  *
- *  This is the watchdog chain which is managed at ticks.
+ *  This is the watchdog header which is managed at ticks.
  */
-SCORE_EXTERN Chain_Control _Watchdog_Ticks_chain;
+SCORE_EXTERN Watchdog_Header _Watchdog_Ticks_header;
 
 /**
- *  @brief Watchdog chain which is managed at second boundaries.
+ *  @brief Watchdog header which is managed at second boundaries.
  *
- *  This is the watchdog chain which is managed at second boundaries.
+ *  This is the watchdog header which is managed at second boundaries.
  */
-SCORE_EXTERN Chain_Control _Watchdog_Seconds_chain;
+SCORE_EXTERN Watchdog_Header _Watchdog_Seconds_header;
 
 /**
  *  @brief Initialize the watchdog handler.
  *
- *  This routine initializes the watchdog handler.  The watchdog
- *  synchronization flag is initialized and the watchdog chains are
- *  initialized and emptied.
+ *  This routine initializes the watchdog handler.  The ticks and seconds
+ *  watchdog headers are initialized and emptied.
  */
 void _Watchdog_Handler_initialization( void );
 
+/**
+ *  @brief Initializes an empty watchdog header.
+ *
+ *  @param[in] header is the watchdog header to initialize
+ */
+void _Watchdog_Header_initialize( Watchdog_Header *header );
+
 /**
  *  @brief Removes @a the_watchdog from the watchdog chain.
  *
@@ -128,6 +128,19 @@ Watchdog_States _Watchdog_Remove (
   Watchdog_Control *the_watchdog
 );
 
+/**
+ *  @brief Removes @a the_watchdog from the watchdog chain.
+ *
+ *  This routine is the body of _Watchdog_Remove().  The watchdog lock must be
+ *  held by the caller.
+ *
+ *  @param[in] the_watchdog will be removed
+ *  @retval the state in which @a the_watchdog was in when removed
+ */
+Watchdog_States _Watchdog_Remove_it (
+  Watchdog_Control *the_watchdog
+);
+
 /**
  *  @brief Adjusts the @a header watchdog chain in the forward
  *  or backward @a direction for @a units ticks.
@@ -135,12 +148,12 @@ Watchdog_States _Watchdog_Remove (
  *  This routine adjusts the @a header watchdog chain in the forward
  *  or backward @a direction for @a units ticks.
  *
- *  @param[in] header is the watchdog chain to adjust
+ *  @param[in] header is the watchdog header to adjust
  *  @param[in] direction is the direction to adjust @a header
  *  @param[in] units is the number of units to adjust @a header
  */
 void _Watchdog_Adjust (
-  Chain_Control              *header,
+  Watchdog_Header            *header,
   Watchdog_Adjust_directions  direction,
   Watchdog_Interval           units
 );
@@ -152,7 +165,7 @@ void _Watchdog_Adjust (
  *  This routine adjusts the @a header watchdog chain in the forward
  *  @a direction for @a units_arg ticks.
  *
- *  @param[in] header is the watchdog chain to adjust
+ *  @param[in] header is the watchdog header to adjust
  *  @param[in] units_arg is the number of units to adjust @a header
  *  @param[in] to_fire is a pointer to an initialized Chain_Control to which
  *             all watchdog instances that are to be fired will be placed.
@@ -160,7 +173,7 @@ void _Watchdog_Adjust (
  *  @note This always adjusts forward.
  */
 void _Watchdog_Adjust_to_chain(
-  Chain_Control               *header,
+  Watchdog_Header             *header,
   Watchdog_Interval            units_arg,
   Chain_Control               *to_fire
 
@@ -172,13 +185,15 @@ void _Watchdog_Adjust_to_chain(
  *
  *  This routine inserts @a the_watchdog into the @a header watchdog chain
  *  for a time of @a units.
- *  Update the delta interval counters.
+ *  Update the delta interval counters.  The insert position is determined
+ *  by the index tree of @a header, so the time to insert is logarithmic in
+ *  the number of watchdogs on @a header.
  *
- *  @param[in] header is @a the_watchdog list to insert @a the_watchdog on
+ *  @param[in] header is @a the_watchdog header to insert @a the_watchdog on
  *  @param[in] the_watchdog is the watchdog to insert
  */
 void _Watchdog_Insert (
-  Chain_Control         *header,
+  Watchdog_Header       *header,
   Watchdog_Control      *the_watchdog
 );
 
@@ -190,10 +205,10 @@ void _Watchdog_Insert (
  *  the @a header watchdog chain.
  *  This routine decrements the delta counter in response to a tick.
  *
- *  @param[in] header is the watchdog chain to tickle
+ *  @param[in] header is the watchdog header to tickle
  */
 void _Watchdog_Tickle (
-  Chain_Control *header
+  Watchdog_Header *header
 );
 
 /**
@@ -224,7 +239,7 @@ void _Watchdog_Report(
  *
  *  @param[in] name is a string to prefix the line with.  If NULL,
  *             nothing is printed.
- *  @param[in] header is the watchdog chain to be printed.
+ *  @param[in] header is the watchdog header to be printed.
  *
  *  @note This is a debug routine.  It uses printk() and prudence should
  *        exercised when using it.  It also disables interrupts so the
@@ -232,7 +247,7 @@ void _Watchdog_Report(
  */
 void _Watchdog_Report_chain(
   const char        *name,
-  Chain_Control     *header
+  Watchdog_Header   *header
 );
 
 /**
@@ -304,7 +319,7 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Deactivate(
 RTEMS_INLINE_ROUTINE void _Watchdog_Tickle_ticks( void )
 {
 
-  _Watchdog_Tickle( &_Watchdog_Ticks_chain );
+  _Watchdog_Tickle( &_Watchdog_Ticks_header );
 
 }
 
@@ -316,7 +331,7 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Tickle_ticks( void )
 RTEMS_INLINE_ROUTINE void _Watchdog_Tickle_seconds( void )
 {
 
-  _Watchdog_Tickle( &_Watchdog_Seconds_chain );
+  _Watchdog_Tickle( &_Watchdog_Seconds_header );
 
 }
 
@@ -335,7 +350,7 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Insert_ticks(
 
   the_watchdog->initial = units;
 
-  _Watchdog_Insert( &_Watchdog_Ticks_chain, the_watchdog );
+  _Watchdog_Insert( &_Watchdog_Ticks_header, the_watchdog );
 
 }
 
@@ -354,7 +369,7 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Insert_seconds(
 
   the_watchdog->initial = units;
 
-  _Watchdog_Insert( &_Watchdog_Seconds_chain, the_watchdog );
+  _Watchdog_Insert( &_Watchdog_Seconds_header, the_watchdog );
 
 }
 
@@ -370,7 +385,7 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Adjust_seconds(
 )
 {
 
-  _Watchdog_Adjust( &_Watchdog_Seconds_chain, direction, units );
+  _Watchdog_Adjust( &_Watchdog_Seconds_header, direction, units );
 
 }
 
@@ -385,7 +400,7 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Adjust_ticks(
 )
 {
 
-  _Watchdog_Adjust( &_Watchdog_Ticks_chain, direction, units );
+  _Watchdog_Adjust( &_Watchdog_Ticks_header, direction, units );
 
 }
 
@@ -403,7 +418,7 @@ RTEMS_INLINE_ROUTINE void _Watchdog_Reset(
 
   (void) _Watchdog_Remove( the_watchdog );
 
-  _Watchdog_Insert( &_Watchdog_Ticks_chain, the_watchdog );
+  _Watchdog_Insert( &_Watchdog_Ticks_header, the_watchdog );
 
 }
 
@@ -435,32 +450,67 @@ RTEMS_INLINE_ROUTINE Watchdog_Control *_Watchdog_Previous(
 
 }
 
+/**
+ * This routine returns true if the watchdog header HEADER contains no
+ * watchdog timers, and false otherwise.
+ */
+
+RTEMS_INLINE_ROUTINE bool _Watchdog_Is_empty(
+  const Watchdog_Header *header
+)
+{
+
+  return _Chain_Is_empty( &header->Watchdogs );
+
+}
+
 /**
  * This routine returns a pointer to the first watchdog timer
- * on the watchdog chain HEADER.
+ * on the watchdog header HEADER.
  */
 
 RTEMS_INLINE_ROUTINE Watchdog_Control *_Watchdog_First(
-  Chain_Control *header
+  Watchdog_Header *header
 )
 {
 
-  return ( (Watchdog_Control *) _Chain_First( header ) );
+  return ( (Watchdog_Control *) _Chain_First( &header->Watchdogs ) );
 
 }
 
 /**
  * This routine returns a pointer to the last watchdog timer
- * on the watchdog chain HEADER.
+ * on the watchdog header HEADER.
  */
 
 RTEMS_INLINE_ROUTINE Watchdog_Control *_Watchdog_Last(
-  Chain_Control *header
+  Watchdog_Header *header
 )
 {
 
-  return ( (Watchdog_Control *) _Chain_Last( header ) );
+  return ( (Watchdog_Control *) _Chain_Last( &header->Watchdogs ) );
+
+}
 
+/**
+ * This routine removes THE_WATCHDOG from the index tree of its watchdog
+ * header.  Nothing happens if THE_WATCHDOG is not on an index tree, e.g.
+ * if it was moved to a chain of watchdogs to fire.  The watchdog lock must
+ * be held by the caller.
+ */
+
+RTEMS_INLINE_ROUTINE void _Watchdog_Index_extract(
+  Watchdog_Control *the_watchdog
+)
+{
+  RBTree_Node *node = &the_watchdog->Index_node;
+
+  if ( !_RBTree_Is_node_off_rbtree( node ) ) {
+    _RBTree_Extract_unprotected(
+      _RBTree_Find_header_unprotected( node ),
+      node
+    );
+  }
 }
 
 /** @} */
@@ -108,6 +108,7 @@ bool _CORE_message_queue_Initialize(
   );
 
   _Chain_Initialize_empty( &the_message_queue->Pending_messages );
+  _CORE_message_queue_Initialize_priority_groups( the_message_queue );
 
   _Thread_queue_Initialize(
     &the_message_queue->Wait_queue,
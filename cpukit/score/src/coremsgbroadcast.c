@@ -66,6 +66,30 @@ CORE_message_queue_Status _CORE_message_queue_Broadcast(
   while ((the_thread =
           _Thread_queue_Dequeue(&the_message_queue->Wait_queue))) {
     waitp = &the_thread->Wait;
+
+    if ( _CORE_message_queue_Is_buffer_receiver( the_thread ) ) {
+      CORE_message_queue_Buffer_control *the_message;
+
+      the_message =
+        _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+      if ( !the_message ) {
+        waitp->return_code = CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
+        continue;
+      }
+
+      _CORE_message_queue_Copy_buffer(
+        buffer,
+        the_message->Contents.buffer,
+        size
+      );
+      the_message->Contents.size = size;
+      _CORE_message_queue_Set_buffer_owned( the_message );
+      *(CORE_message_queue_Buffer_control **) waitp->return_argument =
+        the_message;
+      number_broadcasted += 1;
+      continue;
+    }
+
     number_broadcasted += 1;
 
     _CORE_message_queue_Copy_buffer(
@@ -76,6 +76,7 @@ uint32_t   _CORE_message_queue_Flush_support(
     message_queue_first->previous = inactive_head;
 
     _Chain_Initialize_empty( &the_message_queue->Pending_messages );
+    _CORE_message_queue_Initialize_priority_groups( the_message_queue );
 
     count = the_message_queue->number_of_pending_messages;
     the_message_queue->number_of_pending_messages = 0;
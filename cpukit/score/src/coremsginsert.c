@@ -25,6 +25,110 @@
 #include <rtems/score/thread.h>
 #include <rtems/score/wkspace.h>
 
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+static bool _CORE_message_queue_Is_priority_group_used(
+  const CORE_message_queue_Control *the_message_queue,
+  uint32_t                          group
+)
+{
+  return ( the_message_queue->priority_map[ group / 32 ]
+    & ( (uint32_t) 1 << ( group % 32 ) ) ) != 0;
+}
+
+static void _CORE_message_queue_Set_priority_group_last(
+  CORE_message_queue_Control        *the_message_queue,
+  uint32_t                           group,
+  CORE_message_queue_Buffer_control *the_message
+)
+{
+  the_message_queue->priority_map[ group / 32 ] |=
+    (uint32_t) 1 << ( group % 32 );
+  the_message_queue->priority_group_last[ group ] = the_message;
+}
+
+/*
+ *  The search for the insert position starts at the last message of the
+ *  nearest non-empty group of a lower or equal priority.  The pending
+ *  messages of a group are contiguous and have all the same priority, so the
+ *  search passes over messages without a group only.  The look up of the
+ *  start position visits at most CORE_MESSAGE_QUEUE_PRIORITY_MAP_SIZE words
+ *  of the bit map and is independent of the count of pending messages.
+ */
+static void _CORE_message_queue_Insert_by_priority(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message,
+  uint32_t                           group
+)
+{
+  Chain_Control *the_header;
+  Chain_Node    *previous;
+  Chain_Node    *the_node;
+  int            the_priority;
+  uint32_t       start_group;
+  uint32_t       index;
+  uint32_t       map;
+
+  the_header = &the_message_queue->Pending_messages;
+  previous = _Chain_Head( the_header );
+  the_priority = _CORE_message_queue_Get_message_priority( the_message );
+
+  if ( group < CORE_MESSAGE_QUEUE_PRIORITY_GROUP_COUNT ) {
+    start_group = group;
+  } else if ( the_priority > 0 ) {
+    start_group = CORE_MESSAGE_QUEUE_PRIORITY_GROUP_COUNT - 1;
+  } else {
+    start_group = 0;
+  }
+
+  index = start_group / 32;
+  map = the_message_queue->priority_map[ index ]
+    & ( ( (uint32_t) 2 << ( start_group % 32 ) ) - 1 );
+
+  while ( true ) {
+    if ( map != 0 ) {
+      uint32_t previous_group = index * 32
+        + (uint32_t) ( 8 * sizeof( unsigned long ) - 1 )
+        - (uint32_t) __builtin_clzl( (unsigned long) map );
+
+      previous =
+        &the_message_queue->priority_group_last[ previous_group ]->Node;
+      break;
+    }
+
+    if ( index == 0 )
+      break;
+
+    --index;
+    map = the_message_queue->priority_map[ index ];
+  }
+
+  the_node = _Chain_Next( previous );
+  while ( !_Chain_Is_tail( the_header, the_node ) ) {
+    CORE_message_queue_Buffer_control *this_message;
+
+    this_message = (CORE_message_queue_Buffer_control *) the_node;
+
+    if ( _CORE_message_queue_Get_message_priority( this_message )
+           > the_priority ) {
+      break;
+    }
+
+    previous = the_node;
+    the_node = _Chain_Next( the_node );
+  }
+
+  _Chain_Insert_unprotected( previous, &the_message->Node );
+
+  if ( group < CORE_MESSAGE_QUEUE_PRIORITY_GROUP_COUNT ) {
+    _CORE_message_queue_Set_priority_group_last(
+      the_message_queue,
+      group,
+      the_message
+    );
+  }
+}
+#endif
+
 void _CORE_message_queue_Insert_message(
   CORE_message_queue_Control        *the_message_queue,
   CORE_message_queue_Buffer_control *the_message,
@@ -55,44 +159,39 @@ void _CORE_message_queue_Insert_message(
         _CORE_message_queue_Prepend_unprotected(the_message_queue, the_message);
     _ISR_Enable( level );
   #else
-    if ( submit_type == CORE_MESSAGE_QUEUE_SEND_REQUEST ) {
-      _ISR_Disable( level );
-        SET_NOTIFY();
-        the_message_queue->number_of_pending_messages++;
-        _CORE_message_queue_Append_unprotected(the_message_queue, the_message);
-      _ISR_Enable( level );
-    } else if ( submit_type == CORE_MESSAGE_QUEUE_URGENT_REQUEST ) {
-      _ISR_Disable( level );
-        SET_NOTIFY();
-        the_message_queue->number_of_pending_messages++;
-        _CORE_message_queue_Prepend_unprotected(the_message_queue, the_message);
-      _ISR_Enable( level );
-    } else {
-      CORE_message_queue_Buffer_control *this_message;
-      Chain_Node                        *the_node;
-      Chain_Control                     *the_header;
-      int                                the_priority;
-
-      the_priority = _CORE_message_queue_Get_message_priority(the_message);
-      the_header = &the_message_queue->Pending_messages;
-      the_node = _Chain_First( the_header );
-      while ( !_Chain_Is_tail( the_header, the_node ) ) {
-        int this_priority;
-
-        this_message = (CORE_message_queue_Buffer_control *) the_node;
+    {
+      uint32_t group;
 
-        this_priority = _CORE_message_queue_Get_message_priority(this_message);
+      group = _CORE_message_queue_Get_priority_group( submit_type );
 
-        if ( this_priority <= the_priority ) {
-          the_node = the_node->next;
-          continue;
-        }
-        break;
-      }
       _ISR_Disable( level );
         SET_NOTIFY();
         the_message_queue->number_of_pending_messages++;
-        _Chain_Insert_unprotected( the_node->previous, &the_message->Node );
+        if ( submit_type == CORE_MESSAGE_QUEUE_SEND_REQUEST ) {
+          _CORE_message_queue_Append_unprotected(the_message_queue, the_message);
+        } else if ( group == 0 ) {
+          /*
+           *  Urgent messages are prepended, so the first urgent message
+           *  stays the last message of its group.
+           */
+          if ( !_CORE_message_queue_Is_priority_group_used(
+            the_message_queue,
+            group
+          ) ) {
+            _CORE_message_queue_Set_priority_group_last(
+              the_message_queue,
+              group,
+              the_message
+            );
+          }
+          _CORE_message_queue_Prepend_unprotected(the_message_queue, the_message);
+        } else {
+          _CORE_message_queue_Insert_by_priority(
+            the_message_queue,
+            the_message,
+            group
+          );
+        }
       _ISR_Enable( level );
     }
   #endif
@@ -0,0 +1,83 @@
+/**
+ *  @file
+ *
+ *  @brief Release a Message Buffer to the Message Queue
+ *  @ingroup ScoreMessageQueue
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/thread.h>
+
+void _CORE_message_queue_Release_buffer(
+  CORE_message_queue_Control        *the_message_queue,
+  CORE_message_queue_Buffer_control *the_message
+)
+{
+  #if !defined(RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND)
+    /*
+     *  There is not an API with blocking sends enabled.
+     *  So free the buffer immediately.
+     */
+    _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+  #else
+    Thread_Control *the_thread;
+    ISR_Level       level;
+
+    /*
+     *  There could be a thread waiting to send a message.  If there
+     *  is not, then we can go ahead and free the buffer.  A message
+     *  buffer may be released while threads wait to receive from the
+     *  empty message queue, these must stay blocked.
+     */
+    _ISR_Disable( level );
+    the_thread = _Thread_queue_First( &the_message_queue->Wait_queue );
+    if ( the_thread && _CORE_message_queue_Is_blocked_sender( the_thread ) )
+      the_thread = _Thread_queue_Dequeue( &the_message_queue->Wait_queue );
+    else
+      the_thread = NULL;
+    _ISR_Enable( level );
+
+    if ( !the_thread ) {
+      _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+      return;
+    }
+
+    /*
+     *  There was a thread waiting to send a message.  This code
+     *  puts the messages in the message queue on behalf of the
+     *  waiting task.
+     */
+    _CORE_message_queue_Set_message_priority(
+      the_message,
+      the_thread->Wait.count
+    );
+    the_message->Contents.size = (size_t) the_thread->Wait.option;
+    _CORE_message_queue_Copy_buffer(
+      the_thread->Wait.return_argument_second.immutable_object,
+      the_message->Contents.buffer,
+      the_message->Contents.size
+    );
+
+    the_thread->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+
+    _CORE_message_queue_Insert_message(
+       the_message_queue,
+       the_message,
+       _CORE_message_queue_Get_message_priority( the_message )
+    );
+  #endif
+}
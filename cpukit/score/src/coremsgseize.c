@@ -54,57 +54,8 @@ void _CORE_message_queue_Seize(
       *size_p
     );
 
-    #if !defined(RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND)
-      /*
-       *  There is not an API with blocking sends enabled.
-       *  So return immediately.
-       */
-      _CORE_message_queue_Free_message_buffer(the_message_queue, the_message);
-      return;
-    #else
-    {
-      Thread_Control   *the_thread;
-
-      /*
-       *  There could be a thread waiting to send a message.  If there
-       *  is not, then we can go ahead and free the buffer.
-       *
-       *  NOTE: If we note that the queue was not full before this receive,
-       *  then we can avoid this dequeue.
-       */
-      the_thread = _Thread_queue_Dequeue( &the_message_queue->Wait_queue );
-      if ( !the_thread ) {
-        _CORE_message_queue_Free_message_buffer(
-          the_message_queue,
-          the_message
-        );
-        return;
-      }
-
-      /*
-       *  There was a thread waiting to send a message.  This code
-       *  puts the messages in the message queue on behalf of the
-       *  waiting task.
-       */
-      _CORE_message_queue_Set_message_priority(
-        the_message,
-        the_thread->Wait.count
-      );
-      the_message->Contents.size = (size_t) the_thread->Wait.option;
-      _CORE_message_queue_Copy_buffer(
-        the_thread->Wait.return_argument_second.immutable_object,
-        the_message->Contents.buffer,
-        the_message->Contents.size
-      );
-
-      _CORE_message_queue_Insert_message(
-         the_message_queue,
-         the_message,
-         _CORE_message_queue_Get_message_priority( the_message )
-      );
-      return;
-    }
-    #endif
+    _CORE_message_queue_Release_buffer( the_message_queue, the_message );
+    return;
   }
 
   if ( !wait ) {
@@ -0,0 +1,70 @@
+/**
+ *  @file
+ *
+ *  @brief Seize a Message Buffer from the Message Queue
+ *  @ingroup ScoreMessageQueue
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/isr.h>
+#include <rtems/score/thread.h>
+
+void _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control         *the_message_queue,
+  Thread_Control                     *executing,
+  Objects_Id                          id,
+  CORE_message_queue_Buffer_control **the_message_p,
+  bool                                wait,
+  Watchdog_Interval                   timeout
+)
+{
+  ISR_Level                          level;
+  CORE_message_queue_Buffer_control *the_message;
+
+  executing->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+  _ISR_Disable( level );
+  the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+  if ( the_message != NULL ) {
+    the_message_queue->number_of_pending_messages -= 1;
+    _ISR_Enable( level );
+
+    _CORE_message_queue_Set_buffer_owned( the_message );
+    *the_message_p = the_message;
+    executing->Wait.count =
+      _CORE_message_queue_Get_message_priority( the_message );
+    return;
+  }
+
+  if ( !wait ) {
+    _ISR_Enable( level );
+    executing->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_UNSATISFIED_NOWAIT;
+    return;
+  }
+
+  /*
+   *  A NULL receive buffer tells the sender to hand over the message buffer
+   *  instead of a copy of the message.
+   */
+  _Thread_queue_Enter_critical_section( &the_message_queue->Wait_queue );
+  executing->Wait.queue = &the_message_queue->Wait_queue;
+  executing->Wait.id = id;
+  executing->Wait.return_argument_second.mutable_object = NULL;
+  executing->Wait.return_argument = the_message_p;
+  /* Wait.count will be filled in with the message priority */
+  _ISR_Enable( level );
+
+  _Thread_queue_Enqueue( &the_message_queue->Wait_queue, executing, timeout );
+}
@@ -53,6 +53,32 @@ CORE_message_queue_Status _CORE_message_queue_Submit(
   if ( the_message_queue->number_of_pending_messages == 0 ) {
     the_thread = _Thread_queue_Dequeue( &the_message_queue->Wait_queue );
     if ( the_thread ) {
+      if ( _CORE_message_queue_Is_buffer_receiver( the_thread ) ) {
+        /*
+         *  The receiver wants a message buffer.  All message buffers may be
+         *  owned by the application, in this case the receive fails as well.
+         */
+        the_message =
+          _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+        if ( !the_message ) {
+          the_thread->Wait.return_code = CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
+          return CORE_MESSAGE_QUEUE_STATUS_TOO_MANY;
+        }
+
+        _CORE_message_queue_Copy_buffer(
+          buffer,
+          the_message->Contents.buffer,
+          size
+        );
+        the_message->Contents.size = size;
+        _CORE_message_queue_Set_message_priority( the_message, submit_type );
+        _CORE_message_queue_Set_buffer_owned( the_message );
+        *(CORE_message_queue_Buffer_control **)
+          the_thread->Wait.return_argument = the_message;
+        the_thread->Wait.count = (uint32_t) submit_type;
+        return CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+      }
+
       _CORE_message_queue_Copy_buffer(
         buffer,
         the_thread->Wait.return_argument_second.mutable_object,
@@ -125,6 +151,7 @@ CORE_message_queue_Status _CORE_message_queue_Submit(
       _Thread_queue_Enter_critical_section( &the_message_queue->Wait_queue );
       executing->Wait.queue = &the_message_queue->Wait_queue;
       executing->Wait.id = id;
+      executing->Wait.return_argument = NULL;
       executing->Wait.return_argument_second.immutable_object = buffer;
       executing->Wait.option = (uint32_t) size;
       executing->Wait.count = submit_type;
@@ -0,0 +1,89 @@
+/**
+ *  @file
+ *
+ *  @brief Submit a Message Buffer to the Message Queue
+ *  @ingroup ScoreMessageQueue
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/coremsgimpl.h>
+#include <rtems/score/objectimpl.h>
+
+CORE_message_queue_Status _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control                *the_message_queue,
+  CORE_message_queue_Buffer_control         *the_message,
+  size_t                                     size,
+  #if defined(RTEMS_MULTIPROCESSING)
+    Objects_Id                                 id,
+    CORE_message_queue_API_mp_support_callout  api_message_queue_mp_support,
+  #else
+    Objects_Id                                 id __attribute__((unused)),
+    CORE_message_queue_API_mp_support_callout  api_message_queue_mp_support __attribute__((unused)),
+  #endif
+  CORE_message_queue_Submit_types            submit_type
+)
+{
+  Thread_Control *the_thread;
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    return CORE_MESSAGE_QUEUE_STATUS_INVALID_SIZE;
+  }
+
+  the_message->Contents.size = size;
+  _CORE_message_queue_Set_message_priority( the_message, submit_type );
+
+  /*
+   *  Is there a thread currently waiting on this message queue?
+   */
+  if ( the_message_queue->number_of_pending_messages == 0 ) {
+    the_thread = _Thread_queue_Dequeue( &the_message_queue->Wait_queue );
+    if ( the_thread ) {
+      if ( _CORE_message_queue_Is_buffer_receiver( the_thread ) ) {
+        *(CORE_message_queue_Buffer_control **)
+          the_thread->Wait.return_argument = the_message;
+      } else {
+        _CORE_message_queue_Copy_buffer(
+          the_message->Contents.buffer,
+          the_thread->Wait.return_argument_second.mutable_object,
+          size
+        );
+        *(size_t *) the_thread->Wait.return_argument = size;
+        _CORE_message_queue_Free_message_buffer(
+          the_message_queue,
+          the_message
+        );
+
+        #if defined(RTEMS_MULTIPROCESSING)
+          if ( !_Objects_Is_local_id( the_thread->Object.id ) )
+            (*api_message_queue_mp_support) ( the_thread, id );
+        #endif
+      }
+
+      the_thread->Wait.count = (uint32_t) submit_type;
+      return CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+    }
+  }
+
+  /*
+   *  No one waiting on the message queue at this time, so queue the message
+   *  buffer up for a future receive.
+   */
+  _CORE_message_queue_Insert_message(
+     the_message_queue,
+     the_message,
+     submit_type
+  );
+  return CORE_MESSAGE_QUEUE_STATUS_SUCCESSFUL;
+}
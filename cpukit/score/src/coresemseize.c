@@ -37,10 +37,10 @@ void _CORE_semaphore_Seize(
   ISR_Level       level;
 
   executing->Wait.return_code = CORE_SEMAPHORE_STATUS_SUCCESSFUL;
-  _ISR_Disable( level );
+  _ISR_lock_ISR_disable_and_acquire( &the_semaphore->Wait_queue.Lock, level );
   if ( the_semaphore->count != 0 ) {
     the_semaphore->count -= 1;
-    _ISR_Enable( level );
+    _ISR_lock_Release_and_ISR_enable( &the_semaphore->Wait_queue.Lock, level );
     return;
   }
 
@@ -50,7 +50,7 @@ void _CORE_semaphore_Seize(
    *  the semaphore was not available and the caller never blocked.
    */
   if ( !wait ) {
-    _ISR_Enable( level );
+    _ISR_lock_Release_and_ISR_enable( &the_semaphore->Wait_queue.Lock, level );
     executing->Wait.return_code = CORE_SEMAPHORE_STATUS_UNSATISFIED_NOWAIT;
     return;
   }
@@ -62,7 +62,7 @@ void _CORE_semaphore_Seize(
   _Thread_queue_Enter_critical_section( &the_semaphore->Wait_queue );
   executing->Wait.queue = &the_semaphore->Wait_queue;
   executing->Wait.id    = id;
-  _ISR_Enable( level );
+  _ISR_lock_Release_and_ISR_enable( &the_semaphore->Wait_queue.Lock, level );
   _Thread_queue_Enqueue( &the_semaphore->Wait_queue, executing, timeout );
 }
 #endif
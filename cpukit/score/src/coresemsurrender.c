@@ -42,12 +42,12 @@ CORE_semaphore_Status _CORE_semaphore_Surrender(
 #endif
 
   } else {
-    _ISR_Disable( level );
+    _ISR_lock_ISR_disable_and_acquire( &the_semaphore->Wait_queue.Lock, level );
       if ( the_semaphore->count < the_semaphore->Attributes.maximum_count )
         the_semaphore->count += 1;
       else
         status = CORE_SEMAPHORE_MAXIMUM_COUNT_EXCEEDED;
-    _ISR_Enable( level );
+    _ISR_lock_Release_and_ISR_enable( &the_semaphore->Wait_queue.Lock, level );
   }
 
   return status;
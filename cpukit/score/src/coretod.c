@@ -35,6 +35,8 @@ void _TOD_Handler_initialization(void)
 
   _Timestamp_Set_to_zero( &tod->uptime );
 
+  tod->pending_nanoseconds = 0;
+
   tod->nanoseconds_since_last_tick =
     _TOD_Nanoseconds_since_tick_default_handler;
 
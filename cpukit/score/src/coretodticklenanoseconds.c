@@ -0,0 +1,79 @@
+/**
+ * @file
+ *
+ * @brief Increments time of day by elapsed nanoseconds
+ *
+ * @ingroup ScoreTOD
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/todimpl.h>
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/config.h>
+
+uint32_t _TOD_Tickle_nanoseconds( uint32_t nanoseconds )
+{
+  TOD_Control       *tod = &_TOD;
+  ISR_Level          level;
+  Timestamp_Control  elapsed;
+  uint32_t           nanoseconds_per_tick;
+  uint64_t           pending;
+  uint64_t           seconds_trigger;
+  uint32_t           ticks;
+  uint32_t           seconds;
+
+  nanoseconds_per_tick = rtems_configuration_get_nanoseconds_per_tick();
+
+  /* Convert the elapsed time to a timestamp */
+  _Timestamp_Set(
+    &elapsed,
+    nanoseconds / TOD_NANOSECONDS_PER_SECOND,
+    nanoseconds % TOD_NANOSECONDS_PER_SECOND
+  );
+
+  _TOD_Acquire( tod, level );
+
+  /* Update the uptime */
+  _Timestamp_Add_to( &tod->uptime, &elapsed );
+
+  /* Update the current TOD */
+  _Timestamp_Add_to( &tod->now, &elapsed );
+
+  /* Carry over the nanoseconds which do not add up to a full tick */
+  pending = (uint64_t) tod->pending_nanoseconds + nanoseconds;
+  ticks = (uint32_t) ( pending / nanoseconds_per_tick );
+  tod->pending_nanoseconds = (uint32_t) ( pending % nanoseconds_per_tick );
+
+  _TOD_Release( tod, level );
+
+  /* Update the counter of ticks since boot */
+  _Watchdog_Ticks_since_boot += ticks;
+
+  /*
+   *  The seconds trigger is updated before the seconds watchdogs are
+   *  tickled, since a watchdog routine may set the time of day.
+   */
+  seconds_trigger = (uint64_t) tod->seconds_trigger + nanoseconds;
+  seconds = (uint32_t) ( seconds_trigger / TOD_NANOSECONDS_PER_SECOND );
+  tod->seconds_trigger =
+    (uint32_t) ( seconds_trigger % TOD_NANOSECONDS_PER_SECOND );
+
+  while ( seconds > 0 ) {
+    _Watchdog_Tickle_seconds();
+    --seconds;
+  }
+
+  return ticks;
+}
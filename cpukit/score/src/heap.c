@@ -336,17 +336,22 @@ static void _Heap_Block_split(
     stats->free_size += free_block_size;
 
     if ( _Heap_Is_used( next_block ) ) {
-      _Heap_Free_list_insert_after( free_list_anchor, free_block );
+      _Heap_Free_block_insert(
+        heap,
+        free_list_anchor,
+        free_block,
+        free_block_size
+      );
 
       /* Statistics */
       ++stats->free_blocks;
     } else {
       uintptr_t const next_block_size = _Heap_Block_size( next_block );
 
-      _Heap_Free_list_replace( next_block, free_block );
-
       free_block_size += next_block_size;
 
+      _Heap_Free_block_replace( heap, next_block, free_block, free_block_size );
+
       next_block = _Heap_Block_at( free_block, free_block_size );
     }
 
@@ -402,7 +407,7 @@ static Heap_Block *_Heap_Block_allocate_from_end(
   stats->free_size += block_size;
 
   if ( _Heap_Is_prev_used( block ) ) {
-    _Heap_Free_list_insert_after( free_list_anchor, block );
+    _Heap_Free_block_insert( heap, free_list_anchor, block, block_size );
 
     free_list_anchor = block;
 
@@ -414,6 +419,8 @@ static Heap_Block *_Heap_Block_allocate_from_end(
 
     block = prev_block;
     block_size += prev_block_size;
+
+    _Heap_Free_block_resize( heap, block, block_size );
   }
 
   block->size_and_flag = block_size | HEAP_PREV_BLOCK_USED;
@@ -445,7 +452,7 @@ Heap_Block *_Heap_Block_allocate(
   if ( _Heap_Is_free( block ) ) {
     free_list_anchor = block->prev;
 
-    _Heap_Free_list_remove( block );
+    _Heap_Free_block_remove( heap, block );
 
     /* Statistics */
     --stats->free_blocks;
@@ -179,6 +179,145 @@ static uintptr_t _Heap_Check_block(
   return 0;
 }
 
+static uintptr_t _Heap_Check_free_block(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary,
+  uintptr_t block_size_floor
+)
+{
+  _HAssert( _Heap_Is_prev_used( block ) );
+
+  _Heap_Protection_block_check( heap, block );
+
+  /*
+   * The HEAP_PREV_BLOCK_USED flag is always set in the block size_and_flag
+   * field.  Thus the value is about one unit larger than the real block
+   * size.  The greater than operator takes this into account.
+   */
+  if ( block->size_and_flag > block_size_floor ) {
+    if ( alignment == 0 ) {
+      return _Heap_Alloc_area_of_block( block );
+    } else {
+      return _Heap_Check_block(
+        heap,
+        block,
+        alloc_size,
+        alignment,
+        boundary
+      );
+    }
+  }
+
+  return 0;
+}
+
+static uintptr_t _Heap_Segregated_fit_search(
+  Heap_Control *heap,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary,
+  uintptr_t block_size_floor,
+  Heap_Block **block_ptr,
+  uint32_t *search_count
+)
+{
+  Heap_Segregated_fit *const segregated_fit = heap->segregated_fit;
+  uintptr_t const search_size_floor =
+    _Heap_Max( block_size_floor, heap->min_block_size );
+  uintptr_t const search_size = search_size_floor + alignment;
+  Heap_Block *free_list = NULL;
+  Heap_Block *block = NULL;
+  uintptr_t alloc_begin = 0;
+  uint32_t fl = 0;
+  uint32_t sl = 0;
+
+  /*
+   * Round the search size up to the next free list boundary.  Each block on
+   * the free lists at or above the rounded size is large enough, so the first
+   * block of the first non-empty free list is taken without a search.  The
+   * alignment is added to the search size to cover the worst case alignment
+   * loss.
+   */
+  if ( search_size >= search_size_floor ) {
+    uintptr_t const round_up = ( (uintptr_t) 1 << (
+      _Heap_Most_significant_bit( search_size )
+        - HEAP_SEGREGATED_FIT_SECOND_LEVEL_SHIFT
+    ) ) - 1;
+
+    if ( search_size + round_up >= search_size ) {
+      _Heap_Segregated_fit_mapping( search_size + round_up, &fl, &sl );
+
+      free_list = _Heap_Segregated_fit_find( segregated_fit, &fl, &sl );
+      if ( free_list != NULL ) {
+        block = free_list->next;
+
+        /* Statistics */
+        ++*search_count;
+
+        alloc_begin = _Heap_Check_free_block(
+          heap,
+          block,
+          alloc_size,
+          alignment,
+          boundary,
+          block_size_floor
+        );
+        if ( alloc_begin != 0 ) {
+          *block_ptr = block;
+
+          return alloc_begin;
+        }
+      }
+    }
+  }
+
+  /*
+   * Search the free lists which may contain a large enough block.  This is
+   * only necessary near the end of the available memory and for requests
+   * with an alignment or boundary constraint.  It is a linear search of all
+   * blocks on these free lists, so its time is not bounded by a constant.
+   */
+  _Heap_Segregated_fit_mapping( search_size_floor, &fl, &sl );
+
+  while (
+    ( free_list = _Heap_Segregated_fit_find( segregated_fit, &fl, &sl ) )
+      != NULL
+  ) {
+    for ( block = free_list->next ; block != free_list ; block = block->next ) {
+      /* Statistics */
+      ++*search_count;
+
+      alloc_begin = _Heap_Check_free_block(
+        heap,
+        block,
+        alloc_size,
+        alignment,
+        boundary,
+        block_size_floor
+      );
+      if ( alloc_begin != 0 ) {
+        *block_ptr = block;
+
+        return alloc_begin;
+      }
+    }
+
+    if ( sl < HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT - 1 ) {
+      ++sl;
+    } else if ( fl < HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT - 1 ) {
+      ++fl;
+      sl = 0;
+    } else {
+      break;
+    }
+  }
+
+  return 0;
+}
+
 void *_Heap_Allocate_aligned_with_boundary(
   Heap_Control *heap,
   uintptr_t alloc_size,
@@ -211,41 +350,39 @@ void *_Heap_Allocate_aligned_with_boundary(
   }
 
   do {
-    Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
-
-    block = _Heap_Free_list_first( heap );
-    while ( block != free_list_tail ) {
-      _HAssert( _Heap_Is_prev_used( block ) );
-
-      _Heap_Protection_block_check( heap, block );
-
-      /*
-       * The HEAP_PREV_BLOCK_USED flag is always set in the block size_and_flag
-       * field.  Thus the value is about one unit larger than the real block
-       * size.  The greater than operator takes this into account.
-       */
-      if ( block->size_and_flag > block_size_floor ) {
-        if ( alignment == 0 ) {
-          alloc_begin = _Heap_Alloc_area_of_block( block );
-        } else {
-          alloc_begin = _Heap_Check_block(
-            heap,
-            block,
-            alloc_size,
-            alignment,
-            boundary
-          );
-        }
-      }
+    if ( _Heap_Is_segregated_fit( heap ) ) {
+      alloc_begin = _Heap_Segregated_fit_search(
+        heap,
+        alloc_size,
+        alignment,
+        boundary,
+        block_size_floor,
+        &block,
+        &search_count
+      );
+    } else {
+      Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
 
-      /* Statistics */
-      ++search_count;
+      block = _Heap_Free_list_first( heap );
+      while ( block != free_list_tail ) {
+        alloc_begin = _Heap_Check_free_block(
+          heap,
+          block,
+          alloc_size,
+          alignment,
+          boundary,
+          block_size_floor
+        );
 
-      if ( alloc_begin != 0 ) {
-        break;
-      }
+        /* Statistics */
+        ++search_count;
 
-      block = block->next;
+        if ( alloc_begin != 0 ) {
+          break;
+        }
+
+        block = block->next;
+      }
     }
 
     search_again = _Heap_Protection_free_delayed_blocks( heap, alloc_begin );
@@ -22,20 +22,15 @@
 #include <rtems/system.h>
 #include <rtems/score/heapimpl.h>
 
-void _Heap_Get_free_information(
-  Heap_Control        *the_heap,
+static void _Heap_Get_free_list_information(
+  Heap_Block          *head,
   Heap_Information    *info
 )
 {
   Heap_Block *the_block;
-  Heap_Block *const tail = _Heap_Free_list_tail(the_heap);
-
-  info->number = 0;
-  info->largest = 0;
-  info->total = 0;
 
-  for(the_block = _Heap_Free_list_first(the_heap);
-      the_block != tail;
+  for(the_block = head->next;
+      the_block != head;
       the_block = the_block->next)
   {
     uint32_t const the_size = _Heap_Block_size(the_block);
@@ -49,3 +44,29 @@ void _Heap_Get_free_information(
         info->largest = the_size;
   }
 }
+
+void _Heap_Get_free_information(
+  Heap_Control        *the_heap,
+  Heap_Information    *info
+)
+{
+  info->number = 0;
+  info->largest = 0;
+  info->total = 0;
+
+  _Heap_Get_free_list_information(_Heap_Free_list_head(the_heap), info);
+
+  if ( _Heap_Is_segregated_fit(the_heap) ) {
+    uint32_t fl;
+    uint32_t sl;
+
+    for ( fl = 0 ; fl < HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT ; ++fl ) {
+      for ( sl = 0 ; sl < HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT ; ++sl ) {
+        _Heap_Get_free_list_information(
+          _Heap_Segregated_fit_head(the_heap->segregated_fit, fl, sl),
+          info
+        );
+      }
+    }
+  }
+}
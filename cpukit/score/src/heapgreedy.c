@@ -32,7 +32,6 @@ Heap_Block *_Heap_Greedy_allocate(
   size_t block_count
 )
 {
-  Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
   Heap_Block *allocated_blocks = NULL;
   Heap_Block *blocks = NULL;
   Heap_Block *current;
@@ -54,7 +53,7 @@ Heap_Block *_Heap_Greedy_allocate(
     }
   }
 
-  while ( (current = _Heap_Free_list_first( heap )) != free_list_tail ) {
+  while ( (current = _Heap_Free_block_any( heap )) != NULL ) {
     _Heap_Block_allocate(
       heap,
       current,
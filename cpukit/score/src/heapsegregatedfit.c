@@ -0,0 +1,74 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreHeap
+ *
+ * @brief Heap Handler Segregated Fit Allocation Mode
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/heapimpl.h>
+
+bool _Heap_Enable_segregated_fit( Heap_Control *heap )
+{
+  Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  Heap_Segregated_fit *segregated_fit;
+  Heap_Block *block;
+  uint32_t fl;
+  uint32_t sl;
+
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    return true;
+  }
+
+  segregated_fit = _Heap_Allocate( heap, sizeof( *segregated_fit ) );
+  if ( segregated_fit == NULL ) {
+    return false;
+  }
+
+  segregated_fit->first_level_map = 0;
+
+  for ( fl = 0 ; fl < HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT ; ++fl ) {
+    segregated_fit->second_level_map [fl] = 0;
+
+    for ( sl = 0 ; sl < HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT ; ++sl ) {
+      Heap_Block *const head =
+        _Heap_Segregated_fit_head( segregated_fit, fl, sl );
+
+      head->next = head;
+      head->prev = head;
+    }
+  }
+
+  block = _Heap_Free_list_first( heap );
+  while ( block != free_list_tail ) {
+    Heap_Block *const next = block->next;
+
+    _Heap_Segregated_fit_insert(
+      segregated_fit,
+      block,
+      _Heap_Block_size( block )
+    );
+
+    block = next;
+  }
+
+  _Heap_Free_list_head( heap )->next = free_list_tail;
+  _Heap_Free_list_tail( heap )->prev = _Heap_Free_list_head( heap );
+
+  heap->segregated_fit = segregated_fit;
+
+  return true;
+}
@@ -56,12 +56,13 @@ static void _Heap_Walk_print( int source, bool error, const char *fmt, ... )
 static bool _Heap_Walk_check_free_list(
   int source,
   Heap_Walk_printer printer,
-  Heap_Control *heap
+  Heap_Control *heap,
+  const Heap_Block *free_list
 )
 {
   uintptr_t const page_size = heap->page_size;
-  const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
-  const Heap_Block *const first_free_block = _Heap_Free_list_first( heap );
+  const Heap_Block *const free_list_tail = free_list;
+  const Heap_Block *const first_free_block = free_list->next;
   const Heap_Block *prev_block = free_list_tail;
   const Heap_Block *free_block = first_free_block;
 
@@ -120,13 +121,102 @@ static bool _Heap_Walk_check_free_list(
   return true;
 }
 
+static bool _Heap_Walk_check_segregated_fit(
+  int source,
+  Heap_Walk_printer printer,
+  Heap_Control *heap
+)
+{
+  Heap_Segregated_fit *const segregated_fit = heap->segregated_fit;
+  uint32_t fl;
+  uint32_t sl;
+
+  for ( fl = 0 ; fl < HEAP_SEGREGATED_FIT_FIRST_LEVEL_COUNT ; ++fl ) {
+    bool const fl_used =
+      ( segregated_fit->first_level_map & ( (uintptr_t) 1 << fl ) ) != 0;
+
+    if ( fl_used != ( segregated_fit->second_level_map [fl] != 0 ) ) {
+      (*printer)(
+        source,
+        true,
+        "segregated free lists %u: inconsistent first level map\n",
+        fl
+      );
+
+      return false;
+    }
+
+    for ( sl = 0 ; sl < HEAP_SEGREGATED_FIT_SECOND_LEVEL_COUNT ; ++sl ) {
+      const Heap_Block *const free_list =
+        _Heap_Segregated_fit_head( segregated_fit, fl, sl );
+      const Heap_Block *free_block = free_list->next;
+      bool const sl_used =
+        ( segregated_fit->second_level_map [fl] & ( 1U << sl ) ) != 0;
+
+      if ( sl_used != ( free_block != free_list ) ) {
+        (*printer)(
+          source,
+          true,
+          "segregated free list %u/%u: inconsistent second level map\n",
+          fl,
+          sl
+        );
+
+        return false;
+      }
+
+      if ( !_Heap_Walk_check_free_list( source, printer, heap, free_list ) ) {
+        return false;
+      }
+
+      while ( free_block != free_list ) {
+        uint32_t block_fl;
+        uint32_t block_sl;
+
+        _Heap_Segregated_fit_mapping(
+          _Heap_Block_size( free_block ),
+          &block_fl,
+          &block_sl
+        );
+
+        if ( block_fl != fl || block_sl != sl ) {
+          (*printer)(
+            source,
+            true,
+            "free block 0x%08x: in wrong segregated free list %u/%u\n",
+            free_block,
+            fl,
+            sl
+          );
+
+          return false;
+        }
+
+        free_block = free_block->next;
+      }
+    }
+  }
+
+  return true;
+}
+
 static bool _Heap_Walk_is_in_free_list(
   Heap_Control *heap,
   Heap_Block *block
 )
 {
-  const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
-  const Heap_Block *free_block = _Heap_Free_list_first( heap );
+  const Heap_Block *free_list_tail = _Heap_Free_list_tail( heap );
+  const Heap_Block *free_block;
+
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    uint32_t fl;
+    uint32_t sl;
+
+    _Heap_Segregated_fit_mapping( _Heap_Block_size( block ), &fl, &sl );
+    free_list_tail = _Heap_Segregated_fit_head( heap->segregated_fit, fl, sl );
+  }
+
+  free_block = free_list_tail->next;
 
   while ( free_block != free_list_tail ) {
     if ( free_block == block ) {
@@ -237,7 +327,22 @@ static bool _Heap_Walk_check_control(
     return false;
   }
 
-  return _Heap_Walk_check_free_list( source, printer, heap );
+  if (
+    !_Heap_Walk_check_free_list(
+      source,
+      printer,
+      heap,
+      _Heap_Free_list_head( heap )
+    )
+  ) {
+    return false;
+  }
+
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    return _Heap_Walk_check_segregated_fit( source, printer, heap );
+  }
+
+  return true;
 }
 
 static bool _Heap_Walk_check_free_block(
@@ -220,6 +220,7 @@ void _Objects_Extend_information(
     }
 
     _ISR_Disable( level );
+    _Objects_Sequence_write_begin( information );
 
     old_tables = information->object_blocks;
 
@@ -234,6 +235,7 @@ void _Objects_Extend_information(
         information->maximum
       );
 
+    _Objects_Sequence_write_end( information );
     _ISR_Enable( level );
 
     _Workspace_Free( old_tables );
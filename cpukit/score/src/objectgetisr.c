@@ -34,6 +34,11 @@ Objects_Control *_Objects_Get_isr_disable(
   index = id - information->minimum_id + 1;
 
   if ( information->maximum >= index ) {
+    /*
+     * On SMP configurations the Giant lock protects the lookup against a
+     * concurrent delete operation.  Operations which need no Giant lock may
+     * release it once they own the object specific lock.
+     */
 #if defined(RTEMS_SMP)
     _Thread_Disable_dispatch();
 #endif
@@ -53,6 +53,11 @@ void _Objects_Initialize_information(
   information->inactive_per_block = 0;
   information->object_blocks      = 0;
   information->inactive           = 0;
+  #if defined(RTEMS_SMP)
+    _Atomic_Init_ulong( &information->sequence, 0 );
+  #else
+    information->sequence         = 0;
+  #endif
   #if defined(RTEMS_SCORE_OBJECT_ENABLE_STRING_NAMES)
     information->is_string        = is_string;
   #endif
@@ -0,0 +1,62 @@
+/**
+ *  @file
+ *
+ *  @brief Object Read Without Lock
+ *  @ingroup ScoreObject
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/objectimpl.h>
+
+Objects_Locations _Objects_Read(
+  Objects_Information  *information,
+  Objects_Id            id,
+  Objects_Read_visitor  visitor,
+  void                 *arg
+)
+{
+  Objects_Locations  location;
+  Objects_Control   *the_object;
+  unsigned long      sequence;
+  uint32_t           index;
+
+  index = id - information->minimum_id + 1;
+
+  /*
+   *  The maximum and the local table change together during an extension
+   *  of the information, so both are read under the sequence counter.
+   */
+  do {
+    sequence = _Objects_Sequence_read_begin( information );
+    location = OBJECTS_ERROR;
+    the_object = NULL;
+
+    if ( information->maximum >= index ) {
+      the_object = information->local_table[ index ];
+
+      if ( the_object != NULL && ( *visitor )( the_object, arg ) ) {
+        location = OBJECTS_LOCAL;
+      }
+    }
+  } while ( _Objects_Sequence_read_retry( information, sequence ) );
+
+#if defined(RTEMS_MULTIPROCESSING)
+  if ( information->maximum < index ) {
+    _Objects_MP_Is_remote( information, id, &location, &the_object );
+  }
+#endif
+
+  return location;
+}
@@ -29,6 +29,8 @@ void _Objects_Shrink_information(
   uint32_t          block_count;
   uint32_t          block;
   uint32_t          index_base;
+  void             *the_block;
+  ISR_Level         level;
 
   /*
    * Search the list to find block or chunk with all objects inactive.
@@ -60,15 +62,26 @@ void _Objects_Shrink_information(
       }
 
       /*
-       *  Free the memory and reset the structures in the object' information
+       *  Reset the structures in the object' information and free the
+       *  memory.  A lock-free reader which may still visit an object of
+       *  this block must see the sequence counter change, see
+       *  _Objects_Read().
        */
 
-      _Workspace_Free( information->object_blocks[ block ] );
+      _ISR_Disable( level );
+      _Objects_Sequence_write_begin( information );
+
+      the_block = information->object_blocks[ block ];
       information->object_blocks[ block ] = NULL;
       information->inactive_per_block[ block ] = 0;
 
       information->inactive -= information->allocation_size;
 
+      _Objects_Sequence_write_end( information );
+      _ISR_Enable( level );
+
+      _Workspace_Free( the_block );
+
       return;
     }
 
@@ -29,6 +29,7 @@
 #if defined(RTEMS_SMP)
 
   #include <rtems/score/smp.h>
+  #include <rtems/score/smpjob.h>
   #include <rtems/bspsmp.h>
 
   void _SMP_Handler_initialize(void)
@@ -57,6 +58,17 @@
 #endif
     }
 
+#if defined(RTEMS_ATOMIC)
+    for ( cpu = 0 ; cpu < max_cpus; ++cpu ) {
+      Per_CPU_Control *p = _Per_CPU_Get_by_index( cpu );
+
+      p->job_queue = _Workspace_Allocate_or_fatal_error(
+        sizeof( *p->job_queue )
+      );
+      _SMP_Job_queue_initialize( p->job_queue );
+    }
+#endif
+
     /*
      * Discover and initialize the secondary cores in an SMP system.
      */
@@ -0,0 +1,56 @@
+/**
+ * @file
+ *
+ * @brief Scheduler Default Processor Affinity Operations
+ *
+ * @ingroup ScoreScheduler
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/scheduler.h>
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+
+#include <rtems/score/cpusetimpl.h>
+
+bool _Scheduler_default_Get_affinity(
+  Thread_Control *thread,
+  size_t          cpusetsize,
+  cpu_set_t      *cpuset
+)
+{
+  (void) thread;
+
+  if ( !_CPU_set_Is_large_enough( cpusetsize ) ) {
+    return false;
+  }
+
+  _CPU_set_Fill_with_online_processors( cpusetsize, cpuset );
+
+  return true;
+}
+
+bool _Scheduler_default_Set_affinity(
+  Thread_Control  *thread,
+  size_t           cpusetsize,
+  const cpu_set_t *cpuset
+)
+{
+  (void) thread;
+
+  return _CPU_set_Has_all_online_processors( cpusetsize, cpuset );
+}
+
+#endif /* defined(__RTEMS_HAVE_SYS_CPUSET_H__) */
@@ -0,0 +1,42 @@
+/**
+ * @file
+ *
+ * @brief Scheduler Default Processor Cluster Operations
+ *
+ * @ingroup ScoreScheduler
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/scheduler.h>
+
+uint32_t _Scheduler_default_Get_cluster(
+  Thread_Control *thread
+)
+{
+  (void) thread;
+
+  return 0;
+}
+
+bool _Scheduler_default_Set_cluster(
+  Thread_Control *thread,
+  uint32_t        cluster
+)
+{
+  (void) thread;
+  (void) cluster;
+
+  return true;
+}
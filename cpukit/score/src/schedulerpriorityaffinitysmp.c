@@ -0,0 +1,538 @@
+/**
+ * @file
+ *
+ * @brief Deterministic Priority Affinity SMP Scheduler Implementation
+ *
+ * @ingroup ScoreSchedulerPriorityAffinitySMP
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/schedulerpriorityaffinitysmp.h>
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+
+#include <rtems/score/schedulerimpl.h>
+#include <rtems/score/schedulerpriorityimpl.h>
+#include <rtems/score/prioritybitmapimpl.h>
+#include <rtems/score/cpusetimpl.h>
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/wkspace.h>
+#include <rtems/config.h>
+
+#define SCHEDULER_AFFINITY_MAXIMUM_CPU_COUNT ( sizeof( cpu_set_t ) * CHAR_BIT )
+
+static Scheduler_priority_affinity_SMP_Control *
+_Scheduler_priority_affinity_SMP_Get_control( void )
+{
+  return _Scheduler.information;
+}
+
+static Scheduler_priority_affinity_SMP_Per_thread *
+_Scheduler_priority_affinity_SMP_Get_scheduler_info( Thread_Control *thread )
+{
+  return ( Scheduler_priority_affinity_SMP_Per_thread * )
+    thread->scheduler_info;
+}
+
+static bool _Scheduler_priority_affinity_SMP_Has_affinity(
+  const Scheduler_priority_affinity_SMP_Per_thread *sched_info_of_thread,
+  uint32_t cpu_index
+)
+{
+  return cpu_index < SCHEDULER_AFFINITY_MAXIMUM_CPU_COUNT
+    && CPU_ISSET_S(
+      (int) cpu_index,
+      sizeof( sched_info_of_thread->Affinity ),
+      &sched_info_of_thread->Affinity
+    );
+}
+
+static void _Scheduler_priority_affinity_SMP_Acquire_all_processors(
+  uint32_t cpu_count
+)
+{
+  uint32_t cpu_index;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    _Per_CPU_Acquire( _Per_CPU_Get_by_index( cpu_index ) );
+  }
+}
+
+static void _Scheduler_priority_affinity_SMP_Release_all_processors(
+  uint32_t cpu_count
+)
+{
+  uint32_t cpu_index;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    _Per_CPU_Release( _Per_CPU_Get_by_index( cpu_index ) );
+  }
+}
+
+/*
+ * Returns the processor for the thread or NULL if all processors of its
+ * affinity set are already taken by threads of higher priority.  The heir
+ * array contains the processors taken so far.
+ */
+static Per_CPU_Control *_Scheduler_priority_affinity_SMP_Select_processor(
+  Thread_Control *const *heirs,
+  uint32_t cpu_count,
+  Thread_Control *thread
+)
+{
+  Scheduler_priority_affinity_SMP_Per_thread *sched_info_of_thread =
+    _Scheduler_priority_affinity_SMP_Get_scheduler_info( thread );
+  Per_CPU_Control *cpu_of_thread = thread->cpu;
+  uint32_t index_of_thread = _Per_CPU_Get_index( cpu_of_thread );
+  Per_CPU_Control *selected_cpu = NULL;
+  Priority_Control lowest_priority = 0;
+  uint32_t cpu_index;
+
+  if (
+    heirs[ index_of_thread ] == NULL
+      && _Scheduler_priority_affinity_SMP_Has_affinity(
+        sched_info_of_thread,
+        index_of_thread
+      )
+  ) {
+    return cpu_of_thread;
+  }
+
+  /*
+   * An executing thread cannot move to another processor since its context
+   * may not be saved yet.
+   */
+  if ( thread->is_executing ) {
+    return NULL;
+  }
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    if (
+      heirs[ cpu_index ] == NULL
+        && _Scheduler_priority_affinity_SMP_Has_affinity(
+          sched_info_of_thread,
+          cpu_index
+        )
+    ) {
+      Per_CPU_Control *cpu = _Per_CPU_Get_by_index( cpu_index );
+      Priority_Control priority_of_heir = cpu->heir->current_priority;
+
+      /* Displace the lowest priority heir to keep the scheduled set stable */
+      if ( selected_cpu == NULL || priority_of_heir > lowest_priority ) {
+        selected_cpu = cpu;
+        lowest_priority = priority_of_heir;
+      }
+    }
+  }
+
+  return selected_cpu;
+}
+
+/*
+ * Determines the heir of each processor.  The scheduler lock must be held.
+ * All per-CPU locks are held during the reassignment so that the executing
+ * and heir threads cannot change in the meantime.
+ */
+static void _Scheduler_priority_affinity_SMP_Reassign_processors(
+  Scheduler_priority_affinity_SMP_Control *control
+)
+{
+  const Per_CPU_Control *cpu_self = _Per_CPU_Get();
+  uint32_t cpu_count = _SMP_Get_processor_count();
+  Thread_Control **heirs = control->heirs;
+  Priority_bit_map_Table bit_map = control->Bit_map;
+  uint32_t assigned_count = 0;
+  uint32_t cpu_index;
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    heirs[ cpu_index ] = NULL;
+  }
+
+  _Scheduler_priority_affinity_SMP_Acquire_all_processors( cpu_count );
+
+  while (
+    assigned_count < cpu_count
+      && !_Priority_bit_map_Table_is_empty( &bit_map )
+  ) {
+    Priority_Control priority =
+      _Priority_bit_map_Table_get_highest( &bit_map );
+    Chain_Control *ready_chain = &control->Ready[ priority ];
+    Chain_Node *node = _Chain_First( ready_chain );
+    Priority_bit_map_Information priority_map;
+
+    while (
+      assigned_count < cpu_count
+        && !_Chain_Is_tail( ready_chain, node )
+    ) {
+      Thread_Control *thread = (Thread_Control *) node;
+      Per_CPU_Control *cpu = _Scheduler_priority_affinity_SMP_Select_processor(
+        heirs,
+        cpu_count,
+        thread
+      );
+
+      if ( cpu != NULL ) {
+        heirs[ _Per_CPU_Get_index( cpu ) ] = thread;
+        ++assigned_count;
+      }
+
+      node = _Chain_Next( node );
+    }
+
+    /* This priority level is exhausted, continue with the next lower one */
+    _Priority_bit_map_Table_initialize_information(
+      &bit_map,
+      &priority_map,
+      priority
+    );
+    _Priority_bit_map_Table_remove( &bit_map, &priority_map );
+  }
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    Per_CPU_Control *cpu = _Per_CPU_Get_by_index( cpu_index );
+    Thread_Control *heir = heirs[ cpu_index ];
+
+    /*
+     * The idle thread of each processor is always ready and has only this
+     * processor in its affinity set, so every processor gets a heir.
+     */
+    if ( heir != NULL && heir != cpu->heir ) {
+      heir->cpu = cpu;
+      cpu->heir = heir;
+      cpu->dispatch_necessary = true;
+    } else {
+      heirs[ cpu_index ] = NULL;
+    }
+  }
+
+  _Scheduler_priority_affinity_SMP_Release_all_processors( cpu_count );
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    Per_CPU_Control *cpu = _Per_CPU_Get_by_index( cpu_index );
+
+    if ( heirs[ cpu_index ] != NULL && cpu != cpu_self ) {
+      _Per_CPU_Send_interrupt( cpu );
+    }
+  }
+}
+
+static void _Scheduler_priority_affinity_SMP_Ready_queue_enqueue(
+  Scheduler_priority_affinity_SMP_Control *control,
+  Thread_Control *thread
+)
+{
+  Scheduler_priority_Per_thread *sched_info_of_thread =
+    _Scheduler_priority_Get_scheduler_info( thread );
+
+  _Chain_Append_unprotected(
+    sched_info_of_thread->ready_chain,
+    &thread->Object.Node
+  );
+  _Priority_bit_map_Table_add(
+    &control->Bit_map,
+    &sched_info_of_thread->Priority_map
+  );
+}
+
+static void _Scheduler_priority_affinity_SMP_Ready_queue_enqueue_first(
+  Scheduler_priority_affinity_SMP_Control *control,
+  Thread_Control *thread
+)
+{
+  Scheduler_priority_Per_thread *sched_info_of_thread =
+    _Scheduler_priority_Get_scheduler_info( thread );
+
+  _Chain_Prepend_unprotected(
+    sched_info_of_thread->ready_chain,
+    &thread->Object.Node
+  );
+  _Priority_bit_map_Table_add(
+    &control->Bit_map,
+    &sched_info_of_thread->Priority_map
+  );
+}
+
+static void _Scheduler_priority_affinity_SMP_Ready_queue_extract(
+  Scheduler_priority_affinity_SMP_Control *control,
+  Thread_Control *thread
+)
+{
+  Scheduler_priority_Per_thread *sched_info_of_thread =
+    _Scheduler_priority_Get_scheduler_info( thread );
+  Chain_Control *ready_chain = sched_info_of_thread->ready_chain;
+
+  if ( _Chain_Has_only_one_node( ready_chain ) ) {
+    _Chain_Initialize_empty( ready_chain );
+    _Priority_bit_map_Table_remove(
+      &control->Bit_map,
+      &sched_info_of_thread->Priority_map
+    );
+  } else {
+    _Chain_Extract_unprotected( &thread->Object.Node );
+  }
+}
+
+void _Scheduler_priority_affinity_SMP_Initialize( void )
+{
+  Scheduler_priority_affinity_SMP_Control *control =
+    _Workspace_Allocate_or_fatal_error(
+      sizeof( *control ) + PRIORITY_MAXIMUM * sizeof( Chain_Control )
+    );
+
+  control->heirs = _Workspace_Allocate_or_fatal_error(
+    rtems_configuration_get_maximum_processors() * sizeof( *control->heirs )
+  );
+
+  _ISR_lock_Initialize( &control->Lock );
+  _Priority_bit_map_Table_initialize( &control->Bit_map );
+  _Scheduler_priority_Ready_queue_initialize( &control->Ready[ 0 ] );
+
+  _Scheduler.information = control;
+}
+
+void *_Scheduler_priority_affinity_SMP_Allocate( Thread_Control *thread )
+{
+  Scheduler_priority_affinity_SMP_Per_thread *sched_info_of_thread =
+    _Workspace_Allocate( sizeof( *sched_info_of_thread ) );
+
+  if ( sched_info_of_thread != NULL ) {
+    cpu_set_t *affinity = &sched_info_of_thread->Affinity;
+    uint32_t cpu_index;
+
+    /* New threads may execute on every processor */
+    CPU_ZERO_S( sizeof( *affinity ), affinity );
+
+    for (
+      cpu_index = 0 ;
+      cpu_index < SCHEDULER_AFFINITY_MAXIMUM_CPU_COUNT ;
+      ++cpu_index
+    ) {
+      CPU_SET_S( (int) cpu_index, sizeof( *affinity ), affinity );
+    }
+
+    thread->scheduler_info = sched_info_of_thread;
+  }
+
+  return sched_info_of_thread;
+}
+
+void _Scheduler_priority_affinity_SMP_Update( Thread_Control *thread )
+{
+  Scheduler_priority_affinity_SMP_Control *control =
+    _Scheduler_priority_affinity_SMP_Get_control();
+  Scheduler_priority_Per_thread *sched_info_of_thread =
+    _Scheduler_priority_Get_scheduler_info( thread );
+
+  sched_info_of_thread->ready_chain =
+    &control->Ready[ thread->current_priority ];
+
+  _Priority_bit_map_Table_initialize_information(
+    &control->Bit_map,
+    &sched_info_of_thread->Priority_map,
+    thread->current_priority
+  );
+}
+
+void _Scheduler_priority_affinity_SMP_Schedule( Thread_Control *thread )
+{
+  Scheduler_priority_affinity_SMP_Control *control =
+    _Scheduler_priority_affinity_SMP_Get_control();
+  ISR_Level level;
+
+  (void) thread;
+
+  _ISR_lock_ISR_disable_and_acquire( &control->Lock, level );
+  _Scheduler_priority_affinity_SMP_Reassign_processors( control );
+  _ISR_lock_Release_and_ISR_enable( &control->Lock, level );
+}
+
+void _Scheduler_priority_affinity_SMP_Yield( Thread_Control *thread )
+{
+  Scheduler_priority_affinity_SMP_Control *control =
+    _Scheduler_priority_affinity_SMP_Get_control();
+  Scheduler_priority_Per_thread *sched_info_of_thread =
+    _Scheduler_priority_Get_scheduler_info( thread );
+  Chain_Control *ready_chain = sched_info_of_thread->ready_chain;
+  ISR_Level level;
+
+  _ISR_lock_ISR_disable_and_acquire( &control->Lock, level );
+
+  if ( !_Chain_Has_only_one_node( ready_chain ) ) {
+    _Chain_Extract_unprotected( &thread->Object.Node );
+    _Chain_Append_unprotected( ready_chain, &thread->Object.Node );
+  }
+
+  _Scheduler_priority_affinity_SMP_Reassign_processors( control );
+
+  _ISR_lock_Release_and_ISR_enable( &control->Lock, level );
+}
+
+void _Scheduler_priority_affinity_SMP_Extract( Thread_Control *thread )
+{
+  Scheduler_priority_affinity_SMP_Control *control =
+    _Scheduler_priority_affinity_SMP_Get_control();
+  ISR_Level level;
+
+  _ISR_lock_ISR_disable_and_acquire( &control->Lock, level );
+  _Scheduler_priority_affinity_SMP_Ready_queue_extract( control, thread );
+  _Scheduler_priority_affinity_SMP_Reassign_processors( control );
+  _ISR_lock_Release_and_ISR_enable( &control->Lock, level );
+}
+
+void _Scheduler_priority_affinity_SMP_Block( Thread_Control *thread )
+{
+  _Scheduler_priority_affinity_SMP_Extract( thread );
+}
+
+void _Scheduler_priority_affinity_SMP_Enqueue( Thread_Control *thread )
+{
+  Scheduler_priority_affinity_SMP_Control *control =
+    _Scheduler_priority_affinity_SMP_Get_control();
+  ISR_Level level;
+
+  _ISR_lock_ISR_disable_and_acquire( &control->Lock, level );
+  _Scheduler_priority_affinity_SMP_Ready_queue_enqueue( control, thread );
+  _Scheduler_priority_affinity_SMP_Reassign_processors( control );
+  _ISR_lock_Release_and_ISR_enable( &control->Lock, level );
+}
+
+void _Scheduler_priority_affinity_SMP_Enqueue_first( Thread_Control *thread )
+{
+  Scheduler_priority_affinity_SMP_Control *control =
+    _Scheduler_priority_affinity_SMP_Get_control();
+  ISR_Level level;
+
+  _ISR_lock_ISR_disable_and_acquire( &control->Lock, level );
+  _Scheduler_priority_affinity_SMP_Ready_queue_enqueue_first( control, thread );
+  _Scheduler_priority_affinity_SMP_Reassign_processors( control );
+  _ISR_lock_Release_and_ISR_enable( &control->Lock, level );
+}
+
+void _Scheduler_priority_affinity_SMP_Tick( void )
+{
+  _Scheduler_default_Tick();
+
+  /*
+   * A preempted thread which executed on a processor outside of its affinity
+   * set or on a processor taken by a higher priority thread may now move to
+   * another processor.  This bounds the delay to one clock tick.
+   */
+  _Scheduler_priority_affinity_SMP_Schedule( NULL );
+}
+
+void _Scheduler_priority_affinity_SMP_Start_idle(
+  Thread_Control  *thread,
+  Per_CPU_Control *cpu
+)
+{
+  Scheduler_priority_affinity_SMP_Control *control =
+    _Scheduler_priority_affinity_SMP_Get_control();
+  Scheduler_priority_affinity_SMP_Per_thread *sched_info_of_thread =
+    _Scheduler_priority_affinity_SMP_Get_scheduler_info( thread );
+  cpu_set_t *affinity = &sched_info_of_thread->Affinity;
+  ISR_Level level;
+
+  /* The idle thread executes only on its processor */
+  CPU_ZERO_S( sizeof( *affinity ), affinity );
+  CPU_SET_S( (int) _Per_CPU_Get_index( cpu ), sizeof( *affinity ), affinity );
+
+  _ISR_lock_ISR_disable_and_acquire( &control->Lock, level );
+  thread->cpu = cpu;
+  _Scheduler_priority_affinity_SMP_Ready_queue_enqueue( control, thread );
+  _ISR_lock_Release_and_ISR_enable( &control->Lock, level );
+}
+
+bool _Scheduler_priority_affinity_SMP_Get_affinity(
+  Thread_Control *thread,
+  size_t          cpusetsize,
+  cpu_set_t      *cpuset
+)
+{
+  Scheduler_priority_affinity_SMP_Per_thread *sched_info_of_thread =
+    _Scheduler_priority_affinity_SMP_Get_scheduler_info( thread );
+  uint32_t cpu_count = _SMP_Get_processor_count();
+  uint32_t cpu_index;
+
+  if ( !_CPU_set_Is_large_enough( cpusetsize ) ) {
+    return false;
+  }
+
+  CPU_ZERO_S( cpusetsize, cpuset );
+
+  for ( cpu_index = 0 ; cpu_index < cpu_count ; ++cpu_index ) {
+    if (
+      _Scheduler_priority_affinity_SMP_Has_affinity(
+        sched_info_of_thread,
+        cpu_index
+      )
+    ) {
+      CPU_SET_S( (int) cpu_index, cpusetsize, cpuset );
+    }
+  }
+
+  return true;
+}
+
+bool _Scheduler_priority_affinity_SMP_Set_affinity(
+  Thread_Control  *thread,
+  size_t           cpusetsize,
+  const cpu_set_t *cpuset
+)
+{
+  Scheduler_priority_affinity_SMP_Control *control =
+    _Scheduler_priority_affinity_SMP_Get_control();
+  Scheduler_priority_affinity_SMP_Per_thread *sched_info_of_thread =
+    _Scheduler_priority_affinity_SMP_Get_scheduler_info( thread );
+  cpu_set_t *affinity = &sched_info_of_thread->Affinity;
+  size_t cpu_limit = cpusetsize * CHAR_BIT;
+  size_t cpu_index;
+  ISR_Level level;
+
+  /*
+   * The idle threads must stay on their processor, so that each processor
+   * has at least one thread to execute.
+   */
+  if ( _Objects_Get_API( thread->Object.id ) == OBJECTS_INTERNAL_API ) {
+    return false;
+  }
+
+  if ( !_CPU_set_Has_online_processor( cpusetsize, cpuset ) ) {
+    return false;
+  }
+
+  if ( cpu_limit > SCHEDULER_AFFINITY_MAXIMUM_CPU_COUNT ) {
+    cpu_limit = SCHEDULER_AFFINITY_MAXIMUM_CPU_COUNT;
+  }
+
+  _ISR_lock_ISR_disable_and_acquire( &control->Lock, level );
+
+  CPU_ZERO_S( sizeof( *affinity ), affinity );
+
+  for ( cpu_index = 0 ; cpu_index < cpu_limit ; ++cpu_index ) {
+    if ( CPU_ISSET_S( (int) cpu_index, cpusetsize, cpuset ) ) {
+      CPU_SET_S( (int) cpu_index, sizeof( *affinity ), affinity );
+    }
+  }
+
+  if ( _States_Is_ready( thread->current_state ) ) {
+    _Scheduler_priority_affinity_SMP_Reassign_processors( control );
+  }
+
+  _ISR_lock_Release_and_ISR_enable( &control->Lock, level );
+
+  return true;
+}
+
+#endif /* defined(__RTEMS_HAVE_SYS_CPUSET_H__) */
@@ -27,35 +27,193 @@
 #include <rtems/score/schedulerprioritysmp.h>
 #include <rtems/score/schedulerpriorityimpl.h>
 #include <rtems/score/schedulersmpimpl.h>
+#include <rtems/score/prioritybitmapimpl.h>
+#include <rtems/score/interr.h>
 #include <rtems/score/wkspace.h>
+#include <rtems/config.h>
+
+static Scheduler_priority_SMP_Control *_Scheduler_priority_SMP_Get_control(
+  void
+)
+{
+  return _Scheduler.information;
+}
+
+static Scheduler_priority_SMP_Per_thread *
+_Scheduler_priority_SMP_Get_scheduler_info( Thread_Control *thread )
+{
+  return ( Scheduler_priority_SMP_Per_thread * ) thread->scheduler_info;
+}
+
+static Scheduler_priority_SMP_Cluster *
+_Scheduler_priority_SMP_Cluster_of_instance( Scheduler_SMP_Control *self )
+{
+  return (Scheduler_priority_SMP_Cluster *)
+    ( (char *) self - offsetof( Scheduler_priority_SMP_Cluster, Base ) );
+}
+
+static Scheduler_SMP_Control *_Scheduler_priority_SMP_Instance_of_thread(
+  Thread_Control *thread
+)
+{
+  return &_Scheduler_priority_SMP_Get_scheduler_info( thread )->cluster->Base;
+}
+
+static void _Scheduler_priority_SMP_Set_cluster_of_thread(
+  Thread_Control *thread,
+  uint32_t cluster_index
+)
+{
+  Scheduler_priority_SMP_Control *control =
+    _Scheduler_priority_SMP_Get_control();
+  Scheduler_priority_SMP_Per_thread *sched_info_of_thread =
+    _Scheduler_priority_SMP_Get_scheduler_info( thread );
+
+  sched_info_of_thread->cluster = control->clusters[ cluster_index ];
+  sched_info_of_thread->cluster_index = cluster_index;
+}
 
 void _Scheduler_priority_SMP_Initialize( void )
 {
-  Scheduler_SMP_Control *self = _Workspace_Allocate_or_fatal_error(
-    sizeof( *self ) + PRIORITY_MAXIMUM * sizeof( Chain_Control )
+  uint32_t cluster_count = rtems_configuration_get_scheduler_cluster_count();
+  Scheduler_priority_SMP_Control *control = _Workspace_Allocate_or_fatal_error(
+    sizeof( *control )
+      + ( cluster_count - 1 ) * sizeof( control->clusters[ 0 ] )
   );
+  uint32_t cluster_index;
+
+  control->cluster_count = cluster_count;
+
+  for ( cluster_index = 0 ; cluster_index < cluster_count ; ++cluster_index ) {
+    Scheduler_priority_SMP_Cluster *cluster =
+      _Workspace_Allocate_or_fatal_error(
+        sizeof( *cluster ) + PRIORITY_MAXIMUM * sizeof( Chain_Control )
+      );
+    Scheduler_SMP_Control *self = &cluster->Base;
+
+    _Priority_bit_map_Table_initialize( &cluster->Bit_map );
+    _ISR_lock_Initialize( &self->Lock );
+    _Chain_Initialize_empty( &self->scheduled );
+    _Scheduler_priority_Ready_queue_initialize( &self->ready[ 0 ] );
 
-  _Chain_Initialize_empty( &self->scheduled );
-  _Scheduler_priority_Ready_queue_initialize( &self->ready[ 0 ] );
+    control->clusters[ cluster_index ] = cluster;
+  }
+
+  _Scheduler.information = control;
+}
+
+void *_Scheduler_priority_SMP_Allocate( Thread_Control *thread )
+{
+  Scheduler_priority_SMP_Per_thread *sched_info_of_thread =
+    _Workspace_Allocate( sizeof( *sched_info_of_thread ) );
+
+  if ( sched_info_of_thread != NULL ) {
+    Thread_Control *executing = _Thread_Executing;
+    uint32_t cluster_index = 0;
 
-  _Scheduler.information = self;
+    /* New threads belong to the cluster of the creating thread */
+    if ( executing != NULL && executing->scheduler_info != NULL ) {
+      cluster_index = _Scheduler_priority_SMP_Get_cluster( executing );
+    }
+
+    thread->scheduler_info = sched_info_of_thread;
+    _Scheduler_priority_SMP_Set_cluster_of_thread( thread, cluster_index );
+  }
+
+  return sched_info_of_thread;
 }
 
 void _Scheduler_priority_SMP_Update( Thread_Control *thread )
 {
-  Scheduler_SMP_Control *self = _Scheduler_SMP_Instance();
+  Scheduler_priority_SMP_Per_thread *sched_info_of_thread =
+    _Scheduler_priority_SMP_Get_scheduler_info( thread );
+  Scheduler_priority_SMP_Cluster *cluster = sched_info_of_thread->cluster;
+
+  sched_info_of_thread->Base.ready_chain =
+    &cluster->Base.ready[ thread->current_priority ];
+
+  _Priority_bit_map_Table_initialize_information(
+    &cluster->Bit_map,
+    &sched_info_of_thread->Base.Priority_map,
+    thread->current_priority
+  );
+}
 
-  _Scheduler_priority_Update_body( thread, &self->ready[ 0 ] );
+static void _Scheduler_priority_SMP_Ready_queue_enqueue(
+  Scheduler_SMP_Control *self,
+  Thread_Control *thread
+)
+{
+  Scheduler_priority_SMP_Cluster *cluster =
+    _Scheduler_priority_SMP_Cluster_of_instance( self );
+  Scheduler_priority_Per_thread *sched_info_of_thread =
+    _Scheduler_priority_Get_scheduler_info( thread );
+
+  _Chain_Append_unprotected(
+    sched_info_of_thread->ready_chain,
+    &thread->Object.Node
+  );
+  _Priority_bit_map_Table_add(
+    &cluster->Bit_map,
+    &sched_info_of_thread->Priority_map
+  );
+}
+
+static void _Scheduler_priority_SMP_Ready_queue_enqueue_first(
+  Scheduler_SMP_Control *self,
+  Thread_Control *thread
+)
+{
+  Scheduler_priority_SMP_Cluster *cluster =
+    _Scheduler_priority_SMP_Cluster_of_instance( self );
+  Scheduler_priority_Per_thread *sched_info_of_thread =
+    _Scheduler_priority_Get_scheduler_info( thread );
+
+  _Chain_Prepend_unprotected(
+    sched_info_of_thread->ready_chain,
+    &thread->Object.Node
+  );
+  _Priority_bit_map_Table_add(
+    &cluster->Bit_map,
+    &sched_info_of_thread->Priority_map
+  );
+}
+
+static void _Scheduler_priority_SMP_Ready_queue_extract(
+  Scheduler_SMP_Control *self,
+  Thread_Control *thread
+)
+{
+  Scheduler_priority_SMP_Cluster *cluster =
+    _Scheduler_priority_SMP_Cluster_of_instance( self );
+  Scheduler_priority_Per_thread *sched_info_of_thread =
+    _Scheduler_priority_Get_scheduler_info( thread );
+  Chain_Control *ready_chain = sched_info_of_thread->ready_chain;
+
+  if ( _Chain_Has_only_one_node( ready_chain ) ) {
+    _Chain_Initialize_empty( ready_chain );
+    _Priority_bit_map_Table_remove(
+      &cluster->Bit_map,
+      &sched_info_of_thread->Priority_map
+    );
+  } else {
+    _Chain_Extract_unprotected( &thread->Object.Node );
+  }
 }
 
 static Thread_Control *_Scheduler_priority_SMP_Get_highest_ready(
   Scheduler_SMP_Control *self
 )
 {
+  Scheduler_priority_SMP_Cluster *cluster =
+    _Scheduler_priority_SMP_Cluster_of_instance( self );
   Thread_Control *highest_ready = NULL;
 
-  if ( !_Priority_bit_map_Is_empty() ) {
-    highest_ready = _Scheduler_priority_Ready_queue_first( &self->ready[ 0 ] );
+  if ( !_Priority_bit_map_Table_is_empty( &cluster->Bit_map ) ) {
+    Priority_Control index =
+      _Priority_bit_map_Table_get_highest( &cluster->Bit_map );
+
+    highest_ready = (Thread_Control *) _Chain_First( &self->ready[ index ] );
   }
 
   return highest_ready;
@@ -67,7 +225,7 @@ static void _Scheduler_priority_SMP_Move_from_scheduled_to_ready(
 )
 {
   _Chain_Extract_unprotected( &scheduled_to_ready->Object.Node );
-  _Scheduler_priority_Ready_queue_enqueue_first( scheduled_to_ready );
+  _Scheduler_priority_SMP_Ready_queue_enqueue_first( self, scheduled_to_ready );
 }
 
 static void _Scheduler_priority_SMP_Move_from_ready_to_scheduled(
@@ -75,7 +233,7 @@ static void _Scheduler_priority_SMP_Move_from_ready_to_scheduled(
   Thread_Control *ready_to_scheduled
 )
 {
-  _Scheduler_priority_Ready_queue_extract( ready_to_scheduled );
+  _Scheduler_priority_SMP_Ready_queue_extract( self, ready_to_scheduled );
   _Scheduler_simple_Insert_priority_fifo(
     &self->scheduled,
     ready_to_scheduled
@@ -87,7 +245,7 @@ static void _Scheduler_priority_SMP_Insert_ready_lifo(
   Thread_Control *thread
 )
 {
-  _Scheduler_priority_Ready_queue_enqueue( thread );
+  _Scheduler_priority_SMP_Ready_queue_enqueue( self, thread );
 }
 
 static void _Scheduler_priority_SMP_Insert_ready_fifo(
@@ -95,7 +253,7 @@ static void _Scheduler_priority_SMP_Insert_ready_fifo(
   Thread_Control *thread
 )
 {
-  _Scheduler_priority_Ready_queue_enqueue_first( thread );
+  _Scheduler_priority_SMP_Ready_queue_enqueue_first( self, thread );
 }
 
 static void _Scheduler_priority_SMP_Do_extract(
@@ -105,21 +263,20 @@ static void _Scheduler_priority_SMP_Do_extract(
 {
   bool is_scheduled = thread->is_scheduled;
 
-  ( void ) self;
-
   thread->is_in_the_air = is_scheduled;
   thread->is_scheduled = false;
 
   if ( is_scheduled ) {
     _Chain_Extract_unprotected( &thread->Object.Node );
   } else {
-    _Scheduler_priority_Ready_queue_extract( thread );
+    _Scheduler_priority_SMP_Ready_queue_extract( self, thread );
   }
 }
 
 void _Scheduler_priority_SMP_Block( Thread_Control *thread )
 {
-  Scheduler_SMP_Control *self = _Scheduler_SMP_Instance();
+  Scheduler_SMP_Control *self =
+    _Scheduler_priority_SMP_Instance_of_thread( thread );
 
   _Scheduler_SMP_Block(
     self,
@@ -152,7 +309,8 @@ static void _Scheduler_priority_SMP_Enqueue_ordered(
 
 void _Scheduler_priority_SMP_Enqueue_lifo( Thread_Control *thread )
 {
-  Scheduler_SMP_Control *self = _Scheduler_SMP_Instance();
+  Scheduler_SMP_Control *self =
+    _Scheduler_priority_SMP_Instance_of_thread( thread );
 
   _Scheduler_priority_SMP_Enqueue_ordered(
     self,
@@ -165,7 +323,8 @@ void _Scheduler_priority_SMP_Enqueue_lifo( Thread_Control *thread )
 
 void _Scheduler_priority_SMP_Enqueue_fifo( Thread_Control *thread )
 {
-  Scheduler_SMP_Control *self = _Scheduler_SMP_Instance();
+  Scheduler_SMP_Control *self =
+    _Scheduler_priority_SMP_Instance_of_thread( thread );
 
   _Scheduler_priority_SMP_Enqueue_ordered(
     self,
@@ -178,7 +337,8 @@ void _Scheduler_priority_SMP_Enqueue_fifo( Thread_Control *thread )
 
 void _Scheduler_priority_SMP_Extract( Thread_Control *thread )
 {
-  Scheduler_SMP_Control *self = _Scheduler_SMP_Instance();
+  Scheduler_SMP_Control *self =
+    _Scheduler_priority_SMP_Instance_of_thread( thread );
 
   _Scheduler_SMP_Extract(
     self,
@@ -201,7 +361,8 @@ void _Scheduler_priority_SMP_Yield( Thread_Control *thread )
 
 void _Scheduler_priority_SMP_Schedule( Thread_Control *thread )
 {
-  Scheduler_SMP_Control *self = _Scheduler_SMP_Instance();
+  Scheduler_SMP_Control *self =
+    _Scheduler_priority_SMP_Instance_of_thread( thread );
 
   _Scheduler_SMP_Schedule(
     self,
@@ -210,3 +371,97 @@ void _Scheduler_priority_SMP_Schedule( Thread_Control *thread )
     _Scheduler_priority_SMP_Move_from_ready_to_scheduled
   );
 }
+
+void _Scheduler_priority_SMP_Start_idle(
+  Thread_Control *thread,
+  Per_CPU_Control *cpu
+)
+{
+  Scheduler_priority_SMP_Control *control =
+    _Scheduler_priority_SMP_Get_control();
+  uint32_t cluster_index =
+    rtems_configuration_get_scheduler_cluster_of_processor(
+      _Per_CPU_Get_index( cpu )
+    );
+
+  if ( cluster_index >= control->cluster_count ) {
+    _Internal_error_Occurred(
+      INTERNAL_ERROR_CORE,
+      true,
+      INTERNAL_ERROR_SCHEDULER_INVALID_CLUSTER
+    );
+  }
+
+  _Scheduler_priority_SMP_Set_cluster_of_thread( thread, cluster_index );
+  _Scheduler_priority_SMP_Update( thread );
+  _Scheduler_SMP_Start_idle_on_instance(
+    _Scheduler_priority_SMP_Instance_of_thread( thread ),
+    thread,
+    cpu
+  );
+}
+
+uint32_t _Scheduler_priority_SMP_Get_cluster( Thread_Control *thread )
+{
+  return _Scheduler_priority_SMP_Get_scheduler_info( thread )->cluster_index;
+}
+
+bool _Scheduler_priority_SMP_Set_cluster(
+  Thread_Control *thread,
+  uint32_t cluster_index
+)
+{
+  Scheduler_SMP_Control *self;
+  Per_CPU_Control *cpu;
+  bool is_in_use;
+  bool is_ready;
+  ISR_Level level;
+
+  if ( cluster_index == _Scheduler_priority_SMP_Get_cluster( thread ) ) {
+    return true;
+  }
+
+  self = _Scheduler_priority_SMP_Instance_of_thread( thread );
+
+  /*
+   * Only the owner of the instance lock may allocate a processor to a thread
+   * of this cluster.  A scheduled thread may be dispatched at any time on its
+   * processor and an executing thread cannot move to a processor of another
+   * cluster since its context may not be saved yet.  A thread which is
+   * neither scheduled nor executing stays in this state as long as we own the
+   * instance lock, so the check and the extraction must use the same
+   * critical section.
+   */
+  _ISR_lock_ISR_disable_and_acquire( &self->Lock, level );
+
+  cpu = thread->cpu;
+  _Per_CPU_Acquire( cpu );
+  is_in_use = thread->is_scheduled || thread->is_executing;
+  _Per_CPU_Release( cpu );
+
+  if ( is_in_use ) {
+    _ISR_lock_Release_and_ISR_enable( &self->Lock, level );
+
+    return false;
+  }
+
+  is_ready = _States_Is_ready( thread->current_state );
+  if ( is_ready ) {
+    _Scheduler_priority_SMP_Ready_queue_extract( self, thread );
+  }
+
+  _Scheduler_priority_SMP_Set_cluster_of_thread( thread, cluster_index );
+  _Scheduler_priority_SMP_Update( thread );
+
+  _ISR_lock_Release_and_ISR_enable( &self->Lock, level );
+
+  /*
+   * Other scheduler operations on this thread are serialized by the Giant
+   * lock, so nobody can observe the thread between the two clusters.
+   */
+  if ( is_ready ) {
+    _Scheduler_priority_SMP_Enqueue_fifo( thread );
+  }
+
+  return true;
+}
@@ -27,6 +27,7 @@ void _Scheduler_simple_smp_Initialize( void )
   Scheduler_SMP_Control *self =
     _Workspace_Allocate_or_fatal_error( sizeof( *self ) );
 
+  _ISR_lock_Initialize( &self->Lock );
   _Chain_Initialize_empty( &self->ready[ 0 ] );
   _Chain_Initialize_empty( &self->scheduled );
 
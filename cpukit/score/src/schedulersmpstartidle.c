@@ -25,7 +25,6 @@
 #endif
 
 #include <rtems/score/schedulersmpimpl.h>
-#include <rtems/score/chainimpl.h>
 
 void _Scheduler_SMP_Start_idle(
   Thread_Control *thread,
@@ -34,7 +33,5 @@ void _Scheduler_SMP_Start_idle(
 {
   Scheduler_SMP_Control *self = _Scheduler_SMP_Instance();
 
-  thread->is_scheduled = true;
-  thread->cpu = cpu;
-  _Chain_Append_unprotected( &self->scheduled, &thread->Object.Node );
+  _Scheduler_SMP_Start_idle_on_instance( self, thread, cpu );
 }
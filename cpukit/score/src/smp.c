@@ -22,6 +22,7 @@
 #include <rtems/score/threaddispatch.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/smp.h>
+#include <rtems/score/smpjob.h>
 #include <rtems/score/sysstate.h>
 
 #if defined(RTEMS_DEBUG)
@@ -47,6 +48,9 @@ void rtems_smp_process_interrupt( void )
 {
   Per_CPU_Control *self_cpu = _Per_CPU_Get();
 
+  #if defined(RTEMS_ATOMIC)
+    _SMP_Job_process( self_cpu );
+  #endif
 
   if ( self_cpu->message != 0 ) {
     uint32_t  message;
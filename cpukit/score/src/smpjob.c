@@ -0,0 +1,155 @@
+/**
+ * @file
+ *
+ * @ingroup ScoreSMPJob
+ *
+ * @brief SMP Job Queue Implementation
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems/score/smpjob.h>
+
+#if defined( RTEMS_ATOMIC )
+
+void _SMP_Job_queue_initialize( SMP_Job_queue *queue )
+{
+  unsigned long i;
+
+  _Atomic_Init_ulong( &queue->enqueue_position, 0 );
+  _Atomic_Init_ulong( &queue->notification_pending, 0 );
+  queue->dequeue_position = 0;
+
+  for ( i = 0 ; i < SMP_JOB_QUEUE_SIZE ; ++i ) {
+    SMP_Job_slot *slot = &queue->slots[ i ];
+
+    _Atomic_Init_ulong( &slot->sequence, i );
+    slot->handler = NULL;
+    slot->arg = NULL;
+  }
+}
+
+bool _SMP_Job_post(
+  Per_CPU_Control *per_cpu,
+  SMP_Job_handler  handler,
+  void            *arg
+)
+{
+  SMP_Job_queue *queue = per_cpu->job_queue;
+  unsigned long position =
+    _Atomic_Load_ulong( &queue->enqueue_position, ATOMIC_ORDER_RELAXED );
+  SMP_Job_slot *slot;
+
+  while ( true ) {
+    unsigned long sequence;
+    long difference;
+
+    slot = &queue->slots[ position & ( SMP_JOB_QUEUE_SIZE - 1 ) ];
+    sequence = _Atomic_Load_ulong( &slot->sequence, ATOMIC_ORDER_ACQUIRE );
+    difference = (long) ( sequence - position );
+
+    if ( difference == 0 ) {
+      if (
+        _Atomic_Compare_exchange_ulong(
+          &queue->enqueue_position,
+          &position,
+          position + 1,
+          ATOMIC_ORDER_RELAXED,
+          ATOMIC_ORDER_RELAXED
+        )
+      ) {
+        break;
+      }
+    } else if ( difference < 0 ) {
+      /* The owner did not yet consume the job of the previous round */
+      return false;
+    } else {
+      position = _Atomic_Load_ulong(
+        &queue->enqueue_position,
+        ATOMIC_ORDER_RELAXED
+      );
+    }
+  }
+
+  slot->handler = handler;
+  slot->arg = arg;
+  _Atomic_Store_ulong( &slot->sequence, position + 1, ATOMIC_ORDER_RELEASE );
+
+  return true;
+}
+
+void _SMP_Job_notify( Per_CPU_Control *per_cpu )
+{
+  SMP_Job_queue *queue = per_cpu->job_queue;
+
+  /*
+   * The release order makes the jobs visible to the owner in case it clears
+   * the notification pending indicator after this exchange.
+   */
+  if (
+    _Atomic_Exchange_ulong(
+      &queue->notification_pending,
+      1,
+      ATOMIC_ORDER_RELEASE
+    ) == 0
+  ) {
+    _Per_CPU_Send_interrupt( per_cpu );
+  }
+}
+
+void _SMP_Job_process( Per_CPU_Control *per_cpu )
+{
+  SMP_Job_queue *queue = per_cpu->job_queue;
+  unsigned long position = queue->dequeue_position;
+
+  /*
+   * Clear the notification pending indicator before the queue is drained.
+   * Jobs posted after this point will trigger a new interrupt.
+   */
+  _Atomic_Exchange_ulong(
+    &queue->notification_pending,
+    0,
+    ATOMIC_ORDER_ACQUIRE
+  );
+
+  while ( true ) {
+    SMP_Job_slot *slot =
+      &queue->slots[ position & ( SMP_JOB_QUEUE_SIZE - 1 ) ];
+    unsigned long sequence =
+      _Atomic_Load_ulong( &slot->sequence, ATOMIC_ORDER_ACQUIRE );
+    SMP_Job_handler handler;
+    void *arg;
+
+    if ( sequence != position + 1 ) {
+      break;
+    }
+
+    handler = slot->handler;
+    arg = slot->arg;
+
+    _Atomic_Store_ulong(
+      &slot->sequence,
+      position + SMP_JOB_QUEUE_SIZE,
+      ATOMIC_ORDER_RELEASE
+    );
+
+    ++position;
+
+    ( *handler )( arg );
+  }
+
+  queue->dequeue_position = position;
+}
+
+#endif /* defined( RTEMS_ATOMIC ) */
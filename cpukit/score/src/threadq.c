@@ -21,6 +21,29 @@
 #include <rtems/score/threadqimpl.h>
 #include <rtems/score/chainimpl.h>
 
+int _Thread_queue_Compare_priority(
+  const RBTree_Node *left,
+  const RBTree_Node *right
+)
+{
+  Priority_Control left_priority;
+  Priority_Control right_priority;
+
+  left_priority =
+    _RBTree_Container_of( left, Thread_Control, Wait.Node )->current_priority;
+  right_priority =
+    _RBTree_Container_of( right, Thread_Control, Wait.Node )->current_priority;
+
+  /*
+   * SuperCore priorities use lower numbers to indicate greater importance.
+   */
+  if ( left_priority == right_priority )
+    return 0;
+  if ( left_priority < right_priority )
+    return -1;
+  return 1;
+}
+
 void _Thread_queue_Initialize(
   Thread_queue_Control         *the_thread_queue,
   Thread_queue_Disciplines      the_discipline,
@@ -33,13 +56,14 @@ void _Thread_queue_Initialize(
   the_thread_queue->timeout_status = timeout_status;
   the_thread_queue->sync_state     = THREAD_BLOCKING_OPERATION_SYNCHRONIZED;
 
-  if ( the_discipline == THREAD_QUEUE_DISCIPLINE_PRIORITY ) {
-    uint32_t   index;
+  _ISR_lock_Initialize( &the_thread_queue->Lock );
 
-    for( index=0 ;
-         index < TASK_QUEUE_DATA_NUMBER_OF_PRIORITY_HEADERS ;
-         index++)
-      _Chain_Initialize_empty( &the_thread_queue->Queues.Priority[index] );
+  if ( the_discipline == THREAD_QUEUE_DISCIPLINE_PRIORITY ) {
+    _RBTree_Initialize_empty(
+      &the_thread_queue->Queues.Priority,
+      _Thread_queue_Compare_priority,
+      false
+    );
   } else { /* must be THREAD_QUEUE_DISCIPLINE_FIFO */
     _Chain_Initialize_empty( &the_thread_queue->Queues.Fifo );
   }
@@ -37,7 +37,7 @@ Thread_Control *_Thread_queue_Dequeue(
     dequeue_p = _Thread_queue_Dequeue_fifo;
 
   the_thread = (*dequeue_p)( the_thread_queue );
-  _ISR_Disable( level );
+  _ISR_lock_ISR_disable_and_acquire( &the_thread_queue->Lock, level );
     if ( !the_thread ) {
       sync_state = the_thread_queue->sync_state;
       if ( (sync_state == THREAD_BLOCKING_OPERATION_TIMEOUT) ||
@@ -46,6 +46,6 @@ Thread_Control *_Thread_queue_Dequeue(
         the_thread = _Thread_Executing;
       }
     }
-  _ISR_Enable( level );
+  _ISR_lock_Release_and_ISR_enable( &the_thread_queue->Lock, level );
   return the_thread;
 }
@@ -31,7 +31,7 @@ Thread_Control *_Thread_queue_Dequeue_fifo(
   ISR_Level              level;
   Thread_Control *the_thread;
 
-  _ISR_Disable( level );
+  _ISR_lock_ISR_disable_and_acquire( &the_thread_queue->Lock, level );
   if ( !_Chain_Is_empty( &the_thread_queue->Queues.Fifo ) ) {
 
     the_thread = (Thread_Control *)
@@ -39,11 +39,11 @@ Thread_Control *_Thread_queue_Dequeue_fifo(
 
     the_thread->Wait.queue = NULL;
     if ( !_Watchdog_Is_active( &the_thread->Timer ) ) {
-      _ISR_Enable( level );
+      _ISR_lock_Release_and_ISR_enable( &the_thread_queue->Lock, level );
       _Thread_Unblock( the_thread );
     } else {
       _Watchdog_Deactivate( &the_thread->Timer );
-      _ISR_Enable( level );
+      _ISR_lock_Release_and_ISR_enable( &the_thread_queue->Lock, level );
       (void) _Watchdog_Remove( &the_thread->Timer );
       _Thread_Unblock( the_thread );
     }
@@ -56,6 +56,6 @@ Thread_Control *_Thread_queue_Dequeue_fifo(
     return the_thread;
   }
 
-  _ISR_Enable( level );
+  _ISR_lock_Release_and_ISR_enable( &the_thread_queue->Lock, level );
   return NULL;
 }
@@ -74,6 +74,8 @@ void _Thread_queue_Enqueue_with_handler(
     enqueue_p = _Thread_queue_Enqueue_fifo;
 
   sync_state = (*enqueue_p)( the_thread_queue, the_thread, &level );
-  if ( sync_state != THREAD_BLOCKING_OPERATION_NOTHING_HAPPENED )
+  if ( sync_state != THREAD_BLOCKING_OPERATION_NOTHING_HAPPENED ) {
+    _ISR_lock_Release( &the_thread_queue->Lock );
     _Thread_blocking_operation_Cancel( sync_state, the_thread, level );
+  }
 }
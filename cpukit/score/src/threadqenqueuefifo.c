@@ -31,7 +31,7 @@ Thread_blocking_operation_States _Thread_queue_Enqueue_fifo (
   Thread_blocking_operation_States sync_state;
   ISR_Level                        level;
 
-  _ISR_Disable( level );
+  _ISR_lock_ISR_disable_and_acquire( &the_thread_queue->Lock, level );
 
     sync_state = the_thread_queue->sync_state;
     the_thread_queue->sync_state = THREAD_BLOCKING_OPERATION_SYNCHRONIZED;
@@ -43,7 +43,7 @@ Thread_blocking_operation_States _Thread_queue_Enqueue_fifo (
       the_thread->Wait.queue = the_thread_queue;
 
       the_thread_queue->sync_state = THREAD_BLOCKING_OPERATION_SYNCHRONIZED;
-      _ISR_Enable( level );
+      _ISR_lock_Release_and_ISR_enable( &the_thread_queue->Lock, level );
       return THREAD_BLOCKING_OPERATION_NOTHING_HAPPENED;
     }
 
@@ -52,7 +52,7 @@ Thread_blocking_operation_States _Thread_queue_Enqueue_fifo (
    *  For example, the blocking thread could have been given
    *  the mutex by an ISR or timed out.
    *
-   *  WARNING! Returning with interrupts disabled!
+   *  WARNING! Returning with interrupts disabled and the lock acquired!
    */
   *level_p = level;
   return sync_state;
@@ -26,15 +26,16 @@
 #include <rtems/score/watchdogimpl.h>
 
 bool _Thread_queue_Extract_fifo(
+  Thread_queue_Control *the_thread_queue,
   Thread_Control       *the_thread
 )
 {
   ISR_Level level;
 
-  _ISR_Disable( level );
+  _ISR_lock_ISR_disable_and_acquire( &the_thread_queue->Lock, level );
 
   if ( !_States_Is_waiting_on_thread_queue( the_thread->current_state ) ) {
-    _ISR_Enable( level );
+    _ISR_lock_Release_and_ISR_enable( &the_thread_queue->Lock, level );
     return false;
   }
 
@@ -43,10 +44,10 @@ bool _Thread_queue_Extract_fifo(
   the_thread->Wait.queue = NULL;
 
   if ( !_Watchdog_Is_active( &the_thread->Timer ) ) {
-    _ISR_Enable( level );
+    _ISR_lock_Release_and_ISR_enable( &the_thread_queue->Lock, level );
   } else {
     _Watchdog_Deactivate( &the_thread->Timer );
-    _ISR_Enable( level );
+    _ISR_lock_Release_and_ISR_enable( &the_thread_queue->Lock, level );
     (void) _Watchdog_Remove( &the_thread->Timer );
   }
 
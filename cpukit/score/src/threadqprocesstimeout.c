@@ -43,16 +43,20 @@ void _Thread_queue_Process_timeout(
   _ISR_Disable( level );
   the_thread_queue = the_thread->Wait.queue;
   if ( the_thread_queue != NULL ) {
+    _ISR_lock_Acquire( &the_thread_queue->Lock );
+
     if ( the_thread_queue->sync_state != THREAD_BLOCKING_OPERATION_SYNCHRONIZED &&
          _Thread_Is_executing( the_thread ) ) {
       if ( the_thread_queue->sync_state != THREAD_BLOCKING_OPERATION_SATISFIED ) {
         the_thread->Wait.return_code = the_thread_queue->timeout_status;
         the_thread_queue->sync_state = THREAD_BLOCKING_OPERATION_TIMEOUT;
       }
+      _ISR_lock_Release( &the_thread_queue->Lock );
       _ISR_Enable( level );
     } else {
       bool we_did_it;
 
+      _ISR_lock_Release( &the_thread_queue->Lock );
       _ISR_Enable( level );
 
       /*
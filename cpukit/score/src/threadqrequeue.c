@@ -38,15 +38,19 @@ void _Thread_queue_Requeue(
    * priority blocking discipline.
    */
   if ( the_thread_queue->discipline == THREAD_QUEUE_DISCIPLINE_PRIORITY ) {
-    Thread_queue_Control *tq = the_thread_queue;
-    ISR_Level             level;
-    ISR_Level             level_ignored;
+    Thread_queue_Control             *tq = the_thread_queue;
+    ISR_Level                         level;
+    ISR_Level                         level_ignored;
+    Thread_blocking_operation_States  sync_state;
 
     _ISR_Disable( level );
     if ( _States_Is_waiting_on_thread_queue( the_thread->current_state ) ) {
       _Thread_queue_Enter_critical_section( tq );
-      _Thread_queue_Extract_priority_helper( the_thread, true );
-      (void) _Thread_queue_Enqueue_priority( tq, the_thread, &level_ignored );
+      _Thread_queue_Extract_priority_helper( tq, the_thread, true );
+      sync_state =
+        _Thread_queue_Enqueue_priority( tq, the_thread, &level_ignored );
+      if ( sync_state != THREAD_BLOCKING_OPERATION_NOTHING_HAPPENED )
+        _ISR_lock_Release( &tq->Lock );
     }
     _ISR_Enable( level );
   }
@@ -23,14 +23,14 @@
 #include <rtems/score/watchdogimpl.h>
 
 void _Watchdog_Adjust(
-  Chain_Control               *header,
+  Watchdog_Header             *header,
   Watchdog_Adjust_directions   direction,
   Watchdog_Interval            units
 )
 {
   ISR_Level level;
 
-  _ISR_Disable( level );
+  _ISR_lock_ISR_disable_and_acquire( &_Watchdog_Lock, level );
 
   /*
    * NOTE: It is safe NOT to make 'header' a pointer
@@ -41,7 +41,7 @@ void _Watchdog_Adjust(
    *
    *       Till Straumann, 7/2003
    */
-  if ( !_Chain_Is_empty( header ) ) {
+  if ( !_Watchdog_Is_empty( header ) ) {
     switch ( direction ) {
       case WATCHDOG_BACKWARD:
         _Watchdog_First( header )->delta_interval += units;
@@ -55,13 +55,13 @@ void _Watchdog_Adjust(
             units -= _Watchdog_First( header )->delta_interval;
             _Watchdog_First( header )->delta_interval = 1;
 
-            _ISR_Enable( level );
+            _ISR_lock_Release_and_ISR_enable( &_Watchdog_Lock, level );
 
             _Watchdog_Tickle( header );
 
-            _ISR_Disable( level );
+            _ISR_lock_ISR_disable_and_acquire( &_Watchdog_Lock, level );
 
-            if ( _Chain_Is_empty( header ) )
+            if ( _Watchdog_Is_empty( header ) )
               break;
           }
         }
@@ -69,6 +69,6 @@ void _Watchdog_Adjust(
     }
   }
 
-  _ISR_Enable( level );
+  _ISR_lock_Release_and_ISR_enable( &_Watchdog_Lock, level );
 
 }
@@ -23,7 +23,7 @@
 #include <rtems/score/watchdogimpl.h>
 
 void _Watchdog_Adjust_to_chain(
-  Chain_Control               *header,
+  Watchdog_Header             *header,
   Watchdog_Interval            units_arg,
   Chain_Control               *to_fire
 
@@ -33,10 +33,10 @@ void _Watchdog_Adjust_to_chain(
   ISR_Level          level;
   Watchdog_Control  *first;
 
-  _ISR_Disable( level );
+  _ISR_lock_ISR_disable_and_acquire( &_Watchdog_Lock, level );
 
   while ( 1 ) {
-    if ( _Chain_Is_empty( header ) ) {
+    if ( _Watchdog_Is_empty( header ) ) {
       break;
     }
     first = _Watchdog_First( header );
@@ -58,12 +58,15 @@ void _Watchdog_Adjust_to_chain(
     first->delta_interval = 0;
 
     while ( 1 ) {
+      _Watchdog_Index_extract( first );
       _Chain_Extract_unprotected( &first->Node );
       _Chain_Append_unprotected( to_fire, &first->Node );
 
+#if !defined( RTEMS_SMP )
       _ISR_Flash( level );
+#endif
 
-      if ( _Chain_Is_empty( header ) )
+      if ( _Watchdog_Is_empty( header ) )
         break;
       first = _Watchdog_First( header );
       if ( first->delta_interval != 0 )
@@ -71,6 +74,6 @@ void _Watchdog_Adjust_to_chain(
     }
   }
 
-  _ISR_Enable( level );
+  _ISR_lock_Release_and_ISR_enable( &_Watchdog_Lock, level );
 }
 
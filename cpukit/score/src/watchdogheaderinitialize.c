@@ -0,0 +1,53 @@
+/**
+ * @file
+ *
+ * @brief Watchdog Header Initialize
+ * @ingroup ScoreWatchdog
+ */
+
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#if HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+
+static int _Watchdog_Index_compare(
+  const RBTree_Node *first,
+  const RBTree_Node *second
+)
+{
+  int64_t first_expire =
+    _RBTree_Container_of( first, Watchdog_Control, Index_node )->expire;
+  int64_t second_expire =
+    _RBTree_Container_of( second, Watchdog_Control, Index_node )->expire;
+
+  if ( first_expire < second_expire ) {
+    return -1;
+  } else if ( first_expire > second_expire ) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+void _Watchdog_Header_initialize( Watchdog_Header *header )
+{
+  _Chain_Initialize_empty( &header->Watchdogs );
+
+  /*
+   *  Watchdogs with equal expiration times are inserted after each other,
+   *  thus the index tree must accept duplicate keys.
+   */
+  _RBTree_Initialize_empty( &header->Index, _Watchdog_Index_compare, false );
+
+  header->first_changed = NULL;
+}
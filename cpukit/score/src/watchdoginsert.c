@@ -23,19 +23,20 @@
 #include <rtems/score/watchdogimpl.h>
 
 void _Watchdog_Insert(
-  Chain_Control         *header,
+  Watchdog_Header       *header,
   Watchdog_Control      *the_watchdog
 )
 {
   ISR_Level          level;
-  Watchdog_Control  *after;
-  uint32_t           insert_isr_nest_level;
+  Watchdog_Control  *first;
+  Chain_Node        *after;
+  Chain_Node        *next;
+  RBTree_Node       *previous;
+  int64_t            now;
   Watchdog_Interval  delta_interval;
+  Watchdog_First_changed_routine first_changed;
 
-
-  insert_isr_nest_level   = _ISR_Nest_level;
-
-  _ISR_Disable( level );
+  _ISR_lock_ISR_disable_and_acquire( &_Watchdog_Lock, level );
 
   /*
    *  Check to see if the watchdog has just been inserted by a
@@ -43,52 +44,64 @@ void _Watchdog_Insert(
    */
 
   if ( the_watchdog->state != WATCHDOG_INACTIVE ) {
-    _ISR_Enable( level );
+    _ISR_lock_Release_and_ISR_enable( &_Watchdog_Lock, level );
     return;
   }
 
-  the_watchdog->state = WATCHDOG_BEING_INSERTED;
-  _Watchdog_Sync_count++;
-
-restart:
-  delta_interval = the_watchdog->initial;
-
-  for ( after = _Watchdog_First( header ) ;
-        ;
-        after = _Watchdog_Next( after ) ) {
-
-     if ( delta_interval == 0 || !_Watchdog_Next( after ) )
-       break;
-
-     if ( delta_interval < after->delta_interval ) {
-       after->delta_interval -= delta_interval;
-       break;
-     }
+  /*
+   *  The expiration times on the index tree are relative to an arbitrary
+   *  time base.  The current time in this time base is derived from the
+   *  first watchdog, so that changes of the first delta interval, e.g. by a
+   *  tick or an adjust operation, move the current time and leave the
+   *  expiration times of the other watchdogs intact.
+   */
+  if ( _Watchdog_Is_empty( header ) ) {
+    now = 0;
+  } else {
+    first = _Watchdog_First( header );
+    now = first->expire - (int64_t) first->delta_interval;
+  }
 
-     delta_interval -= after->delta_interval;
+  the_watchdog->expire = now + (int64_t) the_watchdog->initial;
 
-     _ISR_Flash( level );
+  /*
+   *  The index tree places the watchdog after all watchdogs with an equal
+   *  expiration time.  Its predecessor on the tree is its predecessor on the
+   *  delta chain.
+   */
+  _RBTree_Insert_unprotected( &header->Index, &the_watchdog->Index_node );
+
+  previous = _RBTree_Predecessor_unprotected( &the_watchdog->Index_node );
+  if ( previous != NULL ) {
+    Watchdog_Control *previous_watchdog =
+      _RBTree_Container_of( previous, Watchdog_Control, Index_node );
+
+    delta_interval =
+      (Watchdog_Interval) ( the_watchdog->expire - previous_watchdog->expire );
+    after = &previous_watchdog->Node;
+  } else {
+    delta_interval = the_watchdog->initial;
+    after = _Chain_Head( &header->Watchdogs );
+  }
 
-     if ( the_watchdog->state != WATCHDOG_BEING_INSERTED ) {
-       goto exit_insert;
-     }
+  first_changed = previous == NULL ? header->first_changed : NULL;
 
-     if ( _Watchdog_Sync_level > insert_isr_nest_level ) {
-       _Watchdog_Sync_level = insert_isr_nest_level;
-       goto restart;
-     }
+  next = _Chain_Next( after );
+  if ( !_Chain_Is_tail( &header->Watchdogs, next ) ) {
+    ( (Watchdog_Control *) next )->delta_interval -= delta_interval;
   }
 
   _Watchdog_Activate( the_watchdog );
 
   the_watchdog->delta_interval = delta_interval;
 
-  _Chain_Insert_unprotected( after->Node.previous, &the_watchdog->Node );
+  _Chain_Insert_unprotected( after, &the_watchdog->Node );
 
   the_watchdog->start_time = _Watchdog_Ticks_since_boot;
 
-exit_insert:
-  _Watchdog_Sync_level = insert_isr_nest_level;
-  _Watchdog_Sync_count--;
-  _ISR_Enable( level );
+  _ISR_lock_Release_and_ISR_enable( &_Watchdog_Lock, level );
+
+  if ( first_changed != NULL ) {
+    ( *first_changed )();
+  }
 }
@@ -22,29 +22,18 @@
 #include <rtems/score/isr.h>
 #include <rtems/score/watchdogimpl.h>
 
-Watchdog_States _Watchdog_Remove(
+Watchdog_States _Watchdog_Remove_it(
   Watchdog_Control *the_watchdog
 )
 {
-  ISR_Level         level;
   Watchdog_States   previous_state;
   Watchdog_Control *next_watchdog;
 
-  _ISR_Disable( level );
   previous_state = the_watchdog->state;
   switch ( previous_state ) {
     case WATCHDOG_INACTIVE:
       break;
 
-    case WATCHDOG_BEING_INSERTED:
-
-      /*
-       *  It is not actually on the chain so just change the state and
-       *  the Insert operation we interrupted will be aborted.
-       */
-      the_watchdog->state = WATCHDOG_INACTIVE;
-      break;
-
     case WATCHDOG_ACTIVE:
     case WATCHDOG_REMOVE_IT:
 
@@ -54,14 +43,25 @@ Watchdog_States _Watchdog_Remove(
       if ( _Watchdog_Next(next_watchdog) )
         next_watchdog->delta_interval += the_watchdog->delta_interval;
 
-      if ( _Watchdog_Sync_count )
-        _Watchdog_Sync_level = _ISR_Nest_level;
-
+      _Watchdog_Index_extract( the_watchdog );
       _Chain_Extract_unprotected( &the_watchdog->Node );
       break;
   }
   the_watchdog->stop_time = _Watchdog_Ticks_since_boot;
 
-  _ISR_Enable( level );
+  return( previous_state );
+}
+
+Watchdog_States _Watchdog_Remove(
+  Watchdog_Control *the_watchdog
+)
+{
+  ISR_Level       level;
+  Watchdog_States previous_state;
+
+  _ISR_lock_ISR_disable_and_acquire( &_Watchdog_Lock, level );
+  previous_state = _Watchdog_Remove_it( the_watchdog );
+  _ISR_lock_Release_and_ISR_enable( &_Watchdog_Lock, level );
+
   return( previous_state );
 }
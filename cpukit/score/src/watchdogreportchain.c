@@ -24,7 +24,7 @@
 
 void _Watchdog_Report_chain(
   const char        *name,
-  Chain_Control     *header
+  Watchdog_Header   *header
 )
 {
   ISR_Level          level;
@@ -33,9 +33,9 @@ void _Watchdog_Report_chain(
   _Thread_Disable_dispatch();
   _ISR_Disable( level );
     printk( "Watchdog Chain: %s %p\n", name, header );
-    if ( !_Chain_Is_empty( header ) ) {
-      for ( node = _Chain_First( header ) ;
-            node != _Chain_Tail(header) ;
+    if ( !_Watchdog_Is_empty( header ) ) {
+      for ( node = _Chain_First( &header->Watchdogs ) ;
+            node != _Chain_Tail( &header->Watchdogs ) ;
             node = node->next )
       {
         Watchdog_Control *watch = (Watchdog_Control *) node;
@@ -23,7 +23,7 @@
 #include <rtems/score/watchdogimpl.h>
 
 void _Watchdog_Tickle(
-  Chain_Control *header
+  Watchdog_Header *header
 )
 {
   ISR_Level level;
@@ -36,9 +36,9 @@ void _Watchdog_Tickle(
    * volatile data - till, 2003/7
    */
 
-  _ISR_Disable( level );
+  _ISR_lock_ISR_disable_and_acquire( &_Watchdog_Lock, level );
 
-  if ( _Chain_Is_empty( header ) )
+  if ( _Watchdog_Is_empty( header ) )
     goto leave;
 
   the_watchdog = _Watchdog_First( header );
@@ -75,9 +75,9 @@ void _Watchdog_Tickle(
   }
 
   do {
-     watchdog_state = _Watchdog_Remove( the_watchdog );
+     watchdog_state = _Watchdog_Remove_it( the_watchdog );
 
-     _ISR_Enable( level );
+     _ISR_lock_Release_and_ISR_enable( &_Watchdog_Lock, level );
 
      switch( watchdog_state ) {
        case WATCHDOG_ACTIVE:
@@ -95,24 +95,16 @@ void _Watchdog_Tickle(
           */
          break;
 
-       case WATCHDOG_BEING_INSERTED:
-         /*
-          *  This state indicates that the watchdog is in the process of
-          *  BEING inserted on the chain.  Thus, it can NOT be on a chain
-          *  being tickled.  This case should never occur.
-          */
-         break;
-
        case WATCHDOG_REMOVE_IT:
          break;
      }
 
-     _ISR_Disable( level );
+     _ISR_lock_ISR_disable_and_acquire( &_Watchdog_Lock, level );
 
      the_watchdog = _Watchdog_First( header );
-   } while ( !_Chain_Is_empty( header ) &&
+   } while ( !_Watchdog_Is_empty( header ) &&
              (the_watchdog->delta_interval == 0) );
 
 leave:
-   _ISR_Enable(level);
+   _ISR_lock_Release_and_ISR_enable( &_Watchdog_Lock, level );
 }
@@ -93,6 +93,17 @@ void _Workspace_Handler_initialization(
       INTERNAL_ERROR_TOO_LITTLE_WORKSPACE
     );
   }
+
+  if (
+    rtems_configuration_get_segregated_fit_heaps()
+      && !_Heap_Enable_segregated_fit( &_Workspace_Area )
+  ) {
+    _Internal_error_Occurred(
+      INTERNAL_ERROR_CORE,
+      true,
+      INTERNAL_ERROR_TOO_LITTLE_WORKSPACE
+    );
+  }
 }
 
 void *_Workspace_Allocate(
@@ -286,6 +286,15 @@ to forward the packet to the network stack.   The arguments to @code{ether_input
 are a pointer to the interface data structure, a pointer to the ethernet
 header and a pointer to an mbuf containing the packet itself.
 
+A driver which receives into its own DMA buffers may pass a buffer up
+without copying it into mbuf clusters with @code{m_devget}.  The
+@code{MEXTADD(m, buf, size, free, ref)} macro attaches the buffer as
+external storage to an mbuf.  The network stack calls the @code{ref}
+routine for each copy of the mbuf which shares the buffer and the
+@code{free} routine for each released reference.  The driver may reuse
+the buffer for reception once all references are released.  Both
+routines are called with the network semaphore held.
+
 
 
 
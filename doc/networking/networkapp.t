@@ -101,6 +101,8 @@ struct rtems_bsdnet_config @{
   unsigned long        tcp_tx_buf_size;
   /* TCP TX: 16 * 1024 bytes */
   unsigned long        tcp_rx_buf_size;
+  unsigned long        mbuf_max_bytecount;         /* 0 */
+  unsigned long        mbuf_cluster_max_bytecount; /* 0 */
 @};
 @end group
 @end example
@@ -229,6 +231,19 @@ This configuration parameter specifies the maximum amount of
 buffer memory which may be used for TCP sockets to receive
 into.  The default size is sixteen kilobytes.
 
+@item unsigned long mbuf_max_bytecount
+The maximum number of bytes of heap memory which may be used for mbufs.
+When the mbufs allocated according to @code{mbuf_bytecount} are
+exhausted, the pool grows in chunks up to this limit instead of
+blocking the allocating task.  Chunks which remain unused for a while
+are returned to the heap.  If a value of 0, or a value not larger than
+@code{mbuf_bytecount}, is specified the pool does not grow.
+
+@item unsigned long mbuf_cluster_max_bytecount
+The maximum number of bytes of heap memory which may be used for mbuf
+clusters.  It works like @code{mbuf_max_bytecount} for the clusters
+allocated according to @code{mbuf_cluster_bytecount}.
+
 @end table
 
 In addition, the following fields in the @code{rtems_bsdnet_ifconfig}
@@ -362,10 +377,12 @@ services.  The network functions work like their BSD counterparts
 with the following exceptions:
 
 @itemize @bullet
-@item A given socket can be read or written by only one task at a time.
+@item Several tasks may read or write a given socket.  The tasks take turns
+for each read or write call.
 
-@item The @code{select} function only works for file descriptors associated
-with sockets.
+@item The @code{select} and @code{poll} functions only work for file
+descriptors associated with sockets.  The @code{poll} function reports
+@code{POLLNVAL} for other file descriptors.
 
 @item You must call @code{openlog} before calling any of the @code{syslog} functions.
 
@@ -415,7 +432,10 @@ Display TCP packet statistics.
 Display UDP packet statistics.
 
 @item rtems_bsdnet_show_mbuf_stats
-Display mbuf statistics.
+Display mbuf statistics.  Besides the pool sizes and the use by type
+this includes the most mbufs and clusters in use at once, the number
+of chunks by which the pools grew and shrank, and the total and
+longest time in clock ticks tasks waited for an mbuf or cluster.
 
 @item rtems_bsdnet_show_inet_routes
 Display the routing table.
@@ -531,6 +551,74 @@ a server "listening" socket becomes readable it indicates that a client
 has connected and accept can be called without blocking, not that
 network data was received (Condition 1.c).
 
+@subsection Event Queues
+
+The @code{select} function checks all its file descriptors each time
+a socket becomes ready.  An event queue avoids this for a large number of
+sockets.  A socket is registered once with an event queue and each
+socket wakeup pushes the socket onto the queue, so a wait only checks
+the sockets which had a wakeup.  The @code{poll} function uses the same
+mechanism with a temporary event queue.
+
+@example
+rtems_bsdnet_evq *rtems_bsdnet_evq_create (void);
+int rtems_bsdnet_evq_destroy (rtems_bsdnet_evq *evq);
+int rtems_bsdnet_evq_ctl (rtems_bsdnet_evq *evq, int op, int fd,
+                          short events, int flags, void *udata);
+int rtems_bsdnet_evq_wait (rtems_bsdnet_evq *evq,
+                           struct rtems_bsdnet_evq_event *events,
+                           int maxevents, int timeout);
+@end example
+
+The @code{op} parameter of @code{rtems_bsdnet_evq_ctl} is
+@code{RTEMS_BSDNET_EVQ_ADD}, @code{RTEMS_BSDNET_EVQ_MOD} or
+@code{RTEMS_BSDNET_EVQ_DEL}.  The @code{events} are the @code{poll} events
+@code{POLLIN}, @code{POLLRDNORM}, @code{POLLPRI}, @code{POLLRDBAND},
+@code{POLLOUT} and @code{POLLWRNORM}.  A socket is ready under the same
+conditions as for @code{select}.
+
+The @code{rtems_bsdnet_evq_wait} function returns the number of ready
+sockets.  For each socket it stores the file descriptor, the ready events
+and the @code{udata} value of the registration.  The @code{timeout} is in
+milliseconds, a value of -1 waits forever.  Only one task at a time may
+wait on an event queue.
+
+A socket is level-triggered by default and is reported by each wait as
+long as it is ready.  With the @code{RTEMS_BSDNET_EVQ_EDGE} flag a socket
+is reported once for each wakeup, for example the arrival of data.  A
+closed socket is removed from all event queues.
+
+@subsection Zero-Copy Sockets
+
+The @code{send} and @code{recv} functions copy the data between the user
+buffer and mbuf clusters.  The zero-copy functions avoid this copy.  The
+application fills mbufs for sending and receives the mbuf chain of the
+socket buffer.
+
+@example
+struct mbuf *rtems_bsdnet_mbuf_alloc (size_t size);
+void rtems_bsdnet_mbuf_free (struct mbuf *m);
+ssize_t rtems_bsdnet_sendto_mbuf (int s, struct mbuf *m, int flags,
+                                  const struct sockaddr *to, int tolen);
+ssize_t rtems_bsdnet_recvfrom_mbuf (int s, struct mbuf **mp, size_t len,
+                                    int flags, struct sockaddr *from,
+                                    int *fromlen);
+@end example
+
+The @code{rtems_bsdnet_mbuf_alloc} function returns an mbuf for up to
+@code{MCLBYTES} of data.  The application stores the data at
+@code{mtod(m, char *)}, sets @code{m->m_len} and may link further mbufs
+with @code{m->m_next}.  The @code{rtems_bsdnet_sendto_mbuf} function
+consumes the mbuf chain, also in case of an error.  For a stream socket
+the chain must fit into the socket send buffer.
+
+The @code{rtems_bsdnet_recvfrom_mbuf} function returns an mbuf chain
+with up to @code{len} bytes.  The application frees the chain with
+@code{rtems_bsdnet_mbuf_free}.  The flags @code{MSG_OOB} and
+@code{MSG_PEEK} are not supported.  The @code{<sys/mbuf.h>} header file
+which defines the mbuf structure redefines @code{malloc} and @code{free}
+as the network stack versions.
+
 @subsection Adding an IP Alias
 
 The following code snippet adds an IP alias:
@@ -310,6 +310,11 @@ monotonic periods in the application or to reset the rate monotonic
 period usage statistics. When invoked with the @code{-r} option, the
 usage statistics are reset.
 
+For periods with enabled latency histograms, the report also contains
+the P50, P90, P99 and P99.9 percentiles of the release jitter, the
+execution time and the response time as well as the most recent
+deadline misses.  The @code{-r} option clears the histograms as well.
+
 @subheading EXIT STATUS:
 
 This command returns 0 on success and non-zero if an error is encountered.
@@ -1669,6 +1669,52 @@ RTEMS "unlimited" objects option.  You will be able to create objects
 until you run out of all available memory rather then just until you
 run out of RTEMS Workspace.
 
+@c
+@c === CONFIGURE_SEGREGATED_FIT_HEAPS ===
+@c
+@subsection Segregated Fit Heaps
+
+@findex CONFIGURE_SEGREGATED_FIT_HEAPS
+@cindex segregated fit heaps
+@cindex RTEMS Workspace
+@cindex C Program Heap
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_SEGREGATED_FIT_HEAPS}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default, which specifies that the C Program Heap
+and the RTEMS Workspace use the first fit allocation mode.
+
+@end table
+
+@subheading DESCRIPTION:
+When defined, the C Program Heap and the RTEMS Workspace use the
+segregated fit allocation mode.  The free blocks are kept on segregated
+free lists indexed by size.  A free list with blocks large enough for a
+request is found in constant time and the first block of this list is
+taken.
+
+When not defined, the heaps search a single free list for the first block
+large enough.
+
+@subheading NOTES:
+The first fit allocation time grows with the fragmentation of the heap.
+The segregated fit allocation mode avoids this for most requests at the
+cost of about two kilobytes per heap on 32-bit targets for the free
+lists.  If no such free list exists or its first block cannot satisfy an
+alignment or boundary constraint, then the free lists which may contain a
+large enough block are searched block by block.  This fallback is a
+linear search, so the worst case allocation time still depends on the
+count of free blocks.
+
 @c
 @c === CONFIGURE_MICROSECONDS_PER_TICK ===
 @c
@@ -2343,6 +2389,41 @@ of routines.
 @subheading NOTES:
 None.
 
+@c
+@c === CONFIGURE_MALLOC_PER_CPU_CACHES ===
+@c
+@subsection Enable Per-CPU Malloc Caches
+
+@findex CONFIGURE_MALLOC_PER_CPU_CACHES
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_MALLOC_PER_CPU_CACHES}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default, and the C Malloc Family allocates all
+memory directly from the C Program Heap.
+
+@end table
+
+@subheading DESCRIPTION:
+This configuration parameter is defined when the application wishes each
+processor to keep a cache of small free objects in front of the C Program
+Heap.  Requests up to 256 bytes are satisfied from the cache of the current
+processor without the allocator lock.  Empty caches are refilled and full
+caches are flushed in batches.
+
+@subheading NOTES:
+Objects held in a cache are accounted as used memory of the C Program
+Heap.  The cache hit and miss counts are reported by
+@code{malloc_get_statistics} and the @code{malloc stats} shell command.
+
 @c
 @c === CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS ===
 @c
@@ -2823,6 +2904,11 @@ A value of 0 disables the read-ahead task (default).  The read-ahead task will
 issue speculative read transfers if a sequential access pattern is detected.
 This can improve the performance on some systems.
 
+The read-ahead window of each disk device starts with two blocks for a new
+sequential access stream and doubles with each read-ahead request up to this
+maximum.  The current window is reported by
+@code{rtems_bdbuf_get_device_stats}.
+
 @c
 @c === CONFIGURE_BDBUF_MAX_WRITE_BLOCKS ===
 @c
@@ -3561,6 +3647,8 @@ This is not defined by default.
 The Deterministic Priority SMP Scheduler is derived from the Deterministic
 Priority Scheduler but is capable of scheduling threads across multiple
 processors.
+It may partition the processors into clusters, see
+@code{CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT}.
 
 In a configuration with SMP enabled at configure time, it may be
 explicitly selected by defining @code{CONFIGURE_SCHEDULER_PRIORITY_SMP}.
@@ -3572,6 +3660,45 @@ support enabled.
 This scheduler is currently the default in SMP configurations and is
 only selected when @code{CONFIGURE_SMP_APPLICATION} is defined.
 
+@c
+@c === CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP ===
+@c
+@subsection Use Deterministic Priority Affinity SMP Scheduler
+
+@findex CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP}
+
+@item DATA TYPE:
+Boolean feature macro.
+
+@item RANGE:
+Defined or undefined.
+
+@item DEFAULT VALUE:
+This is not defined by default.
+
+@end table
+
+@subheading DESCRIPTION:
+The Deterministic Priority Affinity SMP Scheduler is derived from the
+Deterministic Priority SMP Scheduler.  It executes each thread only on the
+processors of its processor affinity, see the chapter Symmetric
+Multiprocessing Services.
+
+In a configuration with SMP enabled at configure time, it may be
+explicitly selected by defining
+@code{CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP}.
+
+@subheading NOTES:
+This scheduler is only available when RTEMS is configured with SMP
+support enabled and the C library provides @code{<sys/cpuset.h>}.
+
+The scheduler operations are not constant time.  In the worst case they
+visit all ready threads and for each of them all processors.
+
 @c
 @c === CONFIGURE_SCHEDULER_SIMPLE_SMP ===
 @c
@@ -3732,6 +3859,84 @@ CPU cores in the SMP configuration.
 If there are more cores available than configured, the rest will be
 ignored.
 
+@c
+@c === CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT ===
+@c
+@subsection Specify Count of Processor Clusters
+
+@findex CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT}
+
+@item DATA TYPE:
+Unsigned integer (@code{uint32_t}).
+
+@item RANGE:
+Positive.
+
+@item DEFAULT VALUE:
+The default value is 1, (if CONFIGURE_SMP_APPLICATION is defined).
+
+@end table
+
+@subheading DESCRIPTION:
+@code{CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT} is the count of processor
+clusters.  Each cluster is an instance of the scheduler with its own set
+of ready tasks.  A task executes only on the processors of its cluster,
+see the chapter Symmetric Multiprocessing Services.
+
+@subheading NOTES:
+More than one cluster requires the Deterministic Priority SMP Scheduler,
+see @code{CONFIGURE_SCHEDULER_PRIORITY_SMP}.
+
+The cluster of each processor is defined by
+@code{CONFIGURE_SMP_SCHEDULER_CLUSTER_OF_PROCESSOR}.
+
+@c
+@c === CONFIGURE_SMP_SCHEDULER_CLUSTER_OF_PROCESSOR ===
+@c
+@subsection Specify Processor Cluster of Each Processor
+
+@findex CONFIGURE_SMP_SCHEDULER_CLUSTER_OF_PROCESSOR
+
+@table @b
+@item CONSTANT:
+@code{CONFIGURE_SMP_SCHEDULER_CLUSTER_OF_PROCESSOR}
+
+@item DATA TYPE:
+Initializer for an array of unsigned integers (@code{uint32_t}).
+
+@item RANGE:
+Each entry is less than @code{CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT}.
+
+@item DEFAULT VALUE:
+The default value is @code{@{ 0 @}}, all processors belong to cluster 0.
+
+@end table
+
+@subheading DESCRIPTION:
+@code{CONFIGURE_SMP_SCHEDULER_CLUSTER_OF_PROCESSOR} is the initializer of
+a table with the processor cluster index of each processor.  The table
+has @code{CONFIGURE_SMP_MAXIMUM_PROCESSORS} entries.  For example the
+following configuration assigns the first two processors to cluster 0 and
+the other two processors to cluster 1.
+
+@example
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS 4
+#define CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT 2
+#define CONFIGURE_SMP_SCHEDULER_CLUSTER_OF_PROCESSOR @{ 0, 0, 1, 1 @}
+@end example
+
+@subheading NOTES:
+The Deterministic Priority SMP Scheduler terminates the system during
+initialization with the @code{INTERNAL_ERROR_SCHEDULER_INVALID_CLUSTER}
+fatal error if an index is greater than or equal to the count of processor
+clusters.
+
+Entries not specified by the initializer are zero.
+
 @c
 @c === Device Driver Table ===
 @c
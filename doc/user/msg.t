@@ -24,6 +24,10 @@ directives provided by the message manager are:
 @item @code{@value{DIRPREFIX}message_queue_receive} - Receive message from a queue
 @item @code{@value{DIRPREFIX}message_queue_get_number_pending} - Get number of messages pending on a queue
 @item @code{@value{DIRPREFIX}message_queue_flush} - Flush all messages on a queue
+@item @code{@value{DIRPREFIX}message_queue_get_buffer} - Get a message buffer of a queue
+@item @code{@value{DIRPREFIX}message_queue_send_buffer} - Put message buffer at rear of a queue
+@item @code{@value{DIRPREFIX}message_queue_receive_buffer} - Receive message buffer from a queue
+@item @code{@value{DIRPREFIX}message_queue_release_buffer} - Release a message buffer to a queue
 @end itemize
 
 @section Background
@@ -193,6 +197,23 @@ an atomic operation.  The message is copied to each waiting
 task's message buffer and each task is unblocked.  The number of
 tasks which were unblocked is returned to the caller.
 
+@subsection Zero-Copy Message Passing
+
+The send and receive directives copy the message twice, once into a
+message buffer of the queue and once out of it.  For large messages
+the copies may dominate the cost of the message transfer.  A task may
+instead take the ownership of a message buffer of the queue with the
+@code{@value{DIRPREFIX}message_queue_get_buffer} directive, fill in the
+message in place and hand the message buffer over to the queue with the
+@code{@value{DIRPREFIX}message_queue_send_buffer} directive.  The
+@code{@value{DIRPREFIX}message_queue_receive_buffer} directive returns the
+message buffer containing the message to the receiving task, which owns
+it until it is handed back with the
+@code{@value{DIRPREFIX}message_queue_release_buffer} or
+@code{@value{DIRPREFIX}message_queue_send_buffer} directive.  Both modes
+may be mixed on the same queue.  A message buffer owned by a task is not
+available for other messages, so it should be handed back promptly.
+
 @subsection Deleting a Message Queue
 
 The @code{@value{DIRPREFIX}message_queue_delete} directive removes a message
@@ -831,3 +852,205 @@ Flushing all messages on a global message queue which
 does not reside on the local node will generate a request to the
 remote node to actually flush the specified message queue.
 
+@c
+@c
+@c
+@page
+@subsection MESSAGE_QUEUE_GET_BUFFER - Get a message buffer of a queue
+
+@cindex get message buffer of a queue
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_message_queue_get_buffer
+@example
+rtems_status_code rtems_message_queue_get_buffer(
+  rtems_id   id,
+  void     **buffer
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - message buffer obtained successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer} is NULL@*
+@code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
+@code{@value{RPREFIX}TOO_MANY} - no free message buffer available@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported for remote queues
+
+@subheading DESCRIPTION:
+
+This directive obtains a free message buffer of the specified
+queue and returns its address in buffer.  The calling task owns
+the message buffer and may fill in a message of up to the maximum
+message size of the queue.
+
+@subheading NOTES:
+
+The message buffer must be handed back to the same queue with the
+@code{@value{DIRPREFIX}message_queue_send_buffer} or
+@code{@value{DIRPREFIX}message_queue_release_buffer} directive.
+
+This directive will not cause the calling task to be preempted.
+
+@c
+@c
+@c
+@page
+@subsection MESSAGE_QUEUE_SEND_BUFFER - Put message buffer at rear of a queue
+
+@cindex send message buffer to a queue
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_message_queue_send_buffer
+@example
+rtems_status_code rtems_message_queue_send_buffer(
+  rtems_id  id,
+  void     *buffer,
+  size_t    size
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - message sent successfully@*
+@code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
+@code{@value{RPREFIX}INVALID_SIZE} - invalid message size@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer} is not a message buffer of the queue owned by the application@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported for remote queues
+
+@subheading DESCRIPTION:
+
+This directive sends the message contained in the message buffer
+to the specified queue without a copy of the message.  On success
+the ownership of the message buffer passes to the queue.  A task
+waiting with the @code{@value{DIRPREFIX}message_queue_receive_buffer}
+directive receives the message buffer itself, a task waiting with the
+@code{@value{DIRPREFIX}message_queue_receive} directive receives a copy
+of the message.  Otherwise the message buffer is placed at the rear of
+the queue.
+
+@subheading NOTES:
+
+The calling task will be preempted if it has preemption enabled
+and a higher priority task is unblocked as the result of this
+directive.
+
+@c
+@c
+@c
+@page
+@subsection MESSAGE_QUEUE_RECEIVE_BUFFER - Receive message buffer from a queue
+
+@cindex receive message buffer from a queue
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_message_queue_receive_buffer
+@example
+rtems_status_code rtems_message_queue_receive_buffer(
+  rtems_id         id,
+  void           **buffer,
+  size_t          *size,
+  rtems_option     option_set,
+  rtems_interval   timeout
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - message received successfully@*
+@code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer} is NULL@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{size} is NULL@*
+@code{@value{RPREFIX}UNSATISFIED} - queue is empty@*
+@code{@value{RPREFIX}TIMEOUT} - timed out waiting for message@*
+@code{@value{RPREFIX}OBJECT_WAS_DELETED} - queue deleted while waiting@*
+@code{@value{RPREFIX}TOO_MANY} - no free message buffer for a copied message@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported for remote queues
+
+@subheading DESCRIPTION:
+
+This directive receives a message from the specified queue
+like the @code{@value{DIRPREFIX}message_queue_receive} directive,
+however, instead of a copy of the message the message buffer itself
+is returned in buffer and the size of the message in size.  The
+calling task owns the message buffer until it is handed back with the
+@code{@value{DIRPREFIX}message_queue_release_buffer} or
+@code{@value{DIRPREFIX}message_queue_send_buffer} directive.
+
+@subheading NOTES:
+
+A task waiting with this directive for a message sent by the
+@code{@value{DIRPREFIX}message_queue_send},
+@code{@value{DIRPREFIX}message_queue_urgent} or
+@code{@value{DIRPREFIX}message_queue_broadcast} directive needs a free
+message buffer.  The receive fails with
+@code{@value{RPREFIX}TOO_MANY} in case all message buffers are owned by
+tasks.
+
+@c
+@c
+@c
+@page
+@subsection MESSAGE_QUEUE_RELEASE_BUFFER - Release a message buffer to a queue
+
+@cindex release message buffer to a queue
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_message_queue_release_buffer
+@example
+rtems_status_code rtems_message_queue_release_buffer(
+  rtems_id  id,
+  void     *buffer
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - message buffer released successfully@*
+@code{@value{RPREFIX}INVALID_ID} - invalid queue id@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{buffer} is not a message buffer of the queue owned by the application@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - not supported for remote queues
+
+@subheading DESCRIPTION:
+
+This directive hands back a message buffer owned by the calling
+task to the specified queue.
+
+@subheading NOTES:
+
+A message buffer which was already released or sent is rejected with
+@code{@value{RPREFIX}INVALID_ADDRESS}.  The message queue does not
+track which task owns a message buffer, so any task may hand back a
+message buffer owned by the application.
@@ -67,6 +67,8 @@ attributes is provided in the following table:
 @itemize @bullet
 @item @code{@value{RPREFIX}FIFO} - tasks wait by FIFO (default)
 @item @code{@value{RPREFIX}PRIORITY} - tasks wait by priority
+@item @code{@value{RPREFIX}FIRST_FIT} - first fit allocation (default)
+@item @code{@value{RPREFIX}SEGREGATED_FIT} - segregated fit allocation
 @end itemize
 
 Attribute values are specifically designed to be
@@ -297,6 +299,17 @@ Specifying @code{@value{RPREFIX}FIFO} in attribute_set or selecting
 @code{@value{RPREFIX}DEFAULT_ATTRIBUTES} will cause waiting tasks to
 be serviced in First In-First Out order.
 
+Specifying @code{@value{RPREFIX}SEGREGATED_FIT} in attribute_set causes
+the region to keep its free blocks on segregated free lists indexed by
+size.  The time to get a segment is then independent of the
+fragmentation of the region for most requests.  A request which can be
+satisfied only by a block of its own size class falls back to a linear
+search of the free blocks.  The free lists are allocated from the
+region itself and need about two kilobytes on 32-bit targets.
+Specifying @code{@value{RPREFIX}FIRST_FIT} or selecting
+@code{@value{RPREFIX}DEFAULT_ATTRIBUTES} will cause the region to search
+a single free list for the first block large enough.
+
 The @code{starting_address} parameter must be aligned on a
 four byte boundary.  The @code{page_size} parameter must be a multiple
 of four greater than or equal to eight.
@@ -312,6 +325,8 @@ by RTEMS:
 @itemize @bullet
 @item @code{@value{RPREFIX}FIFO} - tasks wait by FIFO (default)
 @item @code{@value{RPREFIX}PRIORITY} - tasks wait by priority
+@item @code{@value{RPREFIX}FIRST_FIT} - first fit allocation (default)
+@item @code{@value{RPREFIX}SEGREGATED_FIT} - segregated fit allocation
 @end itemize
 
 @c
@@ -32,6 +32,9 @@ provided by the rate monotonic manager are:
 @item @code{@value{DIRPREFIX}rate_monotonic_get_statistics} - Obtain statistics from a period
 @item @code{@value{DIRPREFIX}rate_monotonic_reset_statistics} - Reset statistics for a period
 @item @code{@value{DIRPREFIX}rate_monotonic_reset_all_statistics} - Reset statistics for all periods
+@item @code{@value{DIRPREFIX}rate_monotonic_set_histograms} - Enable latency histograms of a period
+@item @code{@value{DIRPREFIX}rate_monotonic_get_histograms} - Obtain latency histograms from a period
+@item @code{@value{DIRPREFIX}rate_monotonic_histogram_percentile} - Obtain a percentile of a latency histogram
 @item @code{@value{DIRPREFIX}rate_monotonic_report_statistics} - Print period statistics report 
 @end itemize
 
@@ -122,6 +125,41 @@ of the CPU).  As a general rule of thumb, the higher frequency at
 which a task executes, the more important it is to optimize that
 task.
 
+@subsection Period Latency Histograms
+
+@cindex period latency histograms
+@cindex deadline miss ring
+
+The minimum, maximum and average times do not show how often a
+period comes close to its deadline.  Optionally, each period keeps
+log-scale latency histograms and a ring of the most recent deadline
+misses.  The storage of the histograms is provided by the application
+with the @code{@value{DIRPREFIX}rate_monotonic_set_histograms}
+directive.  The following histograms are kept:
+
+@itemize @bullet
+@item @code{release_jitter}
+is the delay from the release of a period until its owner executes
+again.
+
+@item @code{execution_time}
+is the CPU time used in a period.
+
+@item @code{response_time}
+is the wall time from the release of a period until its owner
+invokes @code{@value{DIRPREFIX}rate_monotonic_period} again.
+
+@end itemize
+
+The values are in nanoseconds, or in clock ticks if the statistics
+use ticks.  The bucket @i{i} counts the values from 2^@i{i} up to
+2^(@i{i}+1) - 1, so the upper bound of a percentile is known within
+a factor of two.  The deadline miss ring contains the uptime of the
+most recent
+@code{@value{RPREFIX}RATE_MONOTONIC_MISS_RING_SIZE} deadline misses.
+The statistics report prints the percentiles P50, P90, P99 and P99.9
+of each histogram and the recorded deadline misses.
+
 @subsection Rate Monotonic Manager Definitions
 
 @cindex periodic task, definition
@@ -1376,6 +1414,8 @@ procedure Rate_Monotonic_Reset_Statistics (
 
 This directive resets the statistics information associated with 
 this rate monotonic period instance.
+The latency histograms and the deadline miss ring of the period
+are cleared as well.
 
 @subheading NOTES:
 
@@ -1417,6 +1457,138 @@ all rate monotonic period instances.
 
 This directive will not cause the running task to be preempted.
 
+@c
+@c
+@c
+@page
+@subsection RATE_MONOTONIC_SET_HISTOGRAMS - Enable latency histograms of a period
+
+@cindex enable latency histograms of period
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_rate_monotonic_set_histograms
+@example
+rtems_status_code rtems_rate_monotonic_set_histograms(
+  rtems_id                         id,
+  rtems_rate_monotonic_histograms *histograms
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - histograms set successfully@*
+@code{@value{RPREFIX}INVALID_ID} - invalid rate monotonic period id
+
+@subheading DESCRIPTION:
+
+This directive enables the latency histograms and the deadline miss
+ring of the rate monotonic period specified by id.  The histograms
+are stored in the area specified by histograms, which is cleared.
+If histograms is NULL, then the histograms of the period are
+disabled.
+
+@subheading NOTES:
+
+The area must remain valid until the histograms are disabled or
+the period is deleted.
+
+This directive will not cause the running task to be preempted.
+
+@c
+@c
+@c
+@page
+@subsection RATE_MONOTONIC_GET_HISTOGRAMS - Obtain latency histograms from a period
+
+@cindex get latency histograms of period
+@cindex obtain latency histograms of period
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_rate_monotonic_get_histograms
+@example
+rtems_status_code rtems_rate_monotonic_get_histograms(
+  rtems_id                         id,
+  rtems_rate_monotonic_histograms *histograms
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - histograms returned successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - invalid address of histograms@*
+@code{@value{RPREFIX}INVALID_ID} - invalid rate monotonic period id@*
+@code{@value{RPREFIX}NOT_DEFINED} - histograms of period not enabled
+
+@subheading DESCRIPTION:
+
+This directive returns a consistent copy of the latency histograms
+and the deadline miss ring of the rate monotonic period specified
+by id.  The most recent deadline miss is at the index
+(@code{miss_count} - 1) modulo
+@code{@value{RPREFIX}RATE_MONOTONIC_MISS_RING_SIZE}.
+
+@subheading NOTES:
+
+This directive will not cause the running task to be preempted.
+
+@c
+@c
+@c
+@page
+@subsection RATE_MONOTONIC_HISTOGRAM_PERCENTILE - Obtain a percentile of a latency histogram
+
+@cindex percentile of latency histogram
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_rate_monotonic_histogram_percentile
+@example
+uint64_t rtems_rate_monotonic_histogram_percentile(
+  const rtems_rate_monotonic_histogram *histogram,
+  uint32_t                              per_mille
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+
+NONE
+
+@subheading DESCRIPTION:
+
+This directive returns an upper bound of the percentile specified
+by per_mille in tenths of a percent of the values of the latency
+histogram.  For example, a per_mille of 999 selects the 99.9th
+percentile.  Zero is returned for an empty histogram.  If the
+percentile is in the last bucket, then UINT64_MAX is returned.
+
+@subheading NOTES:
+
+This directive will not cause the running task to be preempted.
+
 @c
 @c
 @c
@@ -1464,6 +1636,10 @@ output generated by this directive.
 @end example
 @end ifset
 
+If the latency histograms of a period are enabled, then the
+percentiles of the histograms and the recorded deadline misses
+are printed below the line of the period.
+
 @subheading NOTES:
 
 This directive will not cause the running task to be preempted.
@@ -0,0 +1,356 @@
+@c
+@c  COPYRIGHT (c) 2013.
+@c  On-Line Applications Research Corporation (OAR).
+@c  All rights reserved.
+
+@chapter Symmetric Multiprocessing Services
+
+@cindex symmetric multiprocessing
+@cindex SMP
+
+@section Introduction
+
+The Symmetric Multiprocessing (SMP) services provide directives to
+control on which processors a task may execute in an SMP configuration.
+The directives provided by the SMP services are:
+
+@itemize @bullet
+@item @code{@value{DIRPREFIX}task_get_scheduler_cluster} - Get processor cluster of a task
+@item @code{@value{DIRPREFIX}task_set_scheduler_cluster} - Set processor cluster of a task
+@item @code{@value{DIRPREFIX}task_get_affinity} - Get processor affinity of a task
+@item @code{@value{DIRPREFIX}task_set_affinity} - Set processor affinity of a task
+@item @code{pthread_getaffinity_np} - Get processor affinity of a thread
+@item @code{pthread_setaffinity_np} - Set processor affinity of a thread
+@end itemize
+
+The processor affinity directives are only available if the C library
+provides @code{<sys/cpuset.h>}.
+
+@section Background
+
+@subsection Processor Clusters
+
+@cindex processor cluster
+
+The Deterministic Priority SMP Scheduler may partition the processors
+into clusters.  Each cluster is an instance of the scheduler with its own
+set of ready tasks, so the scheduling decisions of one cluster do not
+touch the data structures of another cluster.  A task belongs to exactly
+one cluster and executes only on the processors of this cluster.  The
+clusters may be used to separate tasks with tight latency requirements
+from tasks which perform bulk work.
+
+The application defines the count of clusters with
+@code{CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT} and the cluster of each
+processor with @code{CONFIGURE_SMP_SCHEDULER_CLUSTER_OF_PROCESSOR}, see
+the chapter Configuring a System.  By default there is one cluster which
+contains all processors.  The clusters are identified by their index
+starting with zero.
+
+A new task belongs to the cluster of the creating task.  The cluster of
+the initialization tasks is zero.
+
+@subsection Processor Affinity
+
+@cindex processor affinity
+@cindex cpu_set_t
+
+The processor affinity of a task is the set of processors on which the
+task may execute.  A task which stays on one processor keeps the contents
+of the processor caches.  The processor sets use the @code{cpu_set_t}
+type and the @code{CPU_*} macros of @code{<sys/cpuset.h>}.  The size of a
+processor set in bytes must be passed to the directives together with the
+set.
+
+Only the Deterministic Priority Affinity SMP Scheduler supports processor
+sets which do not contain all online processors, see
+@code{CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP} in the chapter
+Configuring a System.  The other schedulers let every task execute on all
+online processors.  The affinity of a new task contains all processors.
+
+@section Operations
+
+@subsection Moving a Task to Another Cluster
+
+The @code{@value{DIRPREFIX}task_set_scheduler_cluster} directive moves a
+task to another cluster.  A task which executes on a processor or which
+is scheduled to execute on a processor cannot be moved, so the calling
+task cannot move itself.  It is advisable to move a new task to its
+cluster before it is started.  A ready task of high priority owns a
+processor most of the time, so suspend it before it is moved.  The
+@code{@value{DIRPREFIX}task_get_scheduler_cluster} directive returns the
+cluster of a task.
+
+@subsection Changing the Processor Affinity of a Task
+
+The @code{@value{DIRPREFIX}task_set_affinity} directive sets the processor
+affinity of a task.  Processors which are not online are ignored, but the
+set must contain at least one online processor.  A task which executes
+on a processor outside of its new affinity set gives up this processor
+immediately and moves to an allowed processor at the latest with the next
+clock tick.  The
+@code{@value{DIRPREFIX}task_get_affinity} directive returns the processor
+affinity of a task.  The @code{pthread_setaffinity_np} and
+@code{pthread_getaffinity_np} functions provide the same services for
+POSIX threads.
+
+@section Directives
+
+This section details the symmetric multiprocessing services.  A subsection
+is dedicated to each of these services and describes the calling sequence,
+related constants, usage, and status codes.
+
+@c
+@c rtems_task_get_scheduler_cluster
+@c
+@page
+@subsection TASK_GET_SCHEDULER_CLUSTER - Get processor cluster of a task
+
+@cindex get processor cluster of a task
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_task_get_scheduler_cluster
+@example
+rtems_status_code rtems_task_get_scheduler_cluster(
+  rtems_id  id,
+  uint32_t *cluster
+);
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - processor cluster returned successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{cluster} is NULL@*
+@code{@value{RPREFIX}INVALID_ID} - invalid task id@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - cannot get processor cluster of remote tasks
+
+@subheading DESCRIPTION:
+This directive returns the index of the processor cluster of the task
+specified by @code{id} in @code{cluster}.  The task executes only on
+processors of this cluster.  A task can obtain its own cluster by
+specifying @code{@value{RPREFIX}SELF} for @code{id}.
+
+@subheading NOTES:
+In uniprocessor configurations the processor cluster is always zero.
+
+@c
+@c rtems_task_set_scheduler_cluster
+@c
+@page
+@subsection TASK_SET_SCHEDULER_CLUSTER - Set processor cluster of a task
+
+@cindex set processor cluster of a task
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_task_set_scheduler_cluster
+@example
+rtems_status_code rtems_task_set_scheduler_cluster(
+  rtems_id id,
+  uint32_t cluster
+);
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - processor cluster set successfully@*
+@code{@value{RPREFIX}INVALID_NUMBER} - invalid processor cluster index@*
+@code{@value{RPREFIX}INVALID_ID} - invalid task id@*
+@code{@value{RPREFIX}RESOURCE_IN_USE} - task executes or is scheduled on a processor@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - cannot set processor cluster of remote tasks
+
+@subheading DESCRIPTION:
+This directive moves the task specified by @code{id} to the processor
+cluster with the index @code{cluster}.  The task executes afterwards only
+on processors of this cluster.  The index must be less than the
+configured count of processor clusters.
+
+@subheading NOTES:
+A task which executes currently on a processor or which is scheduled to
+execute on a processor cannot be moved to another cluster.  This includes
+the calling task.  A task which is blocked, suspended, dormant or ready
+but waiting for a processor can be moved.
+
+In uniprocessor configurations only the processor cluster zero is valid.
+
+@c
+@c rtems_task_get_affinity
+@c
+@page
+@subsection TASK_GET_AFFINITY - Get processor affinity of a task
+
+@cindex get processor affinity of a task
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_task_get_affinity
+@example
+rtems_status_code rtems_task_get_affinity(
+  rtems_id   id,
+  size_t     cpusetsize,
+  cpu_set_t *cpuset
+);
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - processor affinity returned successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{cpuset} is NULL@*
+@code{@value{RPREFIX}INVALID_NUMBER} - processor set too small for all online processors@*
+@code{@value{RPREFIX}INVALID_ID} - invalid task id@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - cannot get processor affinity of remote tasks
+
+@subheading DESCRIPTION:
+This directive returns the processor affinity of the task specified by
+@code{id} in the processor set @code{cpuset} of @code{cpusetsize} bytes.
+The set contains only online processors.  A task can obtain its own
+processor affinity by specifying @code{@value{RPREFIX}SELF} for
+@code{id}.
+
+@subheading NOTES:
+In uniprocessor configurations the processor affinity contains only
+processor zero.
+
+@c
+@c rtems_task_set_affinity
+@c
+@page
+@subsection TASK_SET_AFFINITY - Set processor affinity of a task
+
+@cindex set processor affinity of a task
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_task_set_affinity
+@example
+rtems_status_code rtems_task_set_affinity(
+  rtems_id         id,
+  size_t           cpusetsize,
+  const cpu_set_t *cpuset
+);
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - processor affinity set successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{cpuset} is NULL@*
+@code{@value{RPREFIX}INVALID_NUMBER} - processor set not acceptable for the scheduler@*
+@code{@value{RPREFIX}INVALID_ID} - invalid task id@*
+@code{@value{RPREFIX}ILLEGAL_ON_REMOTE_OBJECT} - cannot set processor affinity of remote tasks
+
+@subheading DESCRIPTION:
+This directive sets the processor affinity of the task specified by
+@code{id} to the processor set @code{cpuset} of @code{cpusetsize} bytes.
+The task executes afterwards only on processors of this set.  Processors
+which are not online are ignored.
+
+@subheading NOTES:
+The Deterministic Priority Affinity SMP Scheduler rejects a processor set
+without an online processor.  It does not allow to change the processor
+affinity of the idle threads.  All other schedulers accept only a
+processor set which contains all online processors.
+
+A task which executes on a processor outside of its new processor
+affinity gives up this processor immediately.  Its context may not be
+saved yet, so it moves to an allowed processor at the latest with the next
+clock tick.
+
+@c
+@c pthread_getaffinity_np
+@c
+@page
+@subsection pthread_getaffinity_np - Get Thread Processor Affinity
+
+@findex pthread_getaffinity_np
+@cindex get processor affinity of a thread
+
+@subheading CALLING SEQUENCE:
+
+@example
+#include <pthread.h>
+
+int pthread_getaffinity_np(
+  pthread_t  id,
+  size_t     cpusetsize,
+  cpu_set_t *cpuset
+);
+@end example
+
+@subheading STATUS CODES:
+
+@table @b
+@item EFAULT
+The @code{cpuset} pointer is NULL.
+
+@item EINVAL
+The processor set is too small for all online processors.
+
+@item ESRCH
+The thread indicated was invalid.
+
+@end table
+
+@subheading DESCRIPTION:
+
+The @code{pthread_getaffinity_np} routine returns the processor affinity
+of the thread specified by @code{id} in the processor set @code{cpuset}
+of @code{cpusetsize} bytes.
+
+@subheading NOTES:
+
+This routine is not portable.  It is the POSIX counterpart of
+@code{@value{DIRPREFIX}task_get_affinity} and is only available if the C
+library provides @code{<sys/cpuset.h>} and declares this routine.
+
+@c
+@c pthread_setaffinity_np
+@c
+@page
+@subsection pthread_setaffinity_np - Set Thread Processor Affinity
+
+@findex pthread_setaffinity_np
+@cindex set processor affinity of a thread
+
+@subheading CALLING SEQUENCE:
+
+@example
+#include <pthread.h>
+
+int pthread_setaffinity_np(
+  pthread_t        id,
+  size_t           cpusetsize,
+  const cpu_set_t *cpuset
+);
+@end example
+
+@subheading STATUS CODES:
+
+@table @b
+@item EFAULT
+The @code{cpuset} pointer is NULL.
+
+@item EINVAL
+The processor set is not acceptable for the scheduler.
+
+@item ESRCH
+The thread indicated was invalid.
+
+@end table
+
+@subheading DESCRIPTION:
+
+The @code{pthread_setaffinity_np} routine sets the processor affinity of
+the thread specified by @code{id} to the processor set @code{cpuset} of
+@code{cpusetsize} bytes.
+
+@subheading NOTES:
+
+This routine is not portable.  It is the POSIX counterpart of
+@code{@value{DIRPREFIX}task_set_affinity} and is only available if the C
+library provides @code{<sys/cpuset.h>} and declares this routine.  The
+notes of @code{@value{DIRPREFIX}task_set_affinity} apply.
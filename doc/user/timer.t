@@ -23,6 +23,9 @@ facilities.  The directives provided by the timer manager are:
 @item @code{@value{DIRPREFIX}timer_server_fire_after} - Fire task-based timer after interval
 @item @code{@value{DIRPREFIX}timer_server_fire_when} - Fire task-based timer when specified
 @item @code{@value{DIRPREFIX}timer_reset} - Reset an interval timer
+@item @code{@value{DIRPREFIX}timer_create_server} - Create an additional timer server
+@item @code{@value{DIRPREFIX}timer_server_fire_after_on} - Fire task-based timer on a timer server after interval
+@item @code{@value{DIRPREFIX}timer_server_fire_when_on} - Fire task-based timer on a timer server when specified
 @end itemize
 
 
@@ -185,6 +188,22 @@ any application task and thus the user can expect to be preempted
 as the result of executing the @code{@value{DIRPREFIX}timer_initiate_server}
 directive.
 
+@subsection Using Several Timer Servers
+
+The Timer Server executes one timer service routine after the other.
+A long-running timer service routine therefore delays all other
+task-based timers.  The @code{@value{DIRPREFIX}timer_create_server}
+directive creates an additional timer server with its own name,
+priority, stack size, attributes and, on SMP configurations, processor.
+Timers are scheduled on a specific timer server with the
+@code{@value{DIRPREFIX}timer_server_fire_after_on} and
+@code{@value{DIRPREFIX}timer_server_fire_when_on} directives.  In
+contrast to the Timer Server, the additional timer servers are
+preemptible.  For example, an application may execute short,
+latency-critical control timers on a high priority timer server and
+housekeeping timers on a low priority timer server.  A reset timer stays
+on the timer server which executed it before.
+
 @subsection Deleting a Timer
 
 The @code{@value{DIRPREFIX}timer_delete} directive is used to delete a timer.
@@ -729,3 +748,160 @@ reinitiated with its previous timer service routine and interval.
 
 This directive will not cause the running task to be preempted.
 
+@c
+@c
+@c
+@page
+@subsection TIMER_CREATE_SERVER - Create an additional timer server
+
+@cindex create a timer server
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_timer_create_server
+@example
+rtems_status_code rtems_timer_create_server(
+  rtems_name       name,
+  uint32_t         priority,
+  uint32_t         stack_size,
+  rtems_attribute  attribute_set,
+  uint32_t         processor,
+  rtems_id        *server_id
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - timer server created successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{server_id} is NULL@*
+@code{@value{RPREFIX}INVALID_PRIORITY} - invalid timer server priority@*
+@code{@value{RPREFIX}INVALID_NUMBER} - invalid processor or processor binding not supported@*
+@code{@value{RPREFIX}NO_MEMORY} - not enough workspace for the timer server@*
+@code{@value{RPREFIX}TOO_MANY} - too many tasks created
+
+@subheading DESCRIPTION:
+
+This directive creates and starts a timer server task with the
+specified name, priority, stack size and attributes.  The priority
+@code{@value{RPREFIX}TIMER_SERVER_DEFAULT_PRIORITY} selects a priority
+higher than any application task.  If processor is not
+@code{@value{RPREFIX}TIMER_SERVER_ANY_PROCESSOR}, then the timer server
+executes only on this processor.  The identifier of the timer server
+task is returned in server_id.  It identifies the timer server in the
+@code{@value{DIRPREFIX}timer_server_fire_after_on} and
+@code{@value{DIRPREFIX}timer_server_fire_when_on} directives.
+
+@subheading NOTES:
+
+This directive could cause the calling task to be preempted.
+
+The timer server task must be accounted for when configuring the
+system.  The timer server control block is allocated from the RTEMS
+Workspace.  Timer servers cannot be deleted.
+
+The processor binding on SMP configurations needs a scheduler with
+processor affinity support, for example the Deterministic Priority
+Affinity SMP Scheduler.
+
+@c
+@c
+@c
+@page
+@subsection TIMER_SERVER_FIRE_AFTER_ON - Fire task-based timer on a timer server after interval
+
+@cindex fire a task-based timer on a timer server after an interval
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_timer_server_fire_after_on
+@example
+rtems_status_code rtems_timer_server_fire_after_on(
+  rtems_id                           server_id,
+  rtems_id                           id,
+  rtems_interval                     ticks,
+  rtems_timer_service_routine_entry  routine,
+  void                              *user_data
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - timer initiated successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{routine} is NULL@*
+@code{@value{RPREFIX}INVALID_ID} - invalid timer id@*
+@code{@value{RPREFIX}INVALID_NUMBER} - invalid interval@*
+@code{@value{RPREFIX}INCORRECT_STATE} - invalid timer server id
+
+@subheading DESCRIPTION:
+
+This directive works like
+@code{@value{DIRPREFIX}timer_server_fire_after}, but the timer is
+executed by the timer server specified by server_id.  The identifier
+of the Timer Server is the identifier of its task.
+
+@subheading NOTES:
+
+This directive will not cause the running task to be
+preempted.
+
+@c
+@c
+@c
+@page
+@subsection TIMER_SERVER_FIRE_WHEN_ON - Fire task-based timer on a timer server when specified
+
+@cindex fire a task-based timer on a timer server at wall time
+
+@subheading CALLING SEQUENCE:
+
+@ifset is-C
+@findex rtems_timer_server_fire_when_on
+@example
+rtems_status_code rtems_timer_server_fire_when_on(
+  rtems_id                           server_id,
+  rtems_id                           id,
+  rtems_time_of_day                 *wall_time,
+  rtems_timer_service_routine_entry  routine,
+  void                              *user_data
+);
+@end example
+@end ifset
+
+@ifset is-Ada
+@example
+NOT SUPPORTED FROM Ada BINDING
+@end example
+@end ifset
+
+@subheading DIRECTIVE STATUS CODES:
+@code{@value{RPREFIX}SUCCESSFUL} - timer initiated successfully@*
+@code{@value{RPREFIX}INVALID_ADDRESS} - @code{routine} is NULL@*
+@code{@value{RPREFIX}INVALID_ID} - invalid timer id@*
+@code{@value{RPREFIX}NOT_DEFINED} - system date and time is not set@*
+@code{@value{RPREFIX}INVALID_CLOCK} - invalid time of day@*
+@code{@value{RPREFIX}INCORRECT_STATE} - invalid timer server id
+
+@subheading DESCRIPTION:
+
+This directive works like
+@code{@value{DIRPREFIX}timer_server_fire_when}, but the timer is
+executed by the timer server specified by server_id.
+
+@subheading NOTES:
+
+This directive will not cause the running task to be
+preempted.
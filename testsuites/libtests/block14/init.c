@@ -54,6 +54,7 @@ static const test_action actions [ACTION_COUNT] = {
     .read_hits = a, \
     .read_misses = b, \
     .read_ahead_transfers = c, \
+    .read_ahead_window = 1, \
     .read_blocks = d, \
     .read_errors = e, \
     .write_transfers = f, \
@@ -117,12 +118,12 @@ static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
 static void test_actions(rtems_disk_device *dd)
 {
   int i;
+  rtems_blkdev_stats stats;
 
   for (i = 0; i < ACTION_COUNT; ++i) {
     const test_action *action = &actions [i];
     rtems_status_code sc;
     rtems_bdbuf_buffer *bd;
-    rtems_blkdev_stats stats;
 
     printf("action %i\n", i);
 
@@ -153,7 +154,7 @@ static void test_actions(rtems_disk_device *dd)
     );
   }
 
-  rtems_blkdev_print_stats(&dd->stats, rtems_printf_plugin, NULL);
+  rtems_blkdev_print_stats(&stats, rtems_printf_plugin, NULL);
 }
 
 static void test(void)
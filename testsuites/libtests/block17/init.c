@@ -0,0 +1,171 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <string.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/bdbuf.h>
+
+#define BLOCK_COUNT 64
+
+#define MAX_READ_AHEAD_BLOCKS 8
+
+#define TRANSFER_COUNT 11
+
+/*
+ * The first two reads miss and start a sequential access stream.  The
+ * read-ahead window starts with two blocks and doubles up to the maximum
+ * read-ahead blocks.
+ */
+static const uint32_t expected_transfer_sizes [TRANSFER_COUNT] = {
+  1, 1, 2, 4, 8, 8, 8, 8, 8, 8, 8
+};
+
+static uint32_t transfer_sizes [TRANSFER_COUNT];
+
+static size_t transfer_index;
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    rtems_blkdev_sg_buffer *sg = breq->bufs;
+    uint32_t i;
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_READ);
+    rtems_test_assert(transfer_index < TRANSFER_COUNT);
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_test_assert(sg [i].block < BLOCK_COUNT);
+
+      if (i > 0) {
+        rtems_test_assert(sg [i].block == sg [i - 1].block + 1);
+      }
+    }
+
+    transfer_sizes [transfer_index] = breq->bufnum;
+    ++transfer_index;
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    errno = EINVAL;
+    rv = -1;
+  }
+
+  return rv;
+}
+
+static void test_sequential_read(rtems_disk_device *dd)
+{
+  rtems_status_code sc;
+  rtems_blkdev_bnum block;
+  rtems_blkdev_stats stats;
+
+  for (block = 0; block < BLOCK_COUNT; ++block) {
+    rtems_bdbuf_buffer *bd;
+
+    sc = rtems_bdbuf_read(dd, block, &bd);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_bdbuf_release(bd);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  rtems_test_assert(transfer_index == TRANSFER_COUNT);
+  rtems_test_assert(
+    memcmp(
+      transfer_sizes,
+      expected_transfer_sizes,
+      sizeof(transfer_sizes)
+    ) == 0
+  );
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_hits == BLOCK_COUNT - 2);
+  rtems_test_assert(stats.read_misses == 2);
+  rtems_test_assert(stats.read_ahead_transfers == TRANSFER_COUNT - 2);
+  rtems_test_assert(stats.read_ahead_window == MAX_READ_AHEAD_BLOCKS);
+  rtems_test_assert(stats.read_blocks == BLOCK_COUNT);
+
+  rtems_blkdev_print_stats(&stats, rtems_printf_plugin, NULL);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  dev_t dev = 0;
+  rtems_disk_device *dd;
+
+  sc = rtems_disk_io_initialize();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_disk_create_phys(
+    dev,
+    1,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  dd = rtems_disk_obtain(dev);
+  rtems_test_assert(dd != NULL);
+
+  test_sequential_read(dd);
+
+  sc = rtems_disk_release(dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_disk_delete(dev);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  puts("\n\n*** TEST BLOCK 17 ***");
+
+  test();
+
+  puts("*** END OF TEST BLOCK 17 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BLOCK_COUNT
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS MAX_READ_AHEAD_BLOCKS
+#define CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY 1
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,194 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+#include <string.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/bdbuf.h>
+
+#define BLOCK_COUNT 16
+
+#define SWAP_PERIOD 10
+
+#define BLOCK_HOLD 100
+
+#define REQUEST_COUNT 2
+
+#define MAX_BUFNUM 4
+
+/*
+ * Block 3 expires first.  The later modified blocks 2, 4 and 5 are next to it
+ * and are coalesced into its write.  The blocks 7 and 9 are written when they
+ * expire.
+ */
+static const rtems_blkdev_bnum modified_blocks [] = { 5, 2, 9, 4, 7 };
+
+static const uint32_t expected_bufnums [REQUEST_COUNT] = { 4, 2 };
+
+static const rtems_blkdev_bnum expected_blocks [REQUEST_COUNT] [MAX_BUFNUM] = {
+  { 2, 3, 4, 5 },
+  { 7, 9 }
+};
+
+static size_t request_index;
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    uint32_t i;
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_WRITE);
+    rtems_test_assert(request_index < REQUEST_COUNT);
+    rtems_test_assert(breq->bufnum == expected_bufnums [request_index]);
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_test_assert(
+        breq->bufs [i].block == expected_blocks [request_index] [i]
+      );
+    }
+
+    ++request_index;
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    errno = EINVAL;
+    rv = -1;
+  }
+
+  return rv;
+}
+
+static void modify(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_get(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release_modified(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void wait(uint32_t msecs)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_wake_after(RTEMS_MILLISECONDS_TO_TICKS(msecs));
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_coalesced_write(rtems_disk_device *dd)
+{
+  rtems_blkdev_stats stats;
+  size_t i;
+
+  modify(dd, 3);
+
+  wait(BLOCK_HOLD / 2);
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(modified_blocks); ++i) {
+    modify(dd, modified_blocks [i]);
+  }
+
+  /*
+   * Block 3 expired, the other blocks not yet.
+   */
+  wait(BLOCK_HOLD / 2 + BLOCK_HOLD / 4);
+  rtems_test_assert(request_index == 1);
+
+  wait(2 * BLOCK_HOLD);
+  rtems_test_assert(request_index == REQUEST_COUNT);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.write_transfers == REQUEST_COUNT);
+  rtems_test_assert(stats.write_blocks == 6);
+  rtems_test_assert(stats.write_full_transfers == 1);
+  rtems_test_assert(stats.write_coalesced_blocks == 3);
+
+  rtems_blkdev_print_stats(&stats, rtems_printf_plugin, NULL);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  dev_t dev = 0;
+  rtems_disk_device *dd;
+
+  sc = rtems_disk_io_initialize();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_disk_create_phys(
+    dev,
+    1,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  dd = rtems_disk_obtain(dev);
+  rtems_test_assert(dd != NULL);
+
+  test_coalesced_write(dd);
+
+  sc = rtems_disk_release(dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_disk_delete(dev);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  puts("\n\n*** TEST BLOCK 18 ***");
+
+  test();
+
+  puts("*** END OF TEST BLOCK 18 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 1000
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BLOCK_COUNT
+#define CONFIGURE_BDBUF_MAX_WRITE_BLOCKS MAX_BUFNUM
+#define CONFIGURE_SWAPOUT_SWAP_PERIOD SWAP_PERIOD
+#define CONFIGURE_SWAPOUT_BLOCK_HOLD BLOCK_HOLD
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
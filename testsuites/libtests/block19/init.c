@@ -0,0 +1,248 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <errno.h>
+
+#include <rtems/blkdev.h>
+#include <rtems/bdbuf.h>
+
+#define BLOCK_COUNT 4
+
+#define SWAP_PERIOD 10
+
+#define BLOCK_HOLD 50
+
+#define REQUEST_COUNT 3
+
+#define SWAPOUT_TASK rtems_build_name('B', 'S', 'W', 'P')
+
+#define WORKER_TASK rtems_build_name('B', 'D', 'o', 'a')
+
+typedef struct {
+  rtems_disk_device *dd;
+  rtems_name writer;
+} test_request;
+
+static rtems_disk_device *dd_a;
+
+static rtems_disk_device *dd_b;
+
+static rtems_id block_sem;
+
+static test_request requests [REQUEST_COUNT];
+
+static size_t request_index;
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    rtems_status_code sc;
+    test_request *r;
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_WRITE);
+    rtems_test_assert(request_index < REQUEST_COUNT);
+
+    r = &requests [request_index];
+    ++request_index;
+
+    r->dd = dd;
+    sc = rtems_object_get_classic_name(rtems_task_self(), &r->writer);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    /*
+     * The first write of device A keeps its writer busy until the test
+     * releases it.
+     */
+    if (request_index == 1) {
+      sc = rtems_semaphore_obtain(block_sem, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    errno = EINVAL;
+    rv = -1;
+  }
+
+  return rv;
+}
+
+static void modify(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_get(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release_modified(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void wait(uint32_t msecs)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_wake_after(RTEMS_MILLISECONDS_TO_TICKS(msecs));
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void wait_for_write(void)
+{
+  wait(BLOCK_HOLD + 3 * SWAP_PERIOD);
+}
+
+static void test_worker_reuse(void)
+{
+  rtems_status_code sc;
+
+  /*
+   * The swapout passes without modified buffers must return the worker to
+   * the free workers.
+   */
+  wait(5 * SWAP_PERIOD);
+
+  modify(dd_a, 0);
+  wait_for_write();
+  rtems_test_assert(request_index == 1);
+  rtems_test_assert(requests [0].dd == dd_a);
+  rtems_test_assert(requests [0].writer == WORKER_TASK);
+
+  /*
+   * The only worker is busy with device A, so the swapout task writes
+   * device B itself.
+   */
+  modify(dd_b, 0);
+  wait_for_write();
+  rtems_test_assert(request_index == 2);
+  rtems_test_assert(requests [1].dd == dd_b);
+  rtems_test_assert(requests [1].writer == SWAPOUT_TASK);
+
+  sc = rtems_semaphore_release(block_sem);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /*
+   * The worker is free again and survives the idle swapout passes.
+   */
+  wait(5 * SWAP_PERIOD);
+
+  modify(dd_b, 1);
+  wait_for_write();
+  rtems_test_assert(request_index == REQUEST_COUNT);
+  rtems_test_assert(requests [2].dd == dd_b);
+  rtems_test_assert(requests [2].writer == WORKER_TASK);
+}
+
+static rtems_disk_device *create_disk(dev_t dev)
+{
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+
+  sc = rtems_disk_create_phys(
+    dev,
+    1,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  dd = rtems_disk_obtain(dev);
+  rtems_test_assert(dd != NULL);
+
+  return dd;
+}
+
+static void delete_disk(rtems_disk_device *dd)
+{
+  rtems_status_code sc;
+  dev_t dev = dd->dev;
+
+  sc = rtems_disk_release(dd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_disk_delete(dev);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('B', 'L', 'C', 'K'),
+    0,
+    RTEMS_COUNTING_SEMAPHORE,
+    0,
+    &block_sem
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_disk_io_initialize();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  dd_a = create_disk(rtems_filesystem_make_dev_t(0, 0));
+  dd_b = create_disk(rtems_filesystem_make_dev_t(0, 1));
+
+  test_worker_reuse();
+
+  delete_disk(dd_a);
+  delete_disk(dd_b);
+
+  sc = rtems_semaphore_delete(block_sem);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  puts("\n\n*** TEST BLOCK 19 ***");
+
+  test();
+
+  puts("*** END OF TEST BLOCK 19 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 1000
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (2 * BLOCK_COUNT)
+#define CONFIGURE_SWAPOUT_SWAP_PERIOD SWAP_PERIOD
+#define CONFIGURE_SWAPOUT_BLOCK_HOLD BLOCK_HOLD
+#define CONFIGURE_SWAPOUT_WORKER_TASKS 1
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
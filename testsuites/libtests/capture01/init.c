@@ -0,0 +1,337 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <string.h>
+
+#include <rtems/capture.h>
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+#define RECORD_COUNT 16
+
+#define RELEASE_COUNT 5
+
+#define TIMESTAMPS_PER_TICK 3
+
+#define TASK_PRIORITY 2
+
+static rtems_interrupt_lock timestamp_lock = RTEMS_INTERRUPT_LOCK_INITIALIZER;
+
+static uint32_t timestamp_counter;
+
+static rtems_id master_id;
+
+static rtems_id partner_id;
+
+static rtems_capture_record_t saved[RECORD_COUNT];
+
+/*
+ * Each record gets a unique time stamp from a counter shared by all
+ * processors.  Several time stamps share a tick to check the tick offset
+ * comparison of the merge.
+ */
+static void timestamp(uint32_t *ticks, uint32_t *tick_offset)
+{
+  rtems_interrupt_level level;
+  uint32_t counter;
+
+  rtems_interrupt_lock_acquire(&timestamp_lock, level);
+  counter = ++timestamp_counter;
+  rtems_interrupt_lock_release(&timestamp_lock, level);
+
+  *ticks = counter / TIMESTAMPS_PER_TICK;
+  *tick_offset = counter % TIMESTAMPS_PER_TICK;
+}
+
+static bool is_before(
+  const rtems_capture_record_t *a,
+  const rtems_capture_record_t *b
+)
+{
+  return a->ticks < b->ticks
+    || (a->ticks == b->ticks && a->tick_offset < b->tick_offset);
+}
+
+static void partner_task(rtems_task_argument arg)
+{
+  while (true) {
+    rtems_status_code sc;
+    rtems_event_set events;
+
+    sc = rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_event_send(master_id, RTEMS_EVENT_0);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+/*
+ * Each round trip switches at least twice, so every round trip produces at
+ * least two records.
+ */
+static void switch_tasks(uint32_t round_trips)
+{
+  rtems_status_code sc;
+  uint32_t i;
+
+  sc = rtems_capture_control(true);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (i = 0; i < round_trips; ++i) {
+    rtems_event_set events;
+
+    sc = rtems_event_send(partner_id, RTEMS_EVENT_0);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_capture_control(false);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static uint32_t read_records(rtems_capture_record_t **recs)
+{
+  rtems_status_code sc;
+  uint32_t read;
+  uint32_t i;
+
+  sc = rtems_capture_read(0, 0, &read, recs);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(read <= RECORD_COUNT);
+
+  for (i = 0; i < read; ++i) {
+    const rtems_capture_record_t *rec = &(*recs)[i];
+
+    rtems_test_assert(rec->cpu < rtems_smp_get_processor_count());
+    rtems_test_assert(
+      (rec->events
+        & (RTEMS_CAPTURE_SWITCHED_IN_EVENT | RTEMS_CAPTURE_SWITCHED_OUT_EVENT))
+          != 0
+    );
+
+    if (i > 0) {
+      rtems_test_assert(is_before(&(*recs)[i - 1], rec));
+    }
+  }
+
+  return read;
+}
+
+static uint32_t get_le32(const uint8_t *p)
+{
+  return (uint32_t) p[0]
+    | ((uint32_t) p[1] << 8)
+    | ((uint32_t) p[2] << 16)
+    | ((uint32_t) p[3] << 24);
+}
+
+static void test_binary_record(const rtems_capture_record_t *rec)
+{
+  uint8_t buffer[RTEMS_CAPTURE_BINARY_RECORD_SIZE + 1];
+  size_t size;
+
+  rtems_test_assert(RTEMS_CAPTURE_BINARY_RECORD_SIZE == 24);
+
+  memset(buffer, 0xa5, sizeof(buffer));
+
+  size = rtems_capture_record_to_binary(rec, buffer);
+  rtems_test_assert(size == RTEMS_CAPTURE_BINARY_RECORD_SIZE);
+
+  rtems_test_assert(get_le32(&buffer[0]) == rec->task->id);
+  rtems_test_assert(get_le32(&buffer[4]) == rec->task->name);
+  rtems_test_assert(get_le32(&buffer[8]) == rec->events);
+  rtems_test_assert(get_le32(&buffer[12]) == rec->ticks);
+  rtems_test_assert(get_le32(&buffer[16]) == rec->tick_offset);
+  rtems_test_assert(get_le32(&buffer[20]) == rec->cpu);
+  rtems_test_assert(buffer[RTEMS_CAPTURE_BINARY_RECORD_SIZE] == 0xa5);
+}
+
+static void test_full_and_partial_release(void)
+{
+  rtems_capture_record_t *recs;
+  rtems_status_code sc;
+  uint32_t read;
+  uint32_t dropped;
+
+  /*
+   * The records exceed the capacity of all processor buffers, so some
+   * records must be dropped.
+   */
+  switch_tasks(rtems_smp_get_processor_count() * RECORD_COUNT);
+
+  dropped = rtems_capture_dropped();
+  rtems_test_assert(dropped > 0);
+
+  read = read_records(&recs);
+  rtems_test_assert(read == RECORD_COUNT);
+
+  test_binary_record(&recs[0]);
+
+  /*
+   * The records which are not released must be moved to the front of the
+   * merge buffer in their order.
+   */
+  memcpy(
+    saved,
+    &recs[RELEASE_COUNT],
+    (read - RELEASE_COUNT) * sizeof(saved[0])
+  );
+
+  sc = rtems_capture_release(RELEASE_COUNT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  read = read_records(&recs);
+  rtems_test_assert(read >= RECORD_COUNT - RELEASE_COUNT);
+  rtems_test_assert(
+    memcmp(
+      recs,
+      saved,
+      (RECORD_COUNT - RELEASE_COUNT) * sizeof(saved[0])
+    ) == 0
+  );
+
+  while (read > 0) {
+    sc = rtems_capture_release(read);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    read = read_records(&recs);
+  }
+
+  sc = rtems_capture_release(0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(rtems_capture_dropped() == dropped);
+}
+
+static void test_flush(void)
+{
+  rtems_capture_record_t *recs;
+  rtems_status_code sc;
+  uint32_t read;
+
+  switch_tasks(1);
+
+  sc = rtems_capture_flush(false);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(rtems_capture_dropped() == 0);
+
+  read = read_records(&recs);
+  rtems_test_assert(read == 0);
+
+  sc = rtems_capture_release(read);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /*
+   * The buffers must be usable after the flush.
+   */
+  switch_tasks(1);
+
+  read = read_records(&recs);
+  rtems_test_assert(read >= 2);
+
+  sc = rtems_capture_release(read);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(rtems_capture_dropped() == 0);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+
+  master_id = rtems_task_self();
+
+  sc = rtems_task_create(
+    rtems_build_name('P', 'A', 'R', 'T'),
+    TASK_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &partner_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(partner_id, partner_task, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_capture_open(RECORD_COUNT, timestamp);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_capture_watch_global(true);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_capture_set_trigger(
+    0,
+    0,
+    rtems_build_name('P', 'A', 'R', 'T'),
+    0,
+    rtems_capture_from_any,
+    rtems_capture_switch
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_full_and_partial_release();
+  test_flush();
+
+  sc = rtems_capture_close();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  puts("\n\n*** TEST CAPTURE 1 ***");
+
+  test();
+
+  puts("*** END OF TEST CAPTURE 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS 4
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_MAXIMUM_USER_EXTENSIONS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,394 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <rtems/capture.h>
+#include <rtems/capture-export.h>
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+#define RECORD_COUNT 16
+
+#define ROUND_TRIPS 64
+
+#define THRESHOLD 8
+
+#define TIMEOUT_US 10000
+
+#define TASK_PRIORITY 2
+
+#define EXPORT_PRIORITY 3
+
+#define TRACE_FILE "/trace"
+
+static const rtems_name partner_name = rtems_build_name('P', 'A', 'R', 'T');
+
+static const rtems_name export_name = rtems_build_name('C', 'P', 'e', 'x');
+
+static rtems_id master_id;
+
+static rtems_id partner_id;
+
+static rtems_name master_name;
+
+static uint8_t trace[64 * 1024];
+
+static void partner_task(rtems_task_argument arg)
+{
+  while (true) {
+    rtems_status_code sc;
+    rtems_event_set events;
+
+    sc = rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_event_send(master_id, RTEMS_EVENT_0);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+/*
+ * The export task has a lower priority than the master and the partner, so
+ * it cannot drain the records during the round trips.  Each round trip
+ * produces at least two records.
+ */
+static void switch_tasks(uint32_t round_trips)
+{
+  rtems_status_code sc;
+  uint32_t i;
+
+  for (i = 0; i < round_trips; ++i) {
+    rtems_event_set events;
+
+    sc = rtems_event_send(partner_id, RTEMS_EVENT_0);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_event_receive(
+      RTEMS_EVENT_0,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void wait_for_export(void)
+{
+  rtems_status_code sc;
+
+  sc = rtems_task_wake_after(2 * RTEMS_MICROSECONDS_TO_TICKS(TIMEOUT_US) + 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static uint32_t get_le32(const uint8_t *p)
+{
+  return (uint32_t) p[0]
+    | ((uint32_t) p[1] << 8)
+    | ((uint32_t) p[2] << 16)
+    | ((uint32_t) p[3] << 24);
+}
+
+static size_t read_trace(void)
+{
+  size_t size = 0;
+  ssize_t n;
+  int fd;
+  int rv;
+
+  fd = open(TRACE_FILE, O_RDONLY);
+  rtems_test_assert(fd >= 0);
+
+  do {
+    n = read(fd, &trace[size], sizeof(trace) - size);
+    rtems_test_assert(n >= 0);
+    size += (size_t) n;
+  } while (n > 0 && size < sizeof(trace));
+
+  rtems_test_assert(size < sizeof(trace));
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  return size;
+}
+
+static void check_record(const uint8_t *rec)
+{
+  uint32_t name = get_le32(&rec[4]);
+  uint32_t events = get_le32(&rec[8]);
+  uint32_t cpu = get_le32(&rec[20]);
+
+  rtems_test_assert(
+    name == master_name || name == partner_name || name == export_name
+  );
+  rtems_test_assert(
+    (events & ~(RTEMS_CAPTURE_REAL_PRI_EVENT_MASK
+      | RTEMS_CAPTURE_CURR_PRI_EVENT_MASK)) != 0
+  );
+  rtems_test_assert(cpu < rtems_smp_get_processor_count());
+}
+
+/*
+ * Parse the stream against the format documented in <rtems/capture-export.h>
+ * and compare it with the export statistics.
+ */
+static void check_trace(const rtems_capture_export_stats_t *stats)
+{
+  size_t size = read_trace();
+  const uint8_t *p = trace;
+  const uint8_t *end = trace + size;
+  uint32_t header_size;
+  uint32_t batch_size;
+  uint32_t record_size;
+  uint32_t batches = 0;
+  uint32_t records = 0;
+  uint32_t max_batch = 0;
+  uint32_t dropped = 0;
+  uint32_t last_ticks = 0;
+  uint32_t last_tick_offset = 0;
+
+  rtems_test_assert(size == stats->bytes);
+  rtems_test_assert(size >= RTEMS_CAPTURE_EXPORT_HEADER_SIZE);
+
+  rtems_test_assert(get_le32(&p[0]) == RTEMS_CAPTURE_EXPORT_MAGIC);
+  rtems_test_assert(p[0] == 'R' && p[1] == 'T' && p[2] == 'C' && p[3] == 'T');
+  rtems_test_assert(get_le32(&p[4]) == RTEMS_CAPTURE_EXPORT_VERSION);
+
+  header_size = get_le32(&p[8]);
+  batch_size = get_le32(&p[12]);
+  record_size = get_le32(&p[16]);
+  rtems_test_assert(header_size == RTEMS_CAPTURE_EXPORT_HEADER_SIZE);
+  rtems_test_assert(batch_size == RTEMS_CAPTURE_EXPORT_BATCH_SIZE);
+  rtems_test_assert(record_size == RTEMS_CAPTURE_BINARY_RECORD_SIZE);
+
+  rtems_test_assert(get_le32(&p[20]) == rtems_capture_tick_time());
+  rtems_test_assert(get_le32(&p[24]) == rtems_smp_get_processor_count());
+  rtems_test_assert(get_le32(&p[28]) == 0);
+
+  p += header_size;
+
+  while (p < end) {
+    uint32_t count;
+    uint32_t batch_dropped;
+    uint32_t i;
+
+    rtems_test_assert((size_t) (end - p) >= batch_size);
+    rtems_test_assert(p[0] == 'B' && p[1] == 'T' && p[2] == 'C' && p[3] == 'H');
+
+    count = get_le32(&p[4]);
+    batch_dropped = get_le32(&p[8]);
+    rtems_test_assert(count > 0);
+    rtems_test_assert(batch_dropped >= dropped);
+    p += batch_size;
+
+    rtems_test_assert((size_t) (end - p) >= count * record_size);
+
+    for (i = 0; i < count; ++i) {
+      uint32_t ticks = get_le32(&p[12]);
+      uint32_t tick_offset = get_le32(&p[16]);
+
+      check_record(p);
+
+      rtems_test_assert(
+        ticks > last_ticks
+          || (ticks == last_ticks && tick_offset >= last_tick_offset)
+      );
+      last_ticks = ticks;
+      last_tick_offset = tick_offset;
+
+      p += record_size;
+    }
+
+    ++batches;
+    records += count;
+    dropped = batch_dropped;
+
+    if (count > max_batch) {
+      max_batch = count;
+    }
+  }
+
+  rtems_test_assert(p == end);
+  rtems_test_assert(batches == stats->batches);
+  rtems_test_assert(records == stats->records);
+  rtems_test_assert(max_batch == stats->max_batch);
+  rtems_test_assert(dropped <= stats->dropped);
+}
+
+static void test_export(void)
+{
+  rtems_capture_export_stats_t stats;
+  rtems_status_code sc;
+  int fd;
+  int rv;
+
+  fd = open(TRACE_FILE, O_WRONLY | O_CREAT | O_TRUNC, S_IRWXU);
+  rtems_test_assert(fd >= 0);
+
+  sc = rtems_capture_export_start(fd, EXPORT_PRIORITY, 0, TIMEOUT_US);
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_capture_export_start(fd, EXPORT_PRIORITY, THRESHOLD, 0);
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_capture_export_start(fd, EXPORT_PRIORITY, THRESHOLD, TIMEOUT_US);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(rtems_capture_export_active());
+
+  sc = rtems_capture_export_start(fd, EXPORT_PRIORITY, THRESHOLD, TIMEOUT_US);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+
+  /*
+   * The export task writes the stream header.
+   */
+  wait_for_export();
+
+  rtems_capture_export_get_stats(&stats);
+  rtems_test_assert(stats.bytes == RTEMS_CAPTURE_EXPORT_HEADER_SIZE);
+  rtems_test_assert(stats.records == 0);
+  rtems_test_assert(stats.dropped == 0);
+
+  sc = rtems_capture_control(true);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /*
+   * The records exceed the capacity of the capture buffer before the export
+   * task can run, so some records must be dropped.
+   */
+  switch_tasks(ROUND_TRIPS);
+  wait_for_export();
+
+  rtems_capture_export_get_stats(&stats);
+  rtems_test_assert(stats.dropped > 0);
+  rtems_test_assert(stats.records > 0);
+  rtems_test_assert(stats.batches > 0);
+  rtems_test_assert(stats.max_batch <= RECORD_COUNT);
+
+  /*
+   * A short burst fits into the capture buffer.
+   */
+  switch_tasks(2);
+  wait_for_export();
+
+  sc = rtems_capture_control(false);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_capture_export_stop();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(!rtems_capture_export_active());
+
+  rtems_capture_export_get_stats(&stats);
+  rtems_test_assert(stats.write_errors == 0);
+  rtems_test_assert(stats.busy_ns > 0);
+  rtems_test_assert(
+    stats.bytes == RTEMS_CAPTURE_EXPORT_HEADER_SIZE
+      + stats.batches * RTEMS_CAPTURE_EXPORT_BATCH_SIZE
+      + stats.records * RTEMS_CAPTURE_BINARY_RECORD_SIZE
+  );
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  check_trace(&stats);
+
+  rv = unlink(TRACE_FILE);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+
+  master_id = rtems_task_self();
+
+  sc = rtems_object_get_classic_name(master_id, &master_name);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_create(
+    partner_name,
+    TASK_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &partner_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(partner_id, partner_task, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_capture_open(RECORD_COUNT, NULL);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_capture_watch_global(true);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_capture_set_trigger(
+    0,
+    0,
+    partner_name,
+    0,
+    rtems_capture_from_any,
+    rtems_capture_switch
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_export();
+
+  sc = rtems_capture_close();
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  puts("\n\n*** TEST CAPTURE 2 ***");
+
+  test();
+
+  puts("*** END OF TEST CAPTURE 2 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_MAXIMUM_USER_EXTENSIONS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
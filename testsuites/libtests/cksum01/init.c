@@ -0,0 +1,202 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <inttypes.h>
+#include <string.h>
+
+#include <netinet/in.h>
+#include <sys/mbuf.h>
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+int in_cksum(struct mbuf *m, int len);
+
+#define MAX_SIZE 1500
+
+#define CHAIN_LENGTH 4
+
+#define ITERATIONS 2000
+
+static const size_t sizes[] = { 64, 576, MAX_SIZE };
+
+static u_char data[MAX_SIZE];
+
+static u_char storage[CHAIN_LENGTH][MAX_SIZE + 8];
+
+static struct mbuf chain[CHAIN_LENGTH];
+
+/*
+ * The checksum of RFC 1071 computed a 16-bit word at a time in network
+ * byte order.
+ */
+static uint16_t reference_cksum(const u_char *p, size_t len)
+{
+  uint32_t sum = 0;
+  size_t i;
+
+  for (i = 0; i + 1 < len; i += 2) {
+    sum += ((uint32_t) p[i] << 8) | p[i + 1];
+  }
+
+  if ((len & 1) != 0) {
+    sum += (uint32_t) p[len - 1] << 8;
+  }
+
+  while ((sum >> 16) != 0) {
+    sum = (sum & 0xffff) + (sum >> 16);
+  }
+
+  return htons((uint16_t) ~sum);
+}
+
+static struct mbuf *make_chain(
+  const u_char *p,
+  const size_t *lengths,
+  size_t count,
+  size_t offset
+)
+{
+  size_t i;
+
+  for (i = 0; i < count; ++i) {
+    chain[i].m_next = i + 1 < count ? &chain[i + 1] : NULL;
+    chain[i].m_len = (int) lengths[i];
+    chain[i].m_data = (caddr_t) &storage[i][offset];
+    memcpy(chain[i].m_data, p, lengths[i]);
+    p += lengths[i];
+  }
+
+  return &chain[0];
+}
+
+static void test_chains(void)
+{
+  size_t len;
+
+  for (len = 0; len <= 64; ++len) {
+    size_t split;
+
+    for (split = 0; split <= len; ++split) {
+      size_t offset;
+
+      for (offset = 0; offset < 4; ++offset) {
+        size_t lengths[3];
+        struct mbuf *m;
+
+        lengths[0] = split / 2;
+        lengths[1] = split - split / 2;
+        lengths[2] = len - split;
+
+        m = make_chain(data, lengths, 3, offset);
+        rtems_test_assert(
+          (uint16_t) in_cksum(m, (int) len) == reference_cksum(data, len)
+        );
+      }
+    }
+  }
+}
+
+static uint32_t elapsed_ns(const struct timespec *begin)
+{
+  struct timespec end;
+  uint32_t ns;
+
+  rtems_clock_get_uptime(&end);
+
+  ns = (uint32_t) ((end.tv_sec - begin->tv_sec) * 1000000000
+    + (end.tv_nsec - begin->tv_nsec));
+  if (ns == 0) {
+    ns = 1;
+  }
+
+  return ns;
+}
+
+static uint32_t bytes_per_us(size_t size, uint32_t ns)
+{
+  return (uint32_t) ((uint64_t) size * ITERATIONS * 1000 / ns);
+}
+
+static void benchmark(size_t size, size_t offset)
+{
+  struct timespec begin;
+  volatile uint32_t sink = 0;
+  uint32_t fast_ns;
+  uint32_t reference_ns;
+  struct mbuf *m;
+  int i;
+
+  m = make_chain(data, &size, 1, offset);
+
+  rtems_clock_get_uptime(&begin);
+  for (i = 0; i < ITERATIONS; ++i) {
+    sink += (uint32_t) in_cksum(m, (int) size);
+  }
+  fast_ns = elapsed_ns(&begin);
+
+  rtems_clock_get_uptime(&begin);
+  for (i = 0; i < ITERATIONS; ++i) {
+    sink += reference_cksum(mtod(m, u_char *), size);
+  }
+  reference_ns = elapsed_ns(&begin);
+
+  printf(
+    "size %4zu, offset %zu: in_cksum %" PRIu32 " bytes/us, reference %"
+      PRIu32 " bytes/us\n",
+    size,
+    offset,
+    bytes_per_us(size, fast_ns),
+    bytes_per_us(size, reference_ns)
+  );
+}
+
+static void test(void)
+{
+  size_t i;
+
+  for (i = 0; i < MAX_SIZE; ++i) {
+    data[i] = (u_char) (i * 7 + (i >> 8) * 13 + 1);
+  }
+
+  test_chains();
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(sizes); ++i) {
+    benchmark(sizes[i], 0);
+    benchmark(sizes[i], 1);
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  puts("\n\n*** TEST CKSUM 1 ***");
+
+  test();
+
+  puts("*** END OF TEST CKSUM 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,164 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <rtems/cpuuse.h>
+#include <rtems/score/objectimpl.h>
+
+#define SAMPLER_PRIORITY 1
+
+/*
+ * The load is given in thousandths of a percent.
+ */
+#define MINIMUM_BUSY_LOAD 50000
+
+static void busy_wait(rtems_interval ticks)
+{
+  rtems_interval start = rtems_clock_get_ticks_since_boot();
+
+  while (rtems_clock_get_ticks_since_boot() - start < ticks) {
+    /* Busy */
+  }
+}
+
+static void test_errors(void)
+{
+  rtems_status_code sc;
+  uint32_t load;
+
+  sc = rtems_cpu_usage_get_thread_load(RTEMS_SELF, 1, &load);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  sc = rtems_cpu_usage_get_thread_load(RTEMS_SELF, 0, &load);
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_cpu_usage_get_thread_load(
+    RTEMS_SELF,
+    RTEMS_CPU_USAGE_WINDOW_MAXIMUM + 1,
+    &load
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_cpu_usage_get_thread_load(RTEMS_SELF, 1, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_cpu_usage_get_processor_load(
+    rtems_smp_get_processor_count(),
+    1,
+    &load
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_cpu_usage_top_start(SAMPLER_PRIORITY);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+}
+
+static void test_loads(void)
+{
+  rtems_status_code sc;
+  uint32_t load_1;
+  uint32_t load_60;
+  uint32_t load;
+
+  /*
+   * The sampler preempts this task once per second.
+   */
+  busy_wait(3 * rtems_clock_get_ticks_per_second());
+
+  sc = rtems_cpu_usage_get_thread_load(RTEMS_SELF, 1, &load_1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(load_1 >= MINIMUM_BUSY_LOAD);
+
+  /*
+   * Less than the window was sampled so far.
+   */
+  sc = rtems_cpu_usage_get_thread_load(RTEMS_SELF, 60, &load_60);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(load_60 >= MINIMUM_BUSY_LOAD);
+
+  sc = rtems_cpu_usage_get_processor_load(
+    rtems_smp_get_current_processor(),
+    1,
+    &load
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(load >= MINIMUM_BUSY_LOAD);
+
+  sc = rtems_cpu_usage_get_thread_load(
+    rtems_build_id(OBJECTS_CLASSIC_API, OBJECTS_RTEMS_TASKS, 1, 0xffff),
+    1,
+    &load
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  /*
+   * An idle task does not consume the processor time.
+   */
+  rtems_task_wake_after(2 * rtems_clock_get_ticks_per_second());
+
+  sc = rtems_cpu_usage_get_thread_load(RTEMS_SELF, 1, &load);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(load < load_1);
+
+  rtems_cpu_usage_top_report_with_plugin(
+    stdout,
+    (rtems_printk_plugin_t) fprintf
+  );
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  uint32_t load;
+
+  rtems_test_assert(!rtems_cpu_usage_top_is_active());
+
+  sc = rtems_cpu_usage_top_start(SAMPLER_PRIORITY);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(rtems_cpu_usage_top_is_active());
+
+  test_errors();
+  test_loads();
+
+  rtems_cpu_usage_top_stop();
+  rtems_test_assert(!rtems_cpu_usage_top_is_active());
+
+  sc = rtems_cpu_usage_get_thread_load(RTEMS_SELF, 1, &load);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  puts("\n\n*** TEST CPUUSETOP 1 ***");
+
+  test();
+
+  puts("*** END OF TEST CPUUSETOP 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,175 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <rtems.h>
+#include <rtems/score/heapimpl.h>
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+#define AREA_SIZE (256 * 1024)
+
+#define FRAGMENT_COUNT 2048
+
+#define MAXIMUM_FRAGMENT_SIZE 64
+
+#define MAXIMUM_SIZE 512
+
+#define MEASURE_COUNT 10000
+
+static char area [AREA_SIZE] __attribute__((aligned(CPU_HEAP_ALIGNMENT)));
+
+static Heap_Control heap;
+
+static void *fragments [FRAGMENT_COUNT];
+
+static uint32_t random_state;
+
+static uintptr_t random_size(uintptr_t maximum_size)
+{
+  random_state = random_state * 1103515245 + 12345;
+
+  return ((random_state >> 16) % maximum_size) + 1;
+}
+
+static uint64_t get_uptime_in_nanoseconds(void)
+{
+  rtems_status_code sc;
+  struct timespec uptime;
+
+  sc = rtems_clock_get_uptime(&uptime);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return (uint64_t) uptime.tv_sec * 1000000000 + (uint64_t) uptime.tv_nsec;
+}
+
+static void initialize_heap(bool segregated_fit)
+{
+  uintptr_t size;
+  int i;
+
+  size = _Heap_Initialize(&heap, area, sizeof(area), 0);
+  rtems_test_assert(size > 0);
+
+  if (segregated_fit) {
+    bool ok = _Heap_Enable_segregated_fit(&heap);
+    rtems_test_assert(ok);
+  }
+
+  /*
+   * Allocate many small blocks of random size and free every other one to
+   * obtain a long free list of fragments too small for most of the measured
+   * allocation requests.
+   */
+  random_state = 0;
+
+  for (i = 0; i < FRAGMENT_COUNT; ++i) {
+    uintptr_t size = random_size(MAXIMUM_FRAGMENT_SIZE);
+
+    fragments [i] = _Heap_Allocate(&heap, size);
+    rtems_test_assert(fragments [i] != NULL);
+  }
+
+  for (i = 0; i < FRAGMENT_COUNT; i += 2) {
+    _Heap_Free(&heap, fragments [i]);
+  }
+}
+
+static void release_heap(void)
+{
+  int i;
+
+  for (i = 1; i < FRAGMENT_COUNT; i += 2) {
+    _Heap_Free(&heap, fragments [i]);
+  }
+
+  rtems_test_assert(_Heap_Walk(&heap, 0, false));
+}
+
+static void measure(const char *name, bool segregated_fit)
+{
+  Heap_Statistics *stats = &heap.stats;
+  uint64_t total = 0;
+  uint64_t worst = 0;
+  uint32_t allocs;
+  uint32_t searches;
+  int i;
+
+  initialize_heap(segregated_fit);
+
+  allocs = stats->allocs;
+  searches = stats->searches;
+  stats->max_search = 0;
+
+  for (i = 0; i < MEASURE_COUNT; ++i) {
+    uintptr_t size = random_size(MAXIMUM_SIZE);
+    uint64_t begin;
+    uint64_t delta;
+    void *p;
+
+    begin = get_uptime_in_nanoseconds();
+    p = _Heap_Allocate(&heap, size);
+    delta = get_uptime_in_nanoseconds() - begin;
+    rtems_test_assert(p != NULL);
+
+    total += delta;
+    if (delta > worst) {
+      worst = delta;
+    }
+
+    _Heap_Free(&heap, p);
+  }
+
+  allocs = stats->allocs - allocs;
+  searches = stats->searches - searches;
+
+  printf(
+    "%s\n"
+    "\tallocations %" PRIu32 ", average searches %" PRIu32
+      ", maximum searches %" PRIu32 "\n"
+    "\taverage latency %" PRIu64 "ns, worst latency %" PRIu64 "ns\n",
+    name,
+    allocs,
+    searches / allocs,
+    stats->max_search,
+    total / MEASURE_COUNT,
+    worst
+  );
+
+  release_heap();
+}
+
+static rtems_task Init(rtems_task_argument argument)
+{
+  puts("\n\n*** TEST HEAPBENCH 1 ***");
+
+  measure("first fit", false);
+  measure("segregated fit", true);
+
+  puts("*** END OF TEST HEAPBENCH 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,116 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include "test_support.h"
+#include <rtems/malloc.h>
+
+#include <stdlib.h>
+
+/* forward declarations to avoid warnings */
+rtems_task Init(rtems_task_argument argument);
+
+#define OBJECT_COUNT (RTEMS_MALLOC_CACHE_MAGAZINE_SIZE / 2)
+
+#define SMALL_SIZE 24
+
+#define LARGE_SIZE 4096
+
+static void *objects[ OBJECT_COUNT ];
+
+static void get_statistics( rtems_malloc_statistics_t *stats )
+{
+  int sc;
+
+  sc = malloc_get_statistics( stats );
+  rtems_test_assert( sc == 0 );
+}
+
+static void allocate_objects( void )
+{
+  int i;
+
+  for ( i = 0 ; i < OBJECT_COUNT ; ++i ) {
+    objects[ i ] = malloc( SMALL_SIZE );
+    rtems_test_assert( objects[ i ] != NULL );
+  }
+}
+
+static void free_objects( void )
+{
+  int i;
+
+  for ( i = 0 ; i < OBJECT_COUNT ; ++i ) {
+    free( objects[ i ] );
+  }
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_malloc_statistics_t  before;
+  rtems_malloc_statistics_t  after;
+  void                      *p;
+
+  puts( "\n\n*** TEST MALLOC06 ***" );
+
+  rtems_test_assert( rtems_malloc_caches != NULL );
+
+  puts( "malloc - small allocations use the cache" );
+  get_statistics( &before );
+  allocate_objects();
+  get_statistics( &after );
+  rtems_test_assert( after.cache_misses - before.cache_misses <= 1 );
+  rtems_test_assert(
+    after.cache_hits - before.cache_hits
+      + after.cache_misses - before.cache_misses == OBJECT_COUNT
+  );
+
+  puts( "free/malloc - small objects are recycled through the cache" );
+  free_objects();
+  get_statistics( &before );
+  allocate_objects();
+  get_statistics( &after );
+  rtems_test_assert( after.cache_misses == before.cache_misses );
+  rtems_test_assert( after.cache_hits - before.cache_hits == OBJECT_COUNT );
+  free_objects();
+
+  puts( "malloc - large allocation bypasses the cache" );
+  get_statistics( &before );
+  p = malloc( LARGE_SIZE );
+  rtems_test_assert( p != NULL );
+  free( p );
+  get_statistics( &after );
+  rtems_test_assert( after.cache_misses == before.cache_misses );
+  rtems_test_assert( after.cache_hits == before.cache_hits );
+
+  puts( "*** END OF TEST MALLOC06 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MALLOC_PER_CPU_CACHES
+
+#define CONFIGURE_MAXIMUM_TASKS             1
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
@@ -1222,6 +1222,208 @@ static void test_greedy_allocate(void)
   rtems_test_assert( p == NULL );
 }
 
+#define TEST_SEGREGATED_FIT_AREA_SIZE 4096
+
+static uint8_t TestSegregatedFitMemory[
+  sizeof( Heap_Segregated_fit ) + 3 * TEST_SEGREGATED_FIT_AREA_SIZE
+];
+
+static void test_segregated_fit_init(void)
+{
+  uintptr_t rv = 0;
+  bool ok = false;
+
+  memset( &TestSegregatedFitMemory, 0x7f, sizeof( TestSegregatedFitMemory ) );
+
+  rv = _Heap_Initialize(
+    &TestHeap,
+    TestSegregatedFitMemory,
+    sizeof( Heap_Segregated_fit ) + TEST_SEGREGATED_FIT_AREA_SIZE,
+    0
+  );
+  rtems_test_assert( rv > 0 );
+
+  ok = _Heap_Enable_segregated_fit( &TestHeap );
+  rtems_test_assert( ok );
+  rtems_test_assert( _Heap_Is_segregated_fit( &TestHeap ) );
+  rtems_test_assert( _Heap_Walk( &TestHeap, 0, false ) );
+}
+
+static uintptr_t test_segregated_fit_free_size(void)
+{
+  Heap_Information info;
+
+  _Heap_Get_free_information( &TestHeap, &info );
+
+  return info.total;
+}
+
+static void test_heap_segregated_fit_allocate(void)
+{
+  Heap_Control *heap = &TestHeap;
+  uintptr_t const alignment = 1024;
+  uintptr_t const boundary = 512;
+  uintptr_t free_size = 0;
+  uintptr_t block_size = 0;
+  Heap_Block *blocks = NULL;
+  Heap_Information info;
+  void *p[8];
+  void *p1 = NULL;
+  int i = 0;
+
+  test_segregated_fit_init();
+  free_size = test_segregated_fit_free_size();
+
+  puts( "segregated fit - allocate aligned in a fragmented heap" );
+  for ( i = 0 ; i < 8 ; ++i ) {
+    p[i] = test_alloc_simple( 24, 0, 0 );
+  }
+  for ( i = 1 ; i < 8 ; i += 2 ) {
+    test_free( p[i] );
+  }
+  p1 = test_alloc_simple( 24, alignment, 0 );
+  test_free( p1 );
+
+  puts( "segregated fit - allocate with boundary" );
+  p1 = test_alloc_simple( 200, 0, boundary );
+  test_free( p1 );
+  p1 = test_alloc_simple( 200, 64, boundary );
+  test_free( p1 );
+
+  for ( i = 0 ; i < 8 ; i += 2 ) {
+    test_free( p[i] );
+  }
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+  rtems_test_assert( test_segregated_fit_free_size() == free_size );
+
+  /*
+   * The only free block is in a free list below the one reached by the
+   * rounded up search size, so the allocation must find it with the linear
+   * scan of the free lists.
+   */
+  puts( "segregated fit - allocate aligned from the smallest fitting block" );
+  block_size = alignment + 2 * heap->min_block_size;
+  blocks = _Heap_Greedy_allocate( heap, &block_size, 1 );
+  _Heap_Get_free_information( heap, &info );
+  rtems_test_assert( info.number == 1 );
+  p1 = test_alloc_simple( 1, alignment, 0 );
+  test_free( p1 );
+  _Heap_Greedy_free( heap, blocks );
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+  rtems_test_assert( test_segregated_fit_free_size() == free_size );
+}
+
+static void test_heap_segregated_fit_resize(void)
+{
+  Heap_Control *heap = &TestHeap;
+  uintptr_t free_size = 0;
+  void *p1 = NULL;
+  void *p2 = NULL;
+  void *p3 = NULL;
+
+  test_segregated_fit_init();
+  free_size = test_segregated_fit_free_size();
+
+  puts( "segregated fit - resize into the next free block" );
+  p1 = test_alloc_simple( 64, 0, 0 );
+  p2 = test_alloc_simple( 256, 0, 0 );
+  p3 = test_alloc_simple( 64, 0, 0 );
+  test_free( p2 );
+  test_simple_resize_block( p1, 192, HEAP_RESIZE_SUCCESSFUL );
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+
+  puts( "segregated fit - resize beyond the next used block" );
+  test_simple_resize_block( p1, 1024, HEAP_RESIZE_UNSATISFIED );
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+
+  puts( "segregated fit - decrease size" );
+  test_simple_resize_block( p1, 1, HEAP_RESIZE_SUCCESSFUL );
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+
+  test_free( p1 );
+  test_free( p3 );
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+  rtems_test_assert( test_segregated_fit_free_size() == free_size );
+}
+
+static void test_heap_segregated_fit_extend(void)
+{
+  Heap_Control *heap = &TestHeap;
+  uint8_t *area_end =
+    &TestSegregatedFitMemory[ sizeof( Heap_Segregated_fit ) ]
+      + TEST_SEGREGATED_FIT_AREA_SIZE;
+  uintptr_t free_size = 0;
+  void *p1 = NULL;
+  bool ret = false;
+
+  test_segregated_fit_init();
+  free_size = test_segregated_fit_free_size();
+
+  puts( "segregated fit - extend merge above" );
+  ret = _Protected_heap_Extend( heap, area_end, TEST_SEGREGATED_FIT_AREA_SIZE );
+  test_heap_assert( ret, true );
+  rtems_test_assert( test_segregated_fit_free_size() > free_size );
+
+  p1 = test_alloc_simple( 3 * TEST_SEGREGATED_FIT_AREA_SIZE / 2, 0, 0 );
+  test_free( p1 );
+
+  puts( "segregated fit - extend link above" );
+  free_size = test_segregated_fit_free_size();
+  ret = _Protected_heap_Extend(
+    heap,
+    area_end + TEST_SEGREGATED_FIT_AREA_SIZE + 256,
+    TEST_SEGREGATED_FIT_AREA_SIZE - 256
+  );
+  test_heap_assert( ret, true );
+  rtems_test_assert( test_segregated_fit_free_size() > free_size );
+
+  p1 = test_alloc_simple( 256, 256, 0 );
+  test_free( p1 );
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+}
+
+static void test_heap_segregated_fit_greedy(void)
+{
+  Heap_Control *heap = &TestHeap;
+  uintptr_t free_size = 0;
+  uintptr_t allocatable_size = 0;
+  Heap_Block *blocks = NULL;
+  Heap_Information info;
+  void *p1 = NULL;
+  void *p2 = NULL;
+
+  test_segregated_fit_init();
+  free_size = test_segregated_fit_free_size();
+
+  puts( "segregated fit - greedy allocate" );
+  blocks = _Heap_Greedy_allocate( heap, NULL, 0 );
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+  rtems_test_assert( test_segregated_fit_free_size() == 0 );
+  rtems_test_assert( _Heap_Allocate( heap, 1 ) == NULL );
+
+  puts( "segregated fit - greedy free" );
+  _Heap_Greedy_free( heap, blocks );
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+  rtems_test_assert( test_segregated_fit_free_size() == free_size );
+
+  puts( "segregated fit - greedy allocate all except largest" );
+  p1 = test_alloc_simple( 64, 0, 0 );
+  p2 = test_alloc_simple( 64, 0, 0 );
+  test_free( p1 );
+  blocks = _Heap_Greedy_allocate_all_except_largest( heap, &allocatable_size );
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+  _Heap_Get_free_information( heap, &info );
+  rtems_test_assert( info.number == 1 );
+  rtems_test_assert( allocatable_size > 64 );
+  p1 = test_alloc_simple( allocatable_size, 0, 0 );
+  rtems_test_assert( _Heap_Allocate( heap, 1 ) == NULL );
+  test_free( p1 );
+  _Heap_Greedy_free( heap, blocks );
+  test_free( p2 );
+  rtems_test_assert( _Heap_Walk( heap, 0, false ) );
+  rtems_test_assert( test_segregated_fit_free_size() == free_size );
+}
+
 rtems_task Init(
   rtems_task_argument argument
 )
@@ -1271,6 +1473,10 @@ rtems_task Init(
   test_protected_heap_info();
   test_rtems_heap_allocate_aligned_with_boundary();
   test_greedy_allocate();
+  test_heap_segregated_fit_allocate();
+  test_heap_segregated_fit_resize();
+  test_heap_segregated_fit_extend();
+  test_heap_segregated_fit_greedy();
 
   test_posix_memalign();
 
@@ -0,0 +1,116 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <rtems/rtems_bsdnet.h>
+#include <sys/mbuf.h>
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+extern struct mbstat mbstat;
+
+#define INITIAL_CLUSTERS 8
+
+#define MAX_CLUSTERS (INITIAL_CLUSTERS + 32)
+
+#define EXTRA_CLUSTERS 16
+
+#define SHRINK_TIMEOUT_SECONDS 60
+
+struct rtems_bsdnet_config rtems_bsdnet_config = {
+  .mbuf_cluster_bytecount = INITIAL_CLUSTERS * MCLBYTES,
+  .mbuf_cluster_max_bytecount = MAX_CLUSTERS * MCLBYTES
+};
+
+static struct mbuf *chains[MAX_CLUSTERS];
+
+static void test_grow(size_t count)
+{
+  u_long waits = mbstat.m_wait;
+  size_t i;
+
+  for (i = 0; i < count; ++i) {
+    chains[i] = rtems_bsdnet_mbuf_alloc(MCLBYTES);
+    rtems_test_assert(chains[i] != NULL);
+    rtems_test_assert((chains[i]->m_flags & M_EXT) != 0);
+  }
+
+  rtems_test_assert(mbstat.m_wait == waits);
+  rtems_test_assert(mbstat.m_grow > 0);
+  rtems_test_assert(mbstat.m_clusters > INITIAL_CLUSTERS);
+  rtems_test_assert(mbstat.m_clusters <= MAX_CLUSTERS);
+  rtems_test_assert(
+    mbstat.m_clhiwat >= mbstat.m_clusters - mbstat.m_clfree
+  );
+  rtems_test_assert(mbstat.m_clusters - mbstat.m_clfree >= count);
+
+  for (i = 0; i < count; ++i) {
+    rtems_bsdnet_mbuf_free(chains[i]);
+  }
+}
+
+static void test_shrink(u_long clfree)
+{
+  int seconds = 0;
+
+  while (mbstat.m_clusters != INITIAL_CLUSTERS) {
+    rtems_test_assert(seconds < SHRINK_TIMEOUT_SECONDS);
+    rtems_task_wake_after(rtems_clock_get_ticks_per_second());
+    ++seconds;
+  }
+
+  rtems_test_assert(mbstat.m_shrink > 0);
+  rtems_test_assert(mbstat.m_clfree == clfree);
+}
+
+static void test(void)
+{
+  u_long clfree = mbstat.m_clfree;
+
+  test_grow(clfree + EXTRA_CLUSTERS);
+  test_shrink(clfree);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  int rv;
+
+  puts("\n\n*** TEST MBUF 1 ***");
+
+  rv = rtems_bsdnet_initialize_network();
+  rtems_test_assert(rv == 0);
+
+  test();
+
+  puts("*** END OF TEST MBUF 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_SEMAPHORES 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
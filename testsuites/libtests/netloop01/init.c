@@ -0,0 +1,224 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/rtems_bsdnet.h>
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+struct rtems_bsdnet_config rtems_bsdnet_config;
+
+#define PORT 1234
+
+#define SENDER_COUNT 2
+
+#define CHUNK_SIZE (8 * 1024)
+
+#define TRANSFER_SIZE (4 * 1024 * 1024)
+
+static int client_fd;
+
+static int server_fd;
+
+static rtems_id init_task;
+
+static char receive_buffer [CHUNK_SIZE];
+
+static char send_buffers [SENDER_COUNT][CHUNK_SIZE];
+
+/*
+ * The senders share one socket, so they contend for the lock of the send
+ * socket buffer.
+ */
+static void sender_task(rtems_task_argument arg)
+{
+  const char *buf = send_buffers [arg];
+  size_t todo = TRANSFER_SIZE / SENDER_COUNT;
+
+  while (todo > 0) {
+    ssize_t n = send(client_fd, buf, CHUNK_SIZE, 0);
+    rtems_test_assert(n > 0);
+
+    todo -= (size_t) n;
+  }
+
+  rtems_task_delete(RTEMS_SELF);
+}
+
+static void receiver_task(rtems_task_argument arg)
+{
+  size_t done = 0;
+
+  while (done < TRANSFER_SIZE) {
+    ssize_t n = recv(server_fd, receive_buffer, sizeof(receive_buffer), 0);
+    rtems_test_assert(n > 0);
+
+    done += (size_t) n;
+  }
+
+  rtems_test_assert(done == TRANSFER_SIZE);
+
+  rtems_event_transient_send(init_task);
+  rtems_task_delete(RTEMS_SELF);
+}
+
+static void start_task(
+  char name,
+  rtems_task_entry entry,
+  rtems_task_argument arg
+)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_task_create(
+    rtems_build_name('N', 'E', 'T', name),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(id, entry, arg);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void connect_sockets(void)
+{
+  struct sockaddr_in addr;
+  socklen_t addr_len = sizeof(addr);
+  int listen_fd;
+  int rv;
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_len = sizeof(addr);
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(PORT);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+  rtems_test_assert(listen_fd >= 0);
+
+  rv = bind(listen_fd, (struct sockaddr *) &addr, sizeof(addr));
+  rtems_test_assert(rv == 0);
+
+  rv = listen(listen_fd, 1);
+  rtems_test_assert(rv == 0);
+
+  client_fd = socket(AF_INET, SOCK_STREAM, 0);
+  rtems_test_assert(client_fd >= 0);
+
+  rv = connect(client_fd, (struct sockaddr *) &addr, sizeof(addr));
+  rtems_test_assert(rv == 0);
+
+  server_fd = accept(listen_fd, (struct sockaddr *) &addr, &addr_len);
+  rtems_test_assert(server_fd >= 0);
+
+  rv = close(listen_fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  struct timespec begin;
+  struct timespec end;
+  uint32_t elapsed_ms;
+  size_t i;
+  int rv;
+
+  init_task = rtems_task_self();
+
+  connect_sockets();
+
+  for (i = 0; i < SENDER_COUNT; ++i) {
+    memset(send_buffers [i], 'a' + (int) i, CHUNK_SIZE);
+  }
+
+  rtems_clock_get_uptime(&begin);
+
+  start_task('R', receiver_task, 0);
+
+  for (i = 0; i < SENDER_COUNT; ++i) {
+    start_task('0' + (char) i, sender_task, i);
+  }
+
+  sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_clock_get_uptime(&end);
+
+  elapsed_ms = (uint32_t) ((end.tv_sec - begin.tv_sec) * 1000
+    + (end.tv_nsec - begin.tv_nsec) / 1000000);
+  if (elapsed_ms == 0) {
+    elapsed_ms = 1;
+  }
+
+  printf(
+    "loopback throughput: %" PRIu32 " KiB in %" PRIu32 " ms, %" PRIu32
+      " KiB/s\n",
+    (uint32_t) (TRANSFER_SIZE / 1024),
+    elapsed_ms,
+    (uint32_t) ((uint64_t) TRANSFER_SIZE * 1000 / 1024 / elapsed_ms)
+  );
+
+  rv = close(client_fd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(server_fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  int rv;
+
+  puts("\n\n*** TEST NETLOOP 1 ***");
+
+  rv = rtems_bsdnet_initialize_network();
+  rtems_test_assert(rv == 0);
+
+  test();
+
+  puts("*** END OF TEST NETLOOP 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_MAXIMUM_TASKS (3 + SENDER_COUNT)
+#define CONFIGURE_MAXIMUM_SEMAPHORES 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
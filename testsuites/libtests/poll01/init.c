@@ -0,0 +1,373 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/rtems_bsdnet.h>
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+struct rtems_bsdnet_config rtems_bsdnet_config;
+
+#define PORT_A 1234
+
+#define PORT_B 1235
+
+#define PORT_C 1236
+
+#define HANGUP_TIMEOUT_MS 1000
+
+#define EVENT_COUNT 4
+
+static int open_udp_socket(struct sockaddr_in *addr, uint16_t port)
+{
+  int rv;
+  int fd;
+
+  memset(addr, 0, sizeof(*addr));
+  addr->sin_len = sizeof(*addr);
+  addr->sin_family = AF_INET;
+  addr->sin_port = htons(port);
+  addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  fd = socket(AF_INET, SOCK_DGRAM, 0);
+  rtems_test_assert(fd >= 0);
+
+  rv = bind(fd, (struct sockaddr *) addr, sizeof(*addr));
+  rtems_test_assert(rv == 0);
+
+  return fd;
+}
+
+static void send_datagram(int fd, const struct sockaddr_in *addr)
+{
+  char c = 'x';
+  ssize_t n;
+
+  n = sendto(fd, &c, sizeof(c), 0, (const struct sockaddr *) addr,
+    sizeof(*addr));
+  rtems_test_assert(n == sizeof(c));
+}
+
+static void receive_datagram(int fd)
+{
+  char c;
+  ssize_t n;
+
+  n = recv(fd, &c, sizeof(c), 0);
+  rtems_test_assert(n == sizeof(c));
+  rtems_test_assert(c == 'x');
+}
+
+static void test_poll(int fd_a, int fd_b, const struct sockaddr_in *addr_b)
+{
+  struct pollfd pfd [3];
+  int n;
+  int fd;
+
+  fd = open("/dev/console", O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  pfd [0].fd = fd_b;
+  pfd [0].events = POLLIN;
+  pfd [1].fd = -1;
+  pfd [1].events = POLLIN;
+
+  n = poll(pfd, 2, 0);
+  rtems_test_assert(n == 0);
+  rtems_test_assert(pfd [0].revents == 0);
+  rtems_test_assert(pfd [1].revents == 0);
+
+  n = poll(pfd, 2, 10);
+  rtems_test_assert(n == 0);
+
+  send_datagram(fd_a, addr_b);
+
+  n = poll(pfd, 2, -1);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(pfd [0].revents == POLLIN);
+  rtems_test_assert(pfd [1].revents == 0);
+
+  receive_datagram(fd_b);
+
+  pfd [1].fd = fd_a;
+  pfd [1].events = POLLIN | POLLOUT;
+  pfd [2].fd = fd;
+  pfd [2].events = POLLIN;
+
+  n = poll(pfd, 3, -1);
+  rtems_test_assert(n == 2);
+  rtems_test_assert(pfd [0].revents == 0);
+  rtems_test_assert(pfd [1].revents == POLLOUT);
+  rtems_test_assert(pfd [2].revents == POLLNVAL);
+
+  n = close(fd);
+  rtems_test_assert(n == 0);
+}
+
+static void test_evq(int fd_a, int fd_b, const struct sockaddr_in *addr_b)
+{
+  struct rtems_bsdnet_evq_event events [EVENT_COUNT];
+  rtems_bsdnet_evq *evq;
+  int rv;
+  int n;
+
+  evq = rtems_bsdnet_evq_create();
+  rtems_test_assert(evq != NULL);
+
+  rv = rtems_bsdnet_evq_ctl(evq, RTEMS_BSDNET_EVQ_ADD, fd_b, POLLIN, 0, evq);
+  rtems_test_assert(rv == 0);
+
+  rv = rtems_bsdnet_evq_ctl(evq, RTEMS_BSDNET_EVQ_ADD, fd_b, POLLIN, 0, evq);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EEXIST);
+
+  rv = rtems_bsdnet_evq_ctl(evq, RTEMS_BSDNET_EVQ_DEL, fd_a, 0, 0, NULL);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == ENOENT);
+
+  n = rtems_bsdnet_evq_wait(evq, events, EVENT_COUNT, 0);
+  rtems_test_assert(n == 0);
+
+  /* Level-triggered */
+
+  send_datagram(fd_a, addr_b);
+
+  n = rtems_bsdnet_evq_wait(evq, events, EVENT_COUNT, -1);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(events [0].fd == fd_b);
+  rtems_test_assert(events [0].events == POLLIN);
+  rtems_test_assert(events [0].udata == evq);
+
+  n = rtems_bsdnet_evq_wait(evq, events, EVENT_COUNT, 0);
+  rtems_test_assert(n == 1);
+
+  receive_datagram(fd_b);
+
+  n = rtems_bsdnet_evq_wait(evq, events, EVENT_COUNT, 0);
+  rtems_test_assert(n == 0);
+
+  /* Edge-triggered */
+
+  rv = rtems_bsdnet_evq_ctl(
+    evq,
+    RTEMS_BSDNET_EVQ_MOD,
+    fd_b,
+    POLLIN,
+    RTEMS_BSDNET_EVQ_EDGE,
+    NULL
+  );
+  rtems_test_assert(rv == 0);
+
+  send_datagram(fd_a, addr_b);
+
+  n = rtems_bsdnet_evq_wait(evq, events, EVENT_COUNT, -1);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(events [0].udata == NULL);
+
+  n = rtems_bsdnet_evq_wait(evq, events, EVENT_COUNT, 0);
+  rtems_test_assert(n == 0);
+
+  send_datagram(fd_a, addr_b);
+
+  n = rtems_bsdnet_evq_wait(evq, events, EVENT_COUNT, -1);
+  rtems_test_assert(n == 1);
+
+  receive_datagram(fd_b);
+  receive_datagram(fd_b);
+
+  /* A closed socket is removed from the event queue */
+
+  rv = rtems_bsdnet_evq_ctl(evq, RTEMS_BSDNET_EVQ_ADD, fd_a, POLLOUT, 0, NULL);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd_a);
+  rtems_test_assert(rv == 0);
+
+  n = rtems_bsdnet_evq_wait(evq, events, EVENT_COUNT, 0);
+  rtems_test_assert(n == 0);
+
+  rv = rtems_bsdnet_evq_destroy(evq);
+  rtems_test_assert(rv == 0);
+}
+
+static void connect_tcp_sockets(int *client_fd, int *server_fd)
+{
+  struct sockaddr_in addr;
+  socklen_t addr_len = sizeof(addr);
+  int listen_fd;
+  int rv;
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sin_len = sizeof(addr);
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(PORT_C);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+  rtems_test_assert(listen_fd >= 0);
+
+  rv = bind(listen_fd, (struct sockaddr *) &addr, sizeof(addr));
+  rtems_test_assert(rv == 0);
+
+  rv = listen(listen_fd, 1);
+  rtems_test_assert(rv == 0);
+
+  *client_fd = socket(AF_INET, SOCK_STREAM, 0);
+  rtems_test_assert(*client_fd >= 0);
+
+  rv = connect(*client_fd, (struct sockaddr *) &addr, sizeof(addr));
+  rtems_test_assert(rv == 0);
+
+  *server_fd = accept(listen_fd, (struct sockaddr *) &addr, &addr_len);
+  rtems_test_assert(*server_fd >= 0);
+
+  rv = close(listen_fd);
+  rtems_test_assert(rv == 0);
+}
+
+/*
+ * The error and hangup conditions are reported even if they are not
+ * requested.
+ */
+static void test_reset_peer(void)
+{
+  struct linger linger;
+  struct pollfd pfd;
+  int client_fd;
+  int server_fd;
+  int rv;
+  int n;
+
+  connect_tcp_sockets(&client_fd, &server_fd);
+
+  pfd.fd = client_fd;
+  pfd.events = 0;
+
+  n = poll(&pfd, 1, 0);
+  rtems_test_assert(n == 0);
+  rtems_test_assert(pfd.revents == 0);
+
+  /*
+   * A close with a zero linger time sends a reset to the peer.
+   */
+  linger.l_onoff = 1;
+  linger.l_linger = 0;
+  rv = setsockopt(server_fd, SOL_SOCKET, SO_LINGER, &linger, sizeof(linger));
+  rtems_test_assert(rv == 0);
+
+  rv = close(server_fd);
+  rtems_test_assert(rv == 0);
+
+  n = poll(&pfd, 1, HANGUP_TIMEOUT_MS);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(pfd.revents == (POLLERR | POLLHUP));
+
+  rv = close(client_fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_shutdown_peer(void)
+{
+  struct pollfd pfd;
+  int client_fd;
+  int server_fd;
+  int rv;
+  int n;
+
+  connect_tcp_sockets(&client_fd, &server_fd);
+
+  rv = shutdown(server_fd, SHUT_WR);
+  rtems_test_assert(rv == 0);
+
+  pfd.fd = client_fd;
+  pfd.events = 0;
+
+  n = poll(&pfd, 1, HANGUP_TIMEOUT_MS);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(pfd.revents == POLLHUP);
+
+  pfd.events = POLLIN;
+
+  n = poll(&pfd, 1, 0);
+  rtems_test_assert(n == 1);
+  rtems_test_assert(pfd.revents == (POLLIN | POLLHUP));
+
+  rv = close(client_fd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(server_fd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test(void)
+{
+  struct sockaddr_in addr_a;
+  struct sockaddr_in addr_b;
+  int fd_a;
+  int fd_b;
+  int rv;
+
+  fd_a = open_udp_socket(&addr_a, PORT_A);
+  fd_b = open_udp_socket(&addr_b, PORT_B);
+
+  test_poll(fd_a, fd_b, &addr_b);
+  test_evq(fd_a, fd_b, &addr_b);
+
+  rv = close(fd_b);
+  rtems_test_assert(rv == 0);
+
+  test_reset_peer();
+  test_shutdown_peer();
+}
+
+static void Init(rtems_task_argument arg)
+{
+  int rv;
+
+  puts("\n\n*** TEST POLL 1 ***");
+
+  rv = rtems_bsdnet_initialize_network();
+  rtems_test_assert(rv == 0);
+
+  test();
+
+  puts("*** END OF TEST POLL 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 8
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_SEMAPHORES 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,312 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+/*
+ * The external storage test acts like a network driver and needs the kernel
+ * definitions of the mbuf functions.
+ */
+#define __INSIDE_RTEMS_BSD_TCPIP_STACK__
+
+#include <rtems/rtems_bsdnet.h>
+#include <rtems/rtems_bsdnet_internal.h>
+#include <sys/mbuf.h>
+
+/* forward declarations to avoid warnings */
+static rtems_task Init(rtems_task_argument argument);
+
+struct rtems_bsdnet_config rtems_bsdnet_config;
+
+#define PORT_A 1234
+
+#define PORT_B 1235
+
+#define FIRST_SIZE 1000
+
+#define SECOND_SIZE 10
+
+#define TOTAL_SIZE (FIRST_SIZE + SECOND_SIZE)
+
+#define EXT_COUNT 2
+
+#define EXT_SIZE 64
+
+static char ext_bufs[EXT_COUNT][EXT_SIZE];
+
+static int ext_refs[EXT_COUNT];
+
+static int ext_frees[EXT_COUNT];
+
+static int open_udp_socket(struct sockaddr_in *addr, uint16_t port)
+{
+  int rv;
+  int fd;
+
+  memset(addr, 0, sizeof(*addr));
+  addr->sin_len = sizeof(*addr);
+  addr->sin_family = AF_INET;
+  addr->sin_port = htons(port);
+  addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  fd = socket(AF_INET, SOCK_DGRAM, 0);
+  rtems_test_assert(fd >= 0);
+
+  rv = bind(fd, (struct sockaddr *) addr, sizeof(*addr));
+  rtems_test_assert(rv == 0);
+
+  return fd;
+}
+
+static void fill(struct mbuf *m, size_t size, char c)
+{
+  memset(mtod(m, char *), c, size);
+  m->m_len = (int) size;
+}
+
+static int ext_index(caddr_t buf, u_int size)
+{
+  int i;
+
+  rtems_test_assert(size == EXT_SIZE);
+
+  for (i = 0; i < EXT_COUNT; ++i) {
+    if (buf == ext_bufs[i]) {
+      return i;
+    }
+  }
+
+  rtems_test_assert(0);
+
+  return -1;
+}
+
+static void ext_free(caddr_t buf, u_int size)
+{
+  ++ext_frees[ext_index(buf, size)];
+}
+
+static void ext_ref(caddr_t buf, u_int size)
+{
+  ++ext_refs[ext_index(buf, size)];
+}
+
+static struct mbuf *ext_alloc(int i)
+{
+  struct mbuf *m;
+
+  m = rtems_bsdnet_mbuf_alloc(0);
+  rtems_test_assert(m != NULL);
+  rtems_test_assert((m->m_flags & M_EXT) == 0);
+
+  memset(ext_bufs[i], 'c' + i, EXT_SIZE);
+  MEXTADD(m, ext_bufs[i], EXT_SIZE, ext_free, ext_ref);
+  m->m_len = EXT_SIZE;
+
+  return m;
+}
+
+static void test_external_storage(void)
+{
+  struct mbuf *m;
+  struct mbuf *copy;
+  struct mbuf *n;
+  struct mbuf *o;
+  int i;
+
+  m = ext_alloc(0);
+  m->m_next = ext_alloc(1);
+  m->m_pkthdr.len = EXT_COUNT * EXT_SIZE;
+
+  /*
+   * The copy must share the external storage of each mbuf and announce this
+   * with the reference routine instead of the cluster reference count.
+   */
+  rtems_bsdnet_semaphore_obtain();
+  copy = m_copypacket(m, M_WAIT);
+  rtems_bsdnet_semaphore_release();
+  rtems_test_assert(copy != NULL);
+  rtems_test_assert(copy->m_pkthdr.len == EXT_COUNT * EXT_SIZE);
+
+  i = 0;
+  for (n = m, o = copy; n != NULL; n = n->m_next, o = o->m_next, ++i) {
+    rtems_test_assert(o != NULL);
+    rtems_test_assert((o->m_flags & M_EXT) != 0);
+    rtems_test_assert(o->m_data == n->m_data);
+    rtems_test_assert(o->m_len == EXT_SIZE);
+    rtems_test_assert(o->m_ext.ext_buf == ext_bufs[i]);
+    rtems_test_assert(o->m_ext.ext_free == ext_free);
+    rtems_test_assert(o->m_ext.ext_ref == ext_ref);
+    rtems_test_assert(ext_refs[i] == 1);
+    rtems_test_assert(ext_frees[i] == 0);
+  }
+  rtems_test_assert(o == NULL);
+  rtems_test_assert(i == EXT_COUNT);
+
+  rtems_bsdnet_mbuf_free(m);
+
+  for (i = 0; i < EXT_COUNT; ++i) {
+    rtems_test_assert(ext_refs[i] == 1);
+    rtems_test_assert(ext_frees[i] == 1);
+  }
+
+  rtems_bsdnet_mbuf_free(copy);
+
+  /*
+   * The attach and each reference must be released exactly once.
+   */
+  for (i = 0; i < EXT_COUNT; ++i) {
+    rtems_test_assert(ext_frees[i] == ext_refs[i] + 1);
+  }
+}
+
+static void test_send_receive(
+  int fd_a,
+  int fd_b,
+  const struct sockaddr_in *addr_a,
+  const struct sockaddr_in *addr_b
+)
+{
+  struct sockaddr_in from;
+  int from_len = sizeof(from);
+  struct mbuf *m;
+  struct mbuf *n;
+  ssize_t rv;
+  size_t i;
+
+  m = rtems_bsdnet_mbuf_alloc(MCLBYTES + 1);
+  rtems_test_assert(m == NULL);
+  rtems_test_assert(errno == EINVAL);
+
+  m = rtems_bsdnet_mbuf_alloc(FIRST_SIZE);
+  rtems_test_assert(m != NULL);
+  rtems_test_assert((m->m_flags & M_EXT) != 0);
+  fill(m, FIRST_SIZE, 'a');
+
+  n = rtems_bsdnet_mbuf_alloc(SECOND_SIZE);
+  rtems_test_assert(n != NULL);
+  rtems_test_assert((n->m_flags & M_EXT) == 0);
+  fill(n, SECOND_SIZE, 'b');
+  m->m_next = n;
+
+  rv = rtems_bsdnet_sendto_mbuf(
+    fd_a,
+    m,
+    0,
+    (const struct sockaddr *) addr_b,
+    sizeof(*addr_b)
+  );
+  rtems_test_assert(rv == TOTAL_SIZE);
+
+  rv = rtems_bsdnet_recvfrom_mbuf(
+    fd_b,
+    &m,
+    TOTAL_SIZE,
+    0,
+    (struct sockaddr *) &from,
+    &from_len
+  );
+  rtems_test_assert(rv == TOTAL_SIZE);
+  rtems_test_assert(from_len == sizeof(from));
+  rtems_test_assert(from.sin_port == addr_a->sin_port);
+
+  i = 0;
+  for (n = m; n != NULL; n = n->m_next) {
+    const char *data = mtod(n, const char *);
+    int j;
+
+    for (j = 0; j < n->m_len; ++j, ++i) {
+      rtems_test_assert(data [j] == (i < FIRST_SIZE ? 'a' : 'b'));
+    }
+  }
+  rtems_test_assert(i == TOTAL_SIZE);
+
+  rtems_bsdnet_mbuf_free(m);
+
+  rv = rtems_bsdnet_recvfrom_mbuf(fd_b, &m, TOTAL_SIZE, MSG_PEEK, NULL, NULL);
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EINVAL);
+  rtems_test_assert(m == NULL);
+
+  rv = rtems_bsdnet_recvfrom_mbuf(
+    fd_b,
+    &m,
+    TOTAL_SIZE,
+    MSG_DONTWAIT,
+    NULL,
+    NULL
+  );
+  rtems_test_assert(rv == -1);
+  rtems_test_assert(errno == EWOULDBLOCK);
+  rtems_test_assert(m == NULL);
+}
+
+static void test(void)
+{
+  struct sockaddr_in addr_a;
+  struct sockaddr_in addr_b;
+  int fd_a;
+  int fd_b;
+  int rv;
+
+  test_external_storage();
+
+  fd_a = open_udp_socket(&addr_a, PORT_A);
+  fd_b = open_udp_socket(&addr_b, PORT_B);
+
+  test_send_receive(fd_a, fd_b, &addr_a, &addr_b);
+
+  rv = close(fd_a);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd_b);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  int rv;
+
+  puts("\n\n*** TEST ZEROCOPY 1 ***");
+
+  rv = rtems_bsdnet_initialize_network();
+  rtems_test_assert(rv == 0);
+
+  test();
+
+  puts("*** END OF TEST ZEROCOPY 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_USE_IMFS_AS_BASE_FILESYSTEM
+
+#define CONFIGURE_LIBIO_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_SEMAPHORES 2
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,112 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <pmacros.h>
+#include <errno.h>
+#include <limits.h>
+#include <tmacros.h>
+
+#include <fcntl.h>           /* For O_* constants */
+#include <sys/stat.h>        /* For mode constants */
+#include <mqueue.h>
+
+#define MESSAGE_COUNT 200
+
+typedef struct {
+  unsigned int priority;
+  int          sequence;
+} message;
+
+/* forward declarations to avoid warnings */
+void *POSIX_Init(void *argument);
+
+static unsigned int priority_of( int i )
+{
+  return (unsigned int) ( ( i * 7 ) % MQ_PRIO_MAX );
+}
+
+void *POSIX_Init(
+  void *argument
+)
+{
+  struct mq_attr attr;
+  mqd_t          queue;
+  message        msg;
+  unsigned int   priority;
+  unsigned int   last_priority;
+  int            last_sequence;
+  ssize_t        n;
+  int            sc;
+  int            i;
+
+  puts( "\n\n*** POSIX MESSAGE QUEUE TEST 5 ***" );
+
+  attr.mq_maxmsg = MESSAGE_COUNT;
+  attr.mq_msgsize = sizeof( msg );
+
+  queue = mq_open( "Queue", O_CREAT | O_RDWR, 0x777, &attr );
+  rtems_test_assert( queue != (-1) );
+
+  for ( i = 0 ; i < MESSAGE_COUNT ; i++ ) {
+    msg.priority = priority_of( i );
+    msg.sequence = i;
+
+    sc = mq_send( queue, (const char *) &msg, sizeof( msg ), msg.priority );
+    rtems_test_assert( sc == 0 );
+  }
+
+  last_priority = MQ_PRIO_MAX;
+  last_sequence = -1;
+
+  for ( i = 0 ; i < MESSAGE_COUNT ; i++ ) {
+    n = mq_receive( queue, (char *) &msg, sizeof( msg ), &priority );
+    rtems_test_assert( n == (ssize_t) sizeof( msg ) );
+    rtems_test_assert( priority == msg.priority );
+    rtems_test_assert( priority <= last_priority );
+
+    if ( priority == last_priority ) {
+      rtems_test_assert( msg.sequence > last_sequence );
+    }
+
+    last_priority = priority;
+    last_sequence = msg.sequence;
+  }
+
+  sc = mq_close( queue );
+  rtems_test_assert( sc == 0 );
+
+  sc = mq_unlink( "Queue" );
+  rtems_test_assert( sc == 0 );
+
+  puts( "*** END OF POSIX MESSAGE QUEUE TEST 5 ***" );
+  rtems_test_exit( 0 );
+
+  return NULL; /* just so the compiler thinks we returned something */
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+    CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(MESSAGE_COUNT, sizeof(message))
+
+#define CONFIGURE_MAXIMUM_POSIX_THREADS                   1
+#define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES            1
+#define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUE_DESCRIPTORS 1
+
+#define CONFIGURE_POSIX_INIT_THREAD_TABLE
+
+#define CONFIGURE_INIT
+#include <rtems/confdefs.h>
@@ -0,0 +1,228 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include "tmacros.h"
+
+#define PROCESSOR_COUNT 2
+
+#define TASK_PRIORITY 2
+
+#define TASK_DONE RTEMS_EVENT_0
+
+#if defined(__RTEMS_HAVE_SYS_CPUSET_H__)
+
+typedef struct {
+  rtems_id master_id;
+  uint32_t cpu_index[2];
+} test_context;
+
+static test_context test_instance;
+
+static void set_single_processor(cpu_set_t *cpuset, uint32_t cpu_index)
+{
+  CPU_ZERO(cpuset);
+  CPU_SET((int) cpu_index, cpuset);
+}
+
+static uint32_t count_processors(const cpu_set_t *cpuset)
+{
+  uint32_t count = 0;
+  int cpu_index;
+
+  for (cpu_index = 0; cpu_index < CPU_SETSIZE; ++cpu_index) {
+    if (CPU_ISSET(cpu_index, cpuset)) {
+      ++count;
+    }
+  }
+
+  return count;
+}
+
+static void task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+
+  ctx->cpu_index[0] = rtems_smp_get_current_processor();
+
+  sc = rtems_event_send(ctx->master_id, TASK_DONE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  set_single_processor(&cpuset, 0);
+  sc = rtems_task_set_affinity(RTEMS_SELF, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* The clock tick moves us to the processor of our new affinity set */
+  while (rtems_smp_get_current_processor() != 0) {
+    /* Wait */
+  }
+
+  ctx->cpu_index[1] = rtems_smp_get_current_processor();
+
+  sc = rtems_event_send(ctx->master_id, TASK_DONE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_status_codes(void)
+{
+  uint32_t cpu_count = rtems_smp_get_processor_count();
+  uint32_t cpu_index;
+  rtems_status_code sc;
+  cpu_set_t cpuset;
+
+  sc = rtems_task_get_affinity(RTEMS_SELF, sizeof(cpuset), NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_task_get_affinity(RTEMS_SELF, 0, &cpuset);
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_task_get_affinity(0, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_task_get_affinity(RTEMS_SELF, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  for (cpu_index = 0; cpu_index < cpu_count; ++cpu_index) {
+    rtems_test_assert(CPU_ISSET((int) cpu_index, &cpuset));
+  }
+
+  rtems_test_assert(count_processors(&cpuset) == cpu_count);
+
+  sc = rtems_task_set_affinity(RTEMS_SELF, sizeof(cpuset), NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_task_set_affinity(0, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_task_set_affinity(RTEMS_SELF, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  CPU_ZERO(&cpuset);
+  sc = rtems_task_set_affinity(RTEMS_SELF, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+}
+
+static void test_task_with_affinity(test_context *ctx)
+{
+  uint32_t other_cpu = rtems_smp_get_processor_count() - 1;
+  rtems_status_code sc;
+  rtems_event_set events;
+  rtems_id task_id;
+  cpu_set_t cpuset;
+
+  ctx->master_id = rtems_task_self();
+
+  sc = rtems_task_create(
+    rtems_build_name('T', 'A', 'S', 'K'),
+    TASK_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &task_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  set_single_processor(&cpuset, other_cpu);
+  sc = rtems_task_set_affinity(task_id, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  CPU_ZERO(&cpuset);
+  sc = rtems_task_get_affinity(task_id, sizeof(cpuset), &cpuset);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(CPU_ISSET((int) other_cpu, &cpuset));
+  rtems_test_assert(count_processors(&cpuset) == 1);
+
+  sc = rtems_task_start(task_id, task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_receive(
+    TASK_DONE,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(ctx->cpu_index[0] == other_cpu);
+
+  sc = rtems_event_receive(
+    TASK_DONE,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(ctx->cpu_index[1] == 0);
+
+  sc = rtems_task_delete(task_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+
+  test_status_codes();
+
+  if (rtems_smp_get_processor_count() >= PROCESSOR_COUNT) {
+    test_task_with_affinity(ctx);
+  }
+}
+
+#else /* defined(__RTEMS_HAVE_SYS_CPUSET_H__) */
+
+static void test(void)
+{
+  /* Nothing to do, the processor affinity API is not available */
+}
+
+#endif /* defined(__RTEMS_HAVE_SYS_CPUSET_H__) */
+
+static void Init(rtems_task_argument arg)
+{
+  puts("\n\n*** TEST SMPAFFINITY 1 ***");
+
+  test();
+
+  puts("*** END OF TEST SMPAFFINITY 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS PROCESSOR_COUNT
+
+#define CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -71,7 +71,7 @@ static void _SMP_barrier_Wait(
 
 #define WORKER_PRIORITY 2
 
-#define CPU_COUNT 32
+#define PROCESSOR_COUNT 32
 
 typedef struct {
   Atomic_Ulong stop;
@@ -79,7 +79,7 @@ typedef struct {
   size_t worker_count;
   rtems_id stop_worker_timer_id;
   Atomic_Ulong atomic_value;
-  unsigned long per_worker_value[CPU_COUNT];
+  unsigned long per_worker_value[PROCESSOR_COUNT];
   unsigned long normal_value;
   Atomic_Flag global_flag;
 } test_context;
@@ -470,9 +470,9 @@ static void Init(rtems_task_argument arg)
 
 #define CONFIGURE_SMP_APPLICATION
 
-#define CONFIGURE_SMP_MAXIMUM_PROCESSORS CPU_COUNT
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS PROCESSOR_COUNT
 
-#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+#define CONFIGURE_MAXIMUM_TASKS PROCESSOR_COUNT
 
 #define CONFIGURE_MAXIMUM_TIMERS 1
 
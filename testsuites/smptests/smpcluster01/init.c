@@ -0,0 +1,329 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include "tmacros.h"
+
+#define PROCESSOR_COUNT 2
+
+#define CLUSTER_COUNT 2
+
+#define TASK_PRIORITY 1
+
+#define WORKER_PRIORITY 2
+
+#define HELPER_PRIORITY 3
+
+#define TASK_DONE RTEMS_EVENT_0
+
+#define WORKER_WAKE RTEMS_EVENT_1
+
+#define WORKER_DONE RTEMS_EVENT_2
+
+#define HELPER_DONE RTEMS_EVENT_3
+
+typedef struct {
+  rtems_id master_id;
+  uint32_t cpu_index;
+  uint32_t cluster;
+  rtems_id worker_id;
+  volatile bool stop;
+  uint32_t worker_wakeups;
+} test_context;
+
+static test_context test_instance;
+
+static void task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+  rtems_status_code sc;
+
+  ctx->cpu_index = rtems_smp_get_current_processor();
+
+  sc = rtems_task_get_scheduler_cluster(RTEMS_SELF, &ctx->cluster);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_send(ctx->master_id, TASK_DONE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_status_codes(void)
+{
+  rtems_status_code sc;
+  uint32_t cluster;
+
+  sc = rtems_task_get_scheduler_cluster(RTEMS_SELF, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_task_get_scheduler_cluster(0, &cluster);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_task_get_scheduler_cluster(RTEMS_SELF, &cluster);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(cluster == 0);
+
+  sc = rtems_task_set_scheduler_cluster(RTEMS_SELF, CLUSTER_COUNT);
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_task_set_scheduler_cluster(0, 0);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_task_set_scheduler_cluster(RTEMS_SELF, 0);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_set_scheduler_cluster(RTEMS_SELF, 1);
+  rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+}
+
+static void test_task_in_other_cluster(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_event_set events;
+  rtems_id task_id;
+  uint32_t cluster;
+
+  ctx->master_id = rtems_task_self();
+
+  sc = rtems_task_create(
+    rtems_build_name('T', 'A', 'S', 'K'),
+    TASK_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &task_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_get_scheduler_cluster(task_id, &cluster);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(cluster == 0);
+
+  sc = rtems_task_set_scheduler_cluster(task_id, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_get_scheduler_cluster(task_id, &cluster);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(cluster == 1);
+
+  sc = rtems_task_start(task_id, task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_receive(
+    TASK_DONE,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(ctx->cpu_index == 1);
+  rtems_test_assert(ctx->cluster == 1);
+
+  sc = rtems_task_delete(task_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+/*
+ * The worker checks on each wake up that it executes on the processor of its
+ * cluster.  Cluster zero contains processor zero and cluster one contains
+ * processor one.
+ */
+static void worker_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+    rtems_event_set events;
+    uint32_t cluster;
+
+    sc = rtems_event_receive(
+      WORKER_WAKE,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_get_scheduler_cluster(RTEMS_SELF, &cluster);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    rtems_test_assert(rtems_smp_get_current_processor() == cluster);
+
+    ++ctx->worker_wakeups;
+
+    if (ctx->stop) {
+      sc = rtems_event_send(ctx->master_id, WORKER_DONE);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+      sc = rtems_task_suspend(RTEMS_SELF);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+  }
+}
+
+/*
+ * The helper executes on processor one and wakes up the worker as often as
+ * possible, so the worker is frequently scheduled and dispatched while the
+ * master tries to move it to the other cluster.
+ */
+static void helper_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+  rtems_status_code sc;
+
+  while (!ctx->stop) {
+    sc = rtems_event_send(ctx->worker_id, WORKER_WAKE);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_event_send(ctx->worker_id, WORKER_WAKE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_event_send(ctx->master_id, HELPER_DONE);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_move_while_dispatched(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_event_set events;
+  rtems_id helper_id;
+  rtems_interval start;
+  uint32_t move_count = 0;
+
+  ctx->master_id = rtems_task_self();
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    WORKER_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_set_scheduler_cluster(ctx->worker_id, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(ctx->worker_id, worker_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_create(
+    rtems_build_name('H', 'E', 'L', 'P'),
+    HELPER_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &helper_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_set_scheduler_cluster(helper_id, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_start(helper_id, helper_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /*
+   * The master has the highest priority, so in cluster zero the worker waits
+   * for a processor as long as the master executes and a move must succeed.
+   * In cluster one the worker is scheduled and dispatched concurrently to the
+   * move attempts, so these may fail with RTEMS_RESOURCE_IN_USE.
+   */
+  start = rtems_clock_get_ticks_since_boot();
+  while (rtems_clock_get_ticks_since_boot() - start
+      < rtems_clock_get_ticks_per_second()) {
+    uint32_t cluster;
+
+    sc = rtems_task_get_scheduler_cluster(ctx->worker_id, &cluster);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_set_scheduler_cluster(ctx->worker_id, 1 - cluster);
+    if (sc == RTEMS_SUCCESSFUL) {
+      ++move_count;
+    } else {
+      rtems_test_assert(sc == RTEMS_RESOURCE_IN_USE);
+      rtems_test_assert(cluster == 1);
+    }
+  }
+
+  ctx->stop = true;
+
+  sc = rtems_event_receive(
+    WORKER_DONE | HELPER_DONE,
+    RTEMS_EVENT_ALL | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(move_count > 0);
+  rtems_test_assert(ctx->worker_wakeups > 0);
+
+  sc = rtems_task_delete(ctx->worker_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_delete(helper_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  puts("\n\n*** TEST SMPCLUSTER 1 ***");
+
+  rtems_test_assert(rtems_smp_get_current_processor() == 0);
+
+  test_status_codes();
+
+  if (rtems_smp_get_processor_count() >= PROCESSOR_COUNT) {
+    test_task_in_other_cluster(ctx);
+    test_move_while_dispatched(ctx);
+  }
+
+  puts("*** END OF TEST SMPCLUSTER 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS PROCESSOR_COUNT
+
+#define CONFIGURE_SMP_SCHEDULER_CLUSTER_COUNT CLUSTER_COUNT
+
+#define CONFIGURE_SMP_SCHEDULER_CLUSTER_OF_PROCESSOR { 0, 1 }
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,244 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/score/smpjob.h>
+
+#include "tmacros.h"
+
+#define PROCESSOR_COUNT 2
+
+#define CALL_COUNT 10000
+
+#define BATCH_COUNT 1000
+
+typedef enum {
+  BLOCKER_IDLE,
+  BLOCKER_RUNNING,
+  BLOCKER_RELEASED
+} blocker_state;
+
+typedef struct {
+  Atomic_Ulong counter;
+  Atomic_Ulong blocker;
+  Per_CPU_Control *other_cpu;
+} test_context;
+
+static test_context test_instance;
+
+static void job(void *arg)
+{
+  test_context *ctx = arg;
+
+  _Atomic_Fetch_add_ulong(&ctx->counter, 1, ATOMIC_ORDER_RELEASE);
+}
+
+/*
+ * The job queue of a processor is not drained while this job runs on it.
+ */
+static void blocker_job(void *arg)
+{
+  test_context *ctx = arg;
+
+  _Atomic_Store_ulong(&ctx->blocker, BLOCKER_RUNNING, ATOMIC_ORDER_RELEASE);
+
+  while (
+    _Atomic_Load_ulong(&ctx->blocker, ATOMIC_ORDER_ACQUIRE) != BLOCKER_RELEASED
+  ) {
+    /* Wait */
+  }
+}
+
+static void wait_for_blocker(test_context *ctx, blocker_state desired_state)
+{
+  while (
+    _Atomic_Load_ulong(&ctx->blocker, ATOMIC_ORDER_ACQUIRE) != desired_state
+  ) {
+    /* Wait */
+  }
+}
+
+static void wait_for_counter(test_context *ctx, unsigned long desired_value)
+{
+  while (
+    _Atomic_Load_ulong(&ctx->counter, ATOMIC_ORDER_ACQUIRE) != desired_value
+  ) {
+    /* Wait */
+  }
+}
+
+static void reset_counter(test_context *ctx)
+{
+  _Atomic_Store_ulong(&ctx->counter, 0, ATOMIC_ORDER_RELAXED);
+}
+
+static uint64_t get_uptime_in_nanoseconds(void)
+{
+  rtems_status_code sc;
+  struct timespec uptime;
+
+  sc = rtems_clock_get_uptime(&uptime);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return (uint64_t) uptime.tv_sec * 1000000000 + (uint64_t) uptime.tv_nsec;
+}
+
+static void test_queue_full(test_context *ctx)
+{
+  int i;
+  bool ok;
+
+  reset_counter(ctx);
+
+  /*
+   * Keep the other processor busy with a job, otherwise an inter-processor
+   * interrupt for some other reason may drain the queue while it is filled.
+   * The slot of a job is free again once the job runs.
+   */
+  _Atomic_Store_ulong(&ctx->blocker, BLOCKER_IDLE, ATOMIC_ORDER_RELAXED);
+  ok = _SMP_Job_submit(ctx->other_cpu, blocker_job, ctx);
+  rtems_test_assert(ok);
+  wait_for_blocker(ctx, BLOCKER_RUNNING);
+
+  for (i = 0; i < SMP_JOB_QUEUE_SIZE; ++i) {
+    ok = _SMP_Job_post(ctx->other_cpu, job, ctx);
+    rtems_test_assert(ok);
+  }
+
+  ok = _SMP_Job_post(ctx->other_cpu, job, ctx);
+  rtems_test_assert(!ok);
+
+  rtems_test_assert(
+    _Atomic_Load_ulong(&ctx->counter, ATOMIC_ORDER_ACQUIRE) == 0
+  );
+
+  /*
+   * The other processor drains the queue after the blocker job returns.
+   */
+  _Atomic_Store_ulong(&ctx->blocker, BLOCKER_RELEASED, ATOMIC_ORDER_RELEASE);
+  _SMP_Job_notify(ctx->other_cpu);
+  wait_for_counter(ctx, SMP_JOB_QUEUE_SIZE);
+}
+
+static void test_round_trip(test_context *ctx)
+{
+  uint64_t begin;
+  uint64_t end;
+  int i;
+
+  puts("remote function call round trip");
+
+  begin = get_uptime_in_nanoseconds();
+
+  for (i = 0; i < CALL_COUNT; ++i) {
+    bool ok;
+
+    reset_counter(ctx);
+
+    ok = _SMP_Job_submit(ctx->other_cpu, job, ctx);
+    rtems_test_assert(ok);
+
+    wait_for_counter(ctx, 1);
+  }
+
+  end = get_uptime_in_nanoseconds();
+
+  printf(
+    "\tcalls %i, average round trip %" PRIu64 "ns\n",
+    CALL_COUNT,
+    (end - begin) / CALL_COUNT
+  );
+}
+
+static void test_batch(test_context *ctx)
+{
+  uint64_t begin;
+  uint64_t end;
+  int i;
+
+  printf("batch of %i remote function calls\n", SMP_JOB_QUEUE_SIZE);
+
+  begin = get_uptime_in_nanoseconds();
+
+  for (i = 0; i < BATCH_COUNT; ++i) {
+    int j;
+
+    reset_counter(ctx);
+
+    for (j = 0; j < SMP_JOB_QUEUE_SIZE; ++j) {
+      bool ok = _SMP_Job_post(ctx->other_cpu, job, ctx);
+      rtems_test_assert(ok);
+    }
+
+    _SMP_Job_notify(ctx->other_cpu);
+    wait_for_counter(ctx, SMP_JOB_QUEUE_SIZE);
+  }
+
+  end = get_uptime_in_nanoseconds();
+
+  printf(
+    "\tbatches %i, average batch %" PRIu64 "ns, average call %" PRIu64 "ns\n",
+    BATCH_COUNT,
+    (end - begin) / BATCH_COUNT,
+    (end - begin) / (BATCH_COUNT * SMP_JOB_QUEUE_SIZE)
+  );
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  uint32_t cpu_count = rtems_smp_get_processor_count();
+  uint32_t cpu_self = rtems_smp_get_current_processor();
+
+  if (cpu_count < PROCESSOR_COUNT) {
+    printf(
+      "test needs at least %i processors, skipped\n",
+      PROCESSOR_COUNT
+    );
+    return;
+  }
+
+  _Atomic_Init_ulong(&ctx->counter, 0);
+  _Atomic_Init_ulong(&ctx->blocker, BLOCKER_IDLE);
+  ctx->other_cpu = _Per_CPU_Get_by_index((cpu_self + 1) % cpu_count);
+
+  test_queue_full(ctx);
+  test_round_trip(ctx);
+  test_batch(ctx);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  puts("\n\n*** TEST SMPJOB 1 ***");
+
+  test();
+
+  puts("*** END OF TEST SMPJOB 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS PROCESSOR_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -81,7 +81,7 @@ static void barrier_wait(
 
 #define TASK_PRIORITY 1
 
-#define CPU_COUNT 32
+#define PROCESSOR_COUNT 32
 
 #define TEST_COUNT 5
 
@@ -97,7 +97,7 @@ typedef struct {
   rtems_id timer_id;
   rtems_interval timeout;
   unsigned long counter[TEST_COUNT];
-  unsigned long test_counter[TEST_COUNT][CPU_COUNT];
+  unsigned long test_counter[TEST_COUNT][PROCESSOR_COUNT];
   SMP_lock_Control lock;
 } global_context;
 
@@ -386,9 +386,9 @@ static void Init(rtems_task_argument arg)
 
 #define CONFIGURE_SMP_APPLICATION
 
-#define CONFIGURE_SMP_MAXIMUM_PROCESSORS CPU_COUNT
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS PROCESSOR_COUNT
 
-#define CONFIGURE_MAXIMUM_TASKS CPU_COUNT
+#define CONFIGURE_MAXIMUM_TASKS PROCESSOR_COUNT
 
 #define CONFIGURE_MAXIMUM_SEMAPHORES 1
 
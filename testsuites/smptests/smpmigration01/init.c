@@ -21,9 +21,9 @@
 #include <stdio.h>
 #include <inttypes.h>
 
-#define CPU_COUNT 2
+#define PROCESSOR_COUNT 2
 
-#define RUNNER_COUNT (CPU_COUNT + 1)
+#define RUNNER_COUNT (PROCESSOR_COUNT + 1)
 
 #define PRIO_STOP 2
 
@@ -39,8 +39,8 @@ typedef struct {
 } cache_aligned_counter;
 
 typedef struct {
-  cache_aligned_counter tokens_per_cpu[CPU_COUNT];
-  volatile cache_aligned_counter cycles_per_cpu[CPU_COUNT];
+  cache_aligned_counter tokens_per_cpu[PROCESSOR_COUNT];
+  volatile cache_aligned_counter cycles_per_cpu[PROCESSOR_COUNT];
 } test_counters;
 
 typedef struct {
@@ -74,7 +74,7 @@ static void runner(rtems_task_argument self)
     ++counters->cycles_per_cpu[current_cpu].counter;
 
     if (ctx->token == self) {
-      uint32_t other_cpu = (current_cpu + 1) % CPU_COUNT;
+      uint32_t other_cpu = (current_cpu + 1) % PROCESSOR_COUNT;
       uint32_t snapshot;
 
       ++counters->tokens_per_cpu[current_cpu].counter;
@@ -150,7 +150,7 @@ static void test(void)
 
     printf("runner %" PRIuPTR "\n", runner_index);
 
-    for (cpu = 0; cpu < CPU_COUNT; ++cpu) {
+    for (cpu = 0; cpu < PROCESSOR_COUNT; ++cpu) {
       printf(
         "\tcpu %zu tokens %" PRIu32 "\n"
         "\tcpu %zu cycles %" PRIu32 "\n",
@@ -168,7 +168,7 @@ static void test(void)
     test_counters *counters = &ctx->counters[runner_index];
     size_t cpu;
 
-    for (cpu = 0; cpu < CPU_COUNT; ++cpu) {
+    for (cpu = 0; cpu < PROCESSOR_COUNT; ++cpu) {
       uint32_t tokens = counters->tokens_per_cpu[cpu].counter;
       uint32_t delta = tokens > expected_tokens ?
         tokens - expected_tokens : expected_tokens - tokens;
@@ -179,7 +179,7 @@ static void test(void)
     }
   }
 
-  rtems_test_assert(total_delta <= (RUNNER_COUNT * CPU_COUNT - 1));
+  rtems_test_assert(total_delta <= (RUNNER_COUNT * PROCESSOR_COUNT - 1));
 }
 
 static void Init(rtems_task_argument arg)
@@ -200,7 +200,7 @@ static void Init(rtems_task_argument arg)
 
 #define CONFIGURE_SMP_APPLICATION
 
-#define CONFIGURE_SMP_MAXIMUM_PROCESSORS CPU_COUNT
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS PROCESSOR_COUNT
 
 #define CONFIGURE_MAXIMUM_TASKS (2 + RUNNER_COUNT)
 
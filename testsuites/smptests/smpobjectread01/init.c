@@ -0,0 +1,284 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/score/atomic.h>
+
+#include "tmacros.h"
+
+#define PROCESSOR_COUNT 32
+
+#define TASK_PRIORITY 1
+
+#define OBJECT_UNIT 2
+
+#define OBJECT_COUNT (4 * OBJECT_UNIT)
+
+#define MESSAGE_COUNT 3
+
+#define NOTEPAD 7
+
+#define NOTE_VALUE 0x12345678
+
+typedef struct {
+  Atomic_Ulong stop;
+  Atomic_Ulong done;
+  Atomic_Ulong queue_ids[OBJECT_COUNT];
+  Atomic_Ulong task_ids[OBJECT_COUNT];
+  Atomic_Ulong reads;
+} test_context;
+
+static test_context test_instance;
+
+static rtems_id load_id(Atomic_Ulong *id)
+{
+  return (rtems_id) _Atomic_Load_ulong(id, ATOMIC_ORDER_ACQUIRE);
+}
+
+static void store_id(Atomic_Ulong *id, rtems_id value)
+{
+  _Atomic_Store_ulong(id, value, ATOMIC_ORDER_RELEASE);
+}
+
+static bool is_stopped(test_context *ctx)
+{
+  return _Atomic_Load_ulong(&ctx->stop, ATOMIC_ORDER_ACQUIRE) != 0;
+}
+
+static void read_queue(rtems_id id)
+{
+  rtems_status_code sc;
+  uint32_t count;
+
+  sc = rtems_message_queue_get_number_pending(id, &count);
+  if (sc == RTEMS_SUCCESSFUL) {
+    rtems_test_assert(count <= MESSAGE_COUNT);
+  } else {
+    rtems_test_assert(sc == RTEMS_INVALID_ID);
+  }
+}
+
+static void read_task(rtems_id id)
+{
+  rtems_status_code sc;
+  uint32_t note;
+
+  sc = rtems_task_get_note(id, NOTEPAD, &note);
+  if (sc == RTEMS_SUCCESSFUL) {
+    rtems_test_assert(note == 0 || note == NOTE_VALUE);
+  } else {
+    rtems_test_assert(sc == RTEMS_INVALID_ID);
+  }
+}
+
+static void reader_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+  unsigned long reads = 0;
+  rtems_status_code sc;
+
+  while (!is_stopped(ctx)) {
+    int i;
+
+    for (i = 0; i < OBJECT_COUNT; ++i) {
+      rtems_id id;
+
+      id = load_id(&ctx->queue_ids[i]);
+      if (id != 0) {
+        read_queue(id);
+        ++reads;
+      }
+
+      id = load_id(&ctx->task_ids[i]);
+      if (id != 0) {
+        read_task(id);
+        ++reads;
+      }
+    }
+  }
+
+  _Atomic_Fetch_add_ulong(&ctx->reads, reads, ATOMIC_ORDER_RELAXED);
+  _Atomic_Fetch_add_ulong(&ctx->done, 1, ATOMIC_ORDER_RELEASE);
+
+  sc = rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void create_objects(test_context *ctx)
+{
+  rtems_status_code sc;
+  int i;
+
+  for (i = 0; i < OBJECT_COUNT; ++i) {
+    rtems_id id;
+    int j;
+
+    sc = rtems_message_queue_create(
+      rtems_build_name('M', 'S', 'G', 'Q'),
+      MESSAGE_COUNT,
+      sizeof(uint32_t),
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    for (j = 0; j < MESSAGE_COUNT; ++j) {
+      uint32_t message = (uint32_t) j;
+
+      sc = rtems_message_queue_send(id, &message, sizeof(message));
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+
+    store_id(&ctx->queue_ids[i], id);
+
+    sc = rtems_task_create(
+      rtems_build_name('N', 'O', 'T', 'E'),
+      TASK_PRIORITY,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_set_note(id, NOTEPAD, NOTE_VALUE);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    store_id(&ctx->task_ids[i], id);
+  }
+}
+
+static void delete_objects(test_context *ctx)
+{
+  rtems_status_code sc;
+  int i;
+
+  /*
+   * The identifiers stay published, so the readers use them after the
+   * deletion.
+   */
+  for (i = 0; i < OBJECT_COUNT; ++i) {
+    sc = rtems_message_queue_delete(load_id(&ctx->queue_ids[i]));
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_delete(load_id(&ctx->task_ids[i]));
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void check_stale_ids(test_context *ctx)
+{
+  rtems_status_code sc;
+  int i;
+
+  for (i = 0; i < OBJECT_COUNT; ++i) {
+    uint32_t value;
+
+    sc = rtems_message_queue_get_number_pending(
+      load_id(&ctx->queue_ids[i]),
+      &value
+    );
+    rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+    sc = rtems_task_get_note(load_id(&ctx->task_ids[i]), NOTEPAD, &value);
+    rtems_test_assert(sc == RTEMS_INVALID_ID);
+  }
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  uint32_t cpu_count = rtems_smp_get_processor_count();
+  uint32_t cpu;
+  rtems_interval duration = rtems_clock_get_ticks_per_second();
+  rtems_interval start;
+  unsigned long rounds = 0;
+  rtems_status_code sc;
+
+  for (cpu = 1; cpu < cpu_count; ++cpu) {
+    rtems_id id;
+
+    sc = rtems_task_create(
+      rtems_build_name('R', 'E', 'A', 'D'),
+      TASK_PRIORITY,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(id, reader_task, (rtems_task_argument) ctx);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  /*
+   * Each round creates more objects than an allocation unit provides, so the
+   * object information is extended and shrunk while the readers run.
+   */
+  start = rtems_clock_get_ticks_since_boot();
+  do {
+    create_objects(ctx);
+    delete_objects(ctx);
+    check_stale_ids(ctx);
+    ++rounds;
+  } while (rtems_clock_get_ticks_since_boot() - start < duration);
+
+  _Atomic_Store_ulong(&ctx->stop, 1, ATOMIC_ORDER_RELEASE);
+
+  while (
+    _Atomic_Load_ulong(&ctx->done, ATOMIC_ORDER_ACQUIRE) != cpu_count - 1
+  ) {
+    /* Wait */
+  }
+
+  rtems_test_assert(rounds > 0);
+  rtems_test_assert(
+    cpu_count == 1
+      || _Atomic_Load_ulong(&ctx->reads, ATOMIC_ORDER_RELAXED) > 0
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  puts("\n\n*** TEST SMPOBJECTREAD 1 ***");
+
+  test();
+
+  puts("*** END OF TEST SMPOBJECTREAD 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS PROCESSOR_COUNT
+
+#define CONFIGURE_UNIFIED_WORK_AREAS
+
+#define CONFIGURE_MAXIMUM_TASKS rtems_resource_unlimited(OBJECT_UNIT)
+
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES rtems_resource_unlimited(OBJECT_UNIT)
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
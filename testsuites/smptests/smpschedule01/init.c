@@ -20,7 +20,7 @@
 
 #include "tmacros.h"
 
-#define CPU_COUNT 2
+#define PROCESSOR_COUNT 2
 
 #define TASK_COUNT 4
 
@@ -194,7 +194,7 @@ static void Init(rtems_task_argument arg)
 
 #define CONFIGURE_SMP_APPLICATION
 
-#define CONFIGURE_SMP_MAXIMUM_PROCESSORS CPU_COUNT
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS PROCESSOR_COUNT
 
 #define CONFIGURE_MAXIMUM_TASKS TASK_COUNT
 
@@ -0,0 +1,413 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems.h>
+#include <rtems/score/atomic.h>
+
+#include "tmacros.h"
+
+#define TASK_PRIORITY 1
+
+#define PROCESSOR_COUNT 32
+
+#define TEST_COUNT 2
+
+#define DELETE_ROUNDS 10
+
+typedef enum {
+  INITIAL,
+  START_TEST,
+  STOP_TEST
+} test_state;
+
+typedef struct {
+  Atomic_Ulong state;
+  Atomic_Ulong holders;
+  Atomic_Ulong deleted;
+  rtems_id barrier_id;
+  rtems_id timer_id;
+  rtems_interval timeout;
+  uint32_t global_count;
+  rtems_id global_sema_id;
+  rtems_id local_sema_id[PROCESSOR_COUNT];
+  unsigned long test_counter[TEST_COUNT][PROCESSOR_COUNT][PROCESSOR_COUNT];
+} test_context;
+
+static test_context test_instance;
+
+static const char *test_names[TEST_COUNT] = {
+  "obtain and release local semaphore",
+  "obtain and release global semaphore"
+};
+
+static void set_state(test_context *ctx, test_state state)
+{
+  _Atomic_Store_ulong(&ctx->state, state, ATOMIC_ORDER_RELEASE);
+}
+
+static test_state get_state(test_context *ctx)
+{
+  return (test_state) _Atomic_Load_ulong(&ctx->state, ATOMIC_ORDER_ACQUIRE);
+}
+
+static void barrier_wait(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_barrier_wait(ctx->barrier_id, RTEMS_NO_TIMEOUT);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void stop_test_timer(rtems_id timer_id, void *arg)
+{
+  test_context *ctx = arg;
+
+  set_state(ctx, STOP_TEST);
+}
+
+static void enter_critical_section(test_context *ctx, uint32_t count)
+{
+  unsigned long holders;
+
+  holders = _Atomic_Fetch_add_ulong(&ctx->holders, 1, ATOMIC_ORDER_ACQUIRE);
+  rtems_test_assert(holders < count);
+}
+
+static void leave_critical_section(test_context *ctx)
+{
+  unsigned long holders;
+
+  holders = _Atomic_Fetch_sub_ulong(&ctx->holders, 1, ATOMIC_ORDER_RELEASE);
+  rtems_test_assert(holders > 0);
+}
+
+static void check_count(rtems_id id, uint32_t count)
+{
+  rtems_status_code sc;
+  uint32_t i;
+
+  for (i = 0; i < count; ++i) {
+    sc = rtems_semaphore_obtain(id, RTEMS_NO_WAIT, 0);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_semaphore_obtain(id, RTEMS_NO_WAIT, 0);
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  for (i = 0; i < count; ++i) {
+    sc = rtems_semaphore_release(id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void test_body(
+  int test,
+  test_context *ctx,
+  uint32_t active_cpus,
+  uint32_t cpu_self
+)
+{
+  unsigned long counter = 0;
+  uint32_t count;
+  rtems_id id;
+
+  if (test == 0) {
+    id = ctx->local_sema_id[cpu_self];
+    count = 1;
+  } else {
+    id = ctx->global_sema_id;
+    count = ctx->global_count;
+  }
+
+  if (cpu_self < active_cpus) {
+    while (get_state(ctx) == START_TEST) {
+      rtems_status_code sc;
+
+      sc = rtems_semaphore_obtain(id, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+      if (test != 0) {
+        enter_critical_section(ctx, count);
+        leave_critical_section(ctx);
+      }
+
+      sc = rtems_semaphore_release(id);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+      ++counter;
+    }
+  }
+
+  ctx->test_counter[test][active_cpus - 1][cpu_self] = counter;
+}
+
+static void delete_body(test_context *ctx, bool master)
+{
+  rtems_id id = ctx->global_sema_id;
+  rtems_status_code sc;
+
+  if (master) {
+    sc = rtems_task_wake_after(1);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_semaphore_delete(id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    return;
+  }
+
+  /*
+   * Obtain and release may see the semaphore before, during and after the
+   * delete operation.  The identifier is not reused before all processors
+   * passed the barrier.
+   */
+  while (true) {
+    sc = rtems_semaphore_obtain(id, RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    if (sc != RTEMS_SUCCESSFUL) {
+      rtems_test_assert(
+        sc == RTEMS_OBJECT_WAS_DELETED || sc == RTEMS_INVALID_ID
+      );
+      break;
+    }
+
+    enter_critical_section(ctx, ctx->global_count);
+    leave_critical_section(ctx);
+
+    sc = rtems_semaphore_release(id);
+    if (sc != RTEMS_SUCCESSFUL) {
+      rtems_test_assert(sc == RTEMS_INVALID_ID);
+      break;
+    }
+  }
+
+  sc = rtems_semaphore_obtain(id, RTEMS_NO_WAIT, 0);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_semaphore_release(id);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  _Atomic_Fetch_add_ulong(&ctx->deleted, 1, ATOMIC_ORDER_RELAXED);
+}
+
+static rtems_id create_semaphore(uint32_t count)
+{
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_semaphore_create(
+    rtems_build_name('S', 'E', 'M', 'A'),
+    count,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY,
+    0,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return id;
+}
+
+static void run_tests(
+  test_context *ctx,
+  uint32_t cpu_count,
+  uint32_t cpu_self,
+  bool master
+)
+{
+  int test;
+  uint32_t active_cpus;
+  uint32_t cpu;
+  int round;
+
+  for (test = 0; test < TEST_COUNT; ++test) {
+    for (active_cpus = 1; active_cpus <= cpu_count; ++active_cpus) {
+      barrier_wait(ctx);
+
+      if (master) {
+        rtems_status_code sc = rtems_timer_fire_after(
+          ctx->timer_id,
+          ctx->timeout,
+          stop_test_timer,
+          ctx
+        );
+        rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+        set_state(ctx, START_TEST);
+      }
+
+      while (get_state(ctx) == INITIAL) {
+        /* Wait */
+      }
+
+      test_body(test, ctx, active_cpus, cpu_self);
+
+      barrier_wait(ctx);
+
+      if (master) {
+        rtems_test_assert(
+          _Atomic_Load_ulong(&ctx->holders, ATOMIC_ORDER_RELAXED) == 0
+        );
+        check_count(ctx->global_sema_id, ctx->global_count);
+
+        for (cpu = 0; cpu < cpu_count; ++cpu) {
+          check_count(ctx->local_sema_id[cpu], 1);
+        }
+
+        set_state(ctx, INITIAL);
+      }
+    }
+  }
+
+  for (round = 0; round < DELETE_ROUNDS; ++round) {
+    barrier_wait(ctx);
+
+    delete_body(ctx, master);
+
+    barrier_wait(ctx);
+
+    if (master) {
+      rtems_test_assert(
+        _Atomic_Load_ulong(&ctx->holders, ATOMIC_ORDER_RELAXED) == 0
+      );
+
+      ctx->global_sema_id = create_semaphore(ctx->global_count);
+    }
+  }
+
+  barrier_wait(ctx);
+}
+
+static void task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+  uint32_t cpu_count = rtems_smp_get_processor_count();
+  uint32_t cpu_self = rtems_smp_get_current_processor();
+  rtems_status_code sc;
+
+  run_tests(ctx, cpu_count, cpu_self, false);
+
+  sc = rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  uint32_t cpu_count = rtems_smp_get_processor_count();
+  uint32_t cpu_self = rtems_smp_get_current_processor();
+  uint32_t cpu;
+  uint32_t active_cpus;
+  int test;
+  rtems_status_code sc;
+
+  sc = rtems_barrier_create(
+    rtems_build_name('B', 'A', 'R', 'R'),
+    RTEMS_BARRIER_AUTOMATIC_RELEASE,
+    cpu_count,
+    &ctx->barrier_id
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /*
+   * Use less units than processors, so that obtain operations block and
+   * release operations unblock threads.
+   */
+  ctx->global_count = (cpu_count + 1) / 2;
+  ctx->global_sema_id = create_semaphore(ctx->global_count);
+
+  for (cpu = 0; cpu < cpu_count; ++cpu) {
+    ctx->local_sema_id[cpu] = create_semaphore(1);
+
+    if (cpu != cpu_self) {
+      rtems_id task_id;
+
+      sc = rtems_task_create(
+        rtems_build_name('T', 'A', 'S', 'K'),
+        TASK_PRIORITY,
+        RTEMS_MINIMUM_STACK_SIZE,
+        RTEMS_DEFAULT_MODES,
+        RTEMS_DEFAULT_ATTRIBUTES,
+        &task_id
+      );
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+      sc = rtems_task_start(task_id, task, (rtems_task_argument) ctx);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+  }
+
+  ctx->timeout = rtems_clock_get_ticks_per_second();
+
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'R'), &ctx->timer_id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  run_tests(ctx, cpu_count, cpu_self, true);
+
+  rtems_test_assert(
+    _Atomic_Load_ulong(&ctx->deleted, ATOMIC_ORDER_RELAXED)
+      == DELETE_ROUNDS * (cpu_count - 1)
+  );
+
+  for (test = 0; test < TEST_COUNT; ++test) {
+    printf("%s\n", test_names[test]);
+
+    for (active_cpus = 1; active_cpus <= cpu_count; ++active_cpus) {
+      unsigned long sum = 0;
+
+      for (cpu = 0; cpu < active_cpus; ++cpu) {
+        sum += ctx->test_counter[test][active_cpus - 1][cpu];
+      }
+
+      printf(
+        "\tactive processors %" PRIu32 ", sum of local counter %lu\n",
+        active_cpus,
+        sum
+      );
+    }
+  }
+}
+
+static void Init(rtems_task_argument arg)
+{
+  puts("\n\n*** TEST SMPSEMAPHORE 1 ***");
+
+  test();
+
+  puts("*** END OF TEST SMPSEMAPHORE 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_SMP_APPLICATION
+
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS PROCESSOR_COUNT
+
+#define CONFIGURE_MAXIMUM_TASKS PROCESSOR_COUNT
+
+#define CONFIGURE_MAXIMUM_SEMAPHORES (PROCESSOR_COUNT + 1)
+
+#define CONFIGURE_MAXIMUM_BARRIERS 1
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INIT_TASK_PRIORITY TASK_PRIORITY
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_DEFAULT_ATTRIBUTES
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
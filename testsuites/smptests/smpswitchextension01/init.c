@@ -21,7 +21,7 @@
 #include <stdio.h>
 #include <inttypes.h>
 
-#define CPU_COUNT 2
+#define PROCESSOR_COUNT 2
 
 #define TOGGLER_COUNT 2
 
@@ -237,7 +237,7 @@ static void Init(rtems_task_argument arg)
 
 #define CONFIGURE_SMP_APPLICATION
 
-#define CONFIGURE_SMP_MAXIMUM_PROCESSORS CPU_COUNT
+#define CONFIGURE_SMP_MAXIMUM_PROCESSORS PROCESSOR_COUNT
 
 #define CONFIGURE_MAXIMUM_TASKS (3 + TOGGLER_COUNT)
 
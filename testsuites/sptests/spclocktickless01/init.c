@@ -0,0 +1,194 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include "tmacros.h"
+
+#define TIMER_TICKS 3
+
+typedef struct {
+  uint32_t nanoseconds_per_tick;
+  int next_event_counter;
+  int timer_counter;
+} test_context;
+
+static test_context test_instance;
+
+static void next_event(void)
+{
+  ++test_instance.next_event_counter;
+}
+
+static void timer(rtems_id id, void *arg)
+{
+  test_context *ctx = arg;
+
+  ++ctx->timer_counter;
+}
+
+static uint32_t get_nanoseconds_to_next_event(void)
+{
+  rtems_interrupt_level level;
+  uint32_t nanoseconds;
+
+  rtems_interrupt_disable(level);
+  nanoseconds = rtems_clock_get_nanoseconds_to_next_event();
+  rtems_interrupt_enable(level);
+
+  return nanoseconds;
+}
+
+/*
+ * With __RTEMS_USE_TICKS_FOR_STATISTICS__ the scheduler tick needs an event at
+ * each tick boundary, so the next event is at most the rest of the current
+ * tick.
+ */
+static uint32_t expected_next_event(
+  uint32_t to_next_event,
+  uint32_t to_next_tick
+)
+{
+#ifdef __RTEMS_USE_TICKS_FOR_STATISTICS__
+  if (to_next_tick < to_next_event) {
+    return to_next_tick;
+  }
+#else
+  (void) to_next_tick;
+#endif
+
+  return to_next_event;
+}
+
+static uint64_t get_uptime_in_nanoseconds(void)
+{
+  rtems_status_code sc;
+  struct timespec uptime;
+
+  sc = rtems_clock_get_uptime(&uptime);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  return (uint64_t) uptime.tv_sec * 1000000000 + (uint64_t) uptime.tv_nsec;
+}
+
+static void tick_nanoseconds(uint32_t nanoseconds)
+{
+  rtems_status_code sc;
+
+  sc = rtems_clock_tick_nanoseconds(nanoseconds);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_set_next_event_extension(void)
+{
+  rtems_status_code sc;
+
+  sc = rtems_clock_set_next_event_extension(NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_clock_set_next_event_extension(next_event);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_partial_ticks(test_context *ctx)
+{
+  uint32_t half = ctx->nanoseconds_per_tick / 2;
+  rtems_interval ticks = rtems_clock_get_ticks_since_boot();
+  uint64_t uptime = get_uptime_in_nanoseconds();
+
+  rtems_test_assert(
+    get_nanoseconds_to_next_event()
+      == expected_next_event(UINT32_MAX, ctx->nanoseconds_per_tick)
+  );
+
+  tick_nanoseconds(half);
+  rtems_test_assert(rtems_clock_get_ticks_since_boot() == ticks);
+  rtems_test_assert(get_uptime_in_nanoseconds() == uptime + half);
+
+  tick_nanoseconds(ctx->nanoseconds_per_tick - half);
+  rtems_test_assert(rtems_clock_get_ticks_since_boot() == ticks + 1);
+  rtems_test_assert(
+    get_uptime_in_nanoseconds() == uptime + ctx->nanoseconds_per_tick
+  );
+
+  tick_nanoseconds(2 * ctx->nanoseconds_per_tick);
+  rtems_test_assert(rtems_clock_get_ticks_since_boot() == ticks + 3);
+}
+
+static void test_timer(test_context *ctx)
+{
+  uint32_t half = ctx->nanoseconds_per_tick / 2;
+  rtems_status_code sc;
+  rtems_id id;
+
+  sc = rtems_timer_create(rtems_build_name('T', 'I', 'M', 'R'), &id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  tick_nanoseconds(half);
+
+  sc = rtems_timer_fire_after(id, TIMER_TICKS, timer, ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->next_event_counter == 1);
+  rtems_test_assert(
+    get_nanoseconds_to_next_event()
+      == expected_next_event(
+        TIMER_TICKS * ctx->nanoseconds_per_tick - half,
+        ctx->nanoseconds_per_tick - half
+      )
+  );
+
+  tick_nanoseconds(TIMER_TICKS * ctx->nanoseconds_per_tick - half - 1);
+  rtems_test_assert(ctx->timer_counter == 0);
+  rtems_test_assert(
+    get_nanoseconds_to_next_event() == expected_next_event(1, 1)
+  );
+
+  tick_nanoseconds(1);
+  rtems_test_assert(ctx->timer_counter == 1);
+  rtems_test_assert(
+    get_nanoseconds_to_next_event()
+      == expected_next_event(UINT32_MAX, ctx->nanoseconds_per_tick)
+  );
+
+  sc = rtems_timer_delete(id);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+
+  puts("\n\n*** TEST SPCLOCKTICKLESS 1 ***");
+
+  ctx->nanoseconds_per_tick = rtems_configuration_get_nanoseconds_per_tick();
+
+  test_set_next_event_extension();
+  test_partial_ticks(ctx);
+  test_timer(ctx);
+
+  puts("*** END OF TEST SPCLOCKTICKLESS 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -33,7 +33,7 @@ static void test_internal_error_description(void)
     puts( desc );
   } while ( desc != desc_last );
 
-  rtems_test_assert( error - 3 == INTERNAL_ERROR_CPU_ISR_INSTALL_VECTOR );
+  rtems_test_assert( error - 3 == INTERNAL_ERROR_SCHEDULER_INVALID_CLUSTER );
 }
 
 static void test_fatal_source_description(void)
@@ -0,0 +1,383 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <string.h>
+
+#define MESSAGE_COUNT 2
+
+#define MESSAGE_SIZE 32
+
+typedef struct {
+  rtems_id queue;
+  rtems_id worker;
+  void *buffer;
+  size_t size;
+  char content [MESSAGE_SIZE];
+  rtems_status_code status;
+  int receive_count;
+} test_context;
+
+static test_context test_instance;
+
+static void worker_task(rtems_task_argument arg)
+{
+  test_context *ctx = (test_context *) arg;
+
+  while (true) {
+    rtems_status_code sc;
+
+    ctx->status = rtems_message_queue_receive_buffer(
+      ctx->queue,
+      &ctx->buffer,
+      &ctx->size,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    ++ctx->receive_count;
+
+    if (ctx->status == RTEMS_SUCCESSFUL) {
+      memcpy(ctx->content, ctx->buffer, ctx->size);
+
+      sc = rtems_message_queue_release_buffer(ctx->queue, ctx->buffer);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+  }
+}
+
+static void test_errors(test_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffers [MESSAGE_COUNT];
+  void *buffer;
+  char not_a_buffer [MESSAGE_SIZE];
+  size_t size;
+  uint32_t count;
+  int i;
+
+  sc = rtems_message_queue_get_buffer(ctx->queue, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_get_buffer(0, &buffer);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    NULL,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &buffer,
+    NULL,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_UNSATISFIED);
+
+  sc = rtems_message_queue_send_buffer(ctx->queue, not_a_buffer, 1);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_release_buffer(ctx->queue, not_a_buffer);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    sc = rtems_message_queue_get_buffer(ctx->queue, &buffers [i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_message_queue_get_buffer(ctx->queue, &buffer);
+  rtems_test_assert(sc == RTEMS_TOO_MANY);
+
+  sc = rtems_message_queue_send(ctx->queue, "x", 1);
+  rtems_test_assert(sc == RTEMS_TOO_MANY);
+
+  sc = rtems_message_queue_send_buffer(ctx->queue, buffers [0], 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(buffer == buffers [0]);
+  rtems_test_assert(size == 1);
+
+  sc = rtems_message_queue_send_buffer(
+    ctx->queue,
+    buffers [1],
+    MESSAGE_SIZE + 1
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_SIZE);
+
+  for (i = 0; i < MESSAGE_COUNT; ++i) {
+    sc = rtems_message_queue_release_buffer(ctx->queue, buffers [i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  /* Only message buffers owned by the application are accepted */
+  sc = rtems_message_queue_release_buffer(ctx->queue, buffers [0]);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_send_buffer(ctx->queue, buffers [0], 1);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_get_buffer(ctx->queue, &buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_send_buffer(ctx->queue, buffer, 1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_send_buffer(ctx->queue, buffer, 1);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_release_buffer(ctx->queue, buffer);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_message_queue_get_number_pending(ctx->queue, &count);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(count == 1);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_release_buffer(ctx->queue, buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_release_buffer(ctx->queue, buffer);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+}
+
+static void test_zero_copy(test_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffer;
+  void *received;
+  char message [MESSAGE_SIZE];
+  size_t size;
+
+  sc = rtems_message_queue_get_buffer(ctx->queue, &buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  memcpy(buffer, "zero", 4);
+
+  sc = rtems_message_queue_send_buffer(ctx->queue, buffer, 4);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &received,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(received == buffer);
+  rtems_test_assert(size == 4);
+  rtems_test_assert(memcmp(received, "zero", 4) == 0);
+
+  /* Forward the received message buffer */
+  sc = rtems_message_queue_send_buffer(ctx->queue, received, 4);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* A copy receive frees the message buffer */
+  sc = rtems_message_queue_receive(
+    ctx->queue,
+    message,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(size == 4);
+  rtems_test_assert(memcmp(message, "zero", 4) == 0);
+
+  /* A buffer receive of a copied message */
+  sc = rtems_message_queue_send(ctx->queue, "copy", 4);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &received,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(size == 4);
+  rtems_test_assert(memcmp(received, "copy", 4) == 0);
+
+  sc = rtems_message_queue_release_buffer(ctx->queue, received);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test_blocked_receiver(test_context *ctx)
+{
+  rtems_status_code sc;
+  void *buffer;
+  void *other;
+  uint32_t count;
+
+  sc = rtems_task_start(ctx->worker, worker_task, (rtems_task_argument) ctx);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(ctx->receive_count == 0);
+
+  /* Hand over the message buffer to the blocked receiver */
+  sc = rtems_message_queue_get_buffer(ctx->queue, &buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  memcpy(buffer, "handover", 8);
+
+  sc = rtems_message_queue_send_buffer(ctx->queue, buffer, 8);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->receive_count == 1);
+  rtems_test_assert(ctx->status == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->buffer == buffer);
+  rtems_test_assert(ctx->size == 8);
+  rtems_test_assert(memcmp(ctx->content, "handover", 8) == 0);
+
+  /* A copied message needs a free message buffer for the receiver */
+  sc = rtems_message_queue_send(ctx->queue, "send", 4);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->receive_count == 2);
+  rtems_test_assert(ctx->status == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->size == 4);
+  rtems_test_assert(memcmp(ctx->content, "send", 4) == 0);
+
+  sc = rtems_message_queue_broadcast(ctx->queue, "broadcast", 9, &count);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(count == 1);
+  rtems_test_assert(ctx->receive_count == 3);
+  rtems_test_assert(ctx->status == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->size == 9);
+  rtems_test_assert(memcmp(ctx->content, "broadcast", 9) == 0);
+
+  /* The receive fails if all message buffers are owned by tasks */
+  sc = rtems_message_queue_get_buffer(ctx->queue, &buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_get_buffer(ctx->queue, &other);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_send(ctx->queue, "fail", 4);
+  rtems_test_assert(sc == RTEMS_TOO_MANY);
+  rtems_test_assert(ctx->receive_count == 4);
+  rtems_test_assert(ctx->status == RTEMS_TOO_MANY);
+
+  sc = rtems_message_queue_release_buffer(ctx->queue, buffer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_message_queue_release_buffer(ctx->queue, other);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  /* Released message buffers must not wake up the blocked receiver */
+  rtems_test_assert(ctx->receive_count == 4);
+
+  sc = rtems_message_queue_get_number_pending(ctx->queue, &count);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(count == 0);
+
+  sc = rtems_message_queue_send(ctx->queue, "after", 5);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->receive_count == 5);
+  rtems_test_assert(ctx->status == RTEMS_SUCCESSFUL);
+  rtems_test_assert(ctx->size == 5);
+  rtems_test_assert(memcmp(ctx->content, "after", 5) == 0);
+
+  sc = rtems_task_delete(ctx->worker);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_create(
+    rtems_build_name('M', 'S', 'G', 'Q'),
+    MESSAGE_COUNT,
+    MESSAGE_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->queue
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_create(
+    rtems_build_name('W', 'O', 'R', 'K'),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_errors(ctx);
+  test_zero_copy(ctx);
+  test_blocked_receiver(ctx);
+
+  sc = rtems_message_queue_delete(ctx->queue);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  puts("\n\n*** TEST SPMSGQ 1 ***");
+
+  test();
+
+  puts("*** END OF TEST SPMSGQ 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE(MESSAGE_COUNT, MESSAGE_SIZE)
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
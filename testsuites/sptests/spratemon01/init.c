@@ -0,0 +1,170 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#define PERIOD_TICKS 2
+
+#define PERIOD_COUNT 10
+
+static rtems_rate_monotonic_histograms histograms;
+
+static rtems_rate_monotonic_histograms snapshot;
+
+static void test_percentile(void)
+{
+  rtems_rate_monotonic_histogram h;
+
+  memset(&h, 0, sizeof(h));
+  rtems_test_assert(rtems_rate_monotonic_histogram_percentile(&h, 500) == 0);
+
+  h.buckets[3] = 50;
+  h.buckets[5] = 49;
+  h.buckets[10] = 1;
+  h.count = 100;
+
+  rtems_test_assert(rtems_rate_monotonic_histogram_percentile(&h, 0) == 15);
+  rtems_test_assert(rtems_rate_monotonic_histogram_percentile(&h, 500) == 15);
+  rtems_test_assert(rtems_rate_monotonic_histogram_percentile(&h, 900) == 63);
+  rtems_test_assert(rtems_rate_monotonic_histogram_percentile(&h, 990) == 63);
+  rtems_test_assert(rtems_rate_monotonic_histogram_percentile(&h, 999) == 2047);
+  rtems_test_assert(
+    rtems_rate_monotonic_histogram_percentile(&h, 1000) == 2047
+  );
+
+  h.buckets[RTEMS_RATE_MONOTONIC_HISTOGRAM_BUCKETS - 1] = 1;
+  h.count = 101;
+
+  rtems_test_assert(
+    rtems_rate_monotonic_histogram_percentile(&h, 1000) == UINT64_MAX
+  );
+}
+
+static void test_invalid(rtems_id period)
+{
+  rtems_status_code sc;
+
+  sc = rtems_rate_monotonic_get_histograms(period, &snapshot);
+  rtems_test_assert(sc == RTEMS_NOT_DEFINED);
+
+  sc = rtems_rate_monotonic_get_histograms(period, NULL);
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_rate_monotonic_get_histograms(0, &snapshot);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  sc = rtems_rate_monotonic_set_histograms(0, &histograms);
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+}
+
+static void test_periods(rtems_id period)
+{
+  rtems_status_code sc;
+  int i;
+
+  memset(&histograms, 0xff, sizeof(histograms));
+
+  sc = rtems_rate_monotonic_set_histograms(period, &histograms);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_rate_monotonic_get_histograms(period, &snapshot);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(snapshot.release_jitter.count == 0);
+  rtems_test_assert(snapshot.miss_count == 0);
+
+  /*
+   * The first call initiates the period.  Each further call concludes a
+   * period and blocks until the next release.
+   */
+  for (i = 0; i < PERIOD_COUNT; ++i) {
+    sc = rtems_rate_monotonic_period(period, PERIOD_TICKS);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  sc = rtems_rate_monotonic_get_histograms(period, &snapshot);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(snapshot.release_jitter.count == PERIOD_COUNT - 1);
+  rtems_test_assert(snapshot.execution_time.count == PERIOD_COUNT - 1);
+  rtems_test_assert(snapshot.response_time.count == PERIOD_COUNT - 1);
+  rtems_test_assert(snapshot.miss_count == 0);
+
+  /*
+   * Miss the deadline of the current period.
+   */
+  sc = rtems_task_wake_after(2 * PERIOD_TICKS);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_rate_monotonic_period(period, PERIOD_TICKS);
+  rtems_test_assert(sc == RTEMS_TIMEOUT);
+
+  sc = rtems_rate_monotonic_get_histograms(period, &snapshot);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(snapshot.release_jitter.count == PERIOD_COUNT - 1);
+  rtems_test_assert(snapshot.response_time.count == PERIOD_COUNT);
+  rtems_test_assert(snapshot.miss_count == 1);
+  rtems_test_assert(snapshot.miss_timestamps[0] != 0);
+
+  rtems_rate_monotonic_report_statistics();
+
+  sc = rtems_rate_monotonic_reset_statistics(period);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_rate_monotonic_get_histograms(period, &snapshot);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(snapshot.response_time.count == 0);
+  rtems_test_assert(snapshot.miss_count == 0);
+
+  sc = rtems_rate_monotonic_set_histograms(period, NULL);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_rate_monotonic_get_histograms(period, &snapshot);
+  rtems_test_assert(sc == RTEMS_NOT_DEFINED);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  rtems_status_code sc;
+  rtems_id period;
+
+  puts("\n\n*** TEST SPRATEMON 1 ***");
+
+  test_percentile();
+
+  sc = rtems_rate_monotonic_create(
+    rtems_build_name('P', 'E', 'R', 'D'),
+    &period
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_invalid(period);
+  test_periods(period);
+
+  sc = rtems_rate_monotonic_delete(period);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  puts("*** END OF TEST SPRATEMON 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+#define CONFIGURE_MAXIMUM_PERIODS 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
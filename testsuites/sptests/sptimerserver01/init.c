@@ -0,0 +1,277 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+  #include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#define LOW_PRIORITY 10
+
+#define HIGH_PRIORITY 5
+
+#define BUSY_TICKS 50
+
+typedef struct {
+  rtems_id low_server;
+  rtems_id high_server;
+  rtems_id low_timer;
+  rtems_id high_timer;
+  rtems_id low_executor;
+  rtems_id high_executor;
+  volatile bool high_fired;
+  bool preempted;
+  int low_count;
+} test_context;
+
+static test_context test_instance;
+
+static void high_routine(rtems_id timer, void *arg)
+{
+  test_context *ctx = arg;
+
+  ctx->high_executor = rtems_task_self();
+  ctx->high_fired = true;
+}
+
+static void low_routine(rtems_id timer, void *arg)
+{
+  test_context *ctx = arg;
+  rtems_interval start = rtems_clock_get_ticks_since_boot();
+
+  ctx->low_executor = rtems_task_self();
+  ++ctx->low_count;
+
+  /*
+   * Busy wait until the high priority timer server executed its timer or the
+   * time is up.  The high priority timer server must preempt us.
+   */
+  while (
+    !ctx->high_fired
+      && rtems_clock_get_ticks_since_boot() - start < BUSY_TICKS
+  ) {
+    /* Wait */
+  }
+
+  ctx->preempted = ctx->high_fired;
+}
+
+static void test_errors(test_context *ctx)
+{
+  rtems_status_code sc;
+  rtems_id id;
+  rtems_time_of_day wall_time;
+
+  sc = rtems_timer_create_server(
+    rtems_build_name('E', 'R', 'R', ' '),
+    LOW_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    RTEMS_TIMER_SERVER_ANY_PROCESSOR,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_timer_create_server(
+    rtems_build_name('E', 'R', 'R', ' '),
+    0,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    RTEMS_TIMER_SERVER_ANY_PROCESSOR,
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_PRIORITY);
+
+  sc = rtems_timer_create_server(
+    rtems_build_name('E', 'R', 'R', ' '),
+    LOW_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    rtems_smp_get_processor_count(),
+    &id
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_timer_server_fire_after_on(
+    ctx->low_timer,
+    ctx->low_timer,
+    1,
+    low_routine,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  sc = rtems_timer_server_fire_after_on(
+    ctx->low_server,
+    ctx->low_timer,
+    1,
+    NULL,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ADDRESS);
+
+  sc = rtems_timer_server_fire_after_on(
+    ctx->low_server,
+    ctx->low_timer,
+    0,
+    low_routine,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_NUMBER);
+
+  sc = rtems_timer_server_fire_after_on(
+    ctx->low_server,
+    ctx->low_server,
+    1,
+    low_routine,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_INVALID_ID);
+
+  memset(&wall_time, 0, sizeof(wall_time));
+  sc = rtems_timer_server_fire_when_on(
+    ctx->low_timer,
+    ctx->low_timer,
+    &wall_time,
+    low_routine,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+
+  sc = rtems_timer_server_fire_when_on(
+    ctx->low_server,
+    ctx->low_timer,
+    &wall_time,
+    low_routine,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_NOT_DEFINED);
+
+  sc = rtems_timer_server_fire_after(ctx->low_timer, 1, low_routine, ctx);
+  rtems_test_assert(sc == RTEMS_INCORRECT_STATE);
+}
+
+static void test_preemption(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  sc = rtems_timer_server_fire_after_on(
+    ctx->low_server,
+    ctx->low_timer,
+    1,
+    low_routine,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_server_fire_after_on(
+    ctx->high_server,
+    ctx->high_timer,
+    3,
+    high_routine,
+    ctx
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_wake_after(BUSY_TICKS + 10);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(ctx->low_count == 1);
+  rtems_test_assert(ctx->high_fired);
+  rtems_test_assert(ctx->preempted);
+  rtems_test_assert(ctx->low_executor == ctx->low_server);
+  rtems_test_assert(ctx->high_executor == ctx->high_server);
+}
+
+static void test_reset(test_context *ctx)
+{
+  rtems_status_code sc;
+
+  ctx->low_executor = 0;
+  ctx->high_fired = true;
+
+  sc = rtems_timer_reset(ctx->low_timer);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_task_wake_after(10);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_test_assert(ctx->low_count == 2);
+  rtems_test_assert(ctx->low_executor == ctx->low_server);
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  rtems_status_code sc;
+
+  sc = rtems_timer_create(
+    rtems_build_name('L', 'O', 'W', ' '),
+    &ctx->low_timer
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_create(
+    rtems_build_name('H', 'I', 'G', 'H'),
+    &ctx->high_timer
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_create_server(
+    rtems_build_name('T', 'S', 'L', 'O'),
+    LOW_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    0,
+    &ctx->low_server
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_timer_create_server(
+    rtems_build_name('T', 'S', 'H', 'I'),
+    HIGH_PRIORITY,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    RTEMS_TIMER_SERVER_ANY_PROCESSOR,
+    &ctx->high_server
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  test_errors(ctx);
+  test_preemption(ctx);
+  test_reset(ctx);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  puts("\n\n*** TEST SPTIMERSERVER 1 ***");
+
+  test();
+
+  puts("*** END OF TEST SPTIMERSERVER 1 ***");
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 3
+#define CONFIGURE_MAXIMUM_TIMERS 2
+
+#define CONFIGURE_MEMORY_OVERHEAD 1
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY 20
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
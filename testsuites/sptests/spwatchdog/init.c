@@ -45,21 +45,70 @@ static void test_watchdog_static_init( void )
   rtems_test_assert( memcmp( &a, &b, sizeof( a ) ) == 0 );
 }
 
+static void test_watchdog_insert_and_remove( void )
+{
+  static const Watchdog_Interval initial[] = { 5, 1, 3, 3, 7 };
+  static const size_t order[] = { 1, 2, 3, 0, 4 };
+  static const Watchdog_Interval delta[] = { 1, 2, 0, 2, 2 };
+  Watchdog_Header header;
+  Watchdog_Control watchdogs[ RTEMS_ARRAY_SIZE( initial ) ];
+  Watchdog_Control *the_watchdog;
+  Watchdog_States state;
+  size_t i;
+
+  _Watchdog_Header_initialize( &header );
+
+  for ( i = 0 ; i < RTEMS_ARRAY_SIZE( initial ) ; ++i ) {
+    _Watchdog_Initialize( &watchdogs[ i ], test_watchdog_routine, 0, NULL );
+    watchdogs[ i ].initial = initial[ i ];
+    _Watchdog_Insert( &header, &watchdogs[ i ] );
+  }
+
+  the_watchdog = _Watchdog_First( &header );
+  for ( i = 0 ; i < RTEMS_ARRAY_SIZE( order ) ; ++i ) {
+    rtems_test_assert( the_watchdog == &watchdogs[ order[ i ] ] );
+    rtems_test_assert( the_watchdog->delta_interval == delta[ i ] );
+    the_watchdog = _Watchdog_Next( the_watchdog );
+  }
+
+  /* The successor inherits the delta interval of a removed watchdog */
+  state = _Watchdog_Remove( &watchdogs[ 2 ] );
+  rtems_test_assert( state == WATCHDOG_ACTIVE );
+  rtems_test_assert( watchdogs[ 3 ].delta_interval == 2 );
+
+  /* The time base of the index follows changes of the first delta */
+  _Watchdog_First( &header )->delta_interval = 0;
+  watchdogs[ 2 ].initial = 4;
+  _Watchdog_Insert( &header, &watchdogs[ 2 ] );
+  rtems_test_assert( _Watchdog_Next( &watchdogs[ 0 ] ) == &watchdogs[ 2 ] );
+  rtems_test_assert( watchdogs[ 2 ].delta_interval == 0 );
+  rtems_test_assert( watchdogs[ 4 ].delta_interval == 2 );
+
+  for ( i = 0 ; i < RTEMS_ARRAY_SIZE( initial ) ; ++i ) {
+    state = _Watchdog_Remove( &watchdogs[ i ] );
+    rtems_test_assert( state == WATCHDOG_ACTIVE );
+  }
+
+  rtems_test_assert( _Watchdog_Is_empty( &header ) );
+  rtems_test_assert( _RBTree_Is_empty( &header.Index ) );
+}
+
 rtems_task Init(
   rtems_task_argument argument
 )
 {
   rtems_time_of_day  time;
   rtems_status_code  status;
-  Chain_Control      empty;
+  Watchdog_Header    empty;
 
    puts( "\n*** RTEMS WATCHDOG ***" );
 
   puts( "INIT - report on empty watchdog chain" );
 
   test_watchdog_static_init();
+  test_watchdog_insert_and_remove();
 
-  _Chain_Initialize_empty( &empty );
+  _Watchdog_Header_initialize( &empty );
   _Watchdog_Report_chain( "Empty Chain", &empty );
 
   build_time( &time, 12, 31, 1988, 9, 0, 0, 0 );
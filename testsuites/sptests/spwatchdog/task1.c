@@ -78,16 +78,16 @@ rtems_task Task_1(
   directive_failed( status, "rtems_timer_reset" );
 
   puts( "TA1 - _Watchdog_Report_chain - with name"  );
-  _Watchdog_Report_chain( "_Watchdog_Ticks_chain", & _Watchdog_Ticks_chain );
+  _Watchdog_Report_chain( "_Watchdog_Ticks_header", & _Watchdog_Ticks_header );
 
   puts( "TA1 - _Watchdog_Report_chain - no name"  );
-  _Watchdog_Report_chain( NULL, & _Watchdog_Ticks_chain);
+  _Watchdog_Report_chain( NULL, & _Watchdog_Ticks_header);
 
   puts( "TA1 - _Watchdog_Report - with name"  );
-  _Watchdog_Report("first", (Watchdog_Control *)_Chain_First(&_Watchdog_Ticks_chain));
+  _Watchdog_Report("first", _Watchdog_First(&_Watchdog_Ticks_header));
 
   puts( "TA1 - _Watchdog_Report - no name"  );
-  _Watchdog_Report( NULL, (Watchdog_Control *)_Chain_First(&_Watchdog_Ticks_chain) );
+  _Watchdog_Report( NULL, _Watchdog_First(&_Watchdog_Ticks_header) );
 
   puts( "TA1 - timer_deleting - timer 1" );
   status = rtems_timer_delete( tmid );
@@ -0,0 +1,147 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <bsp.h>
+#include <coverhd.h>
+#include <tmacros.h>
+#include <timesys.h>
+#include "test_support.h"
+
+#include <rtems/score/watchdogimpl.h>
+
+#define MAXIMUM_ACTIVE_WATCHDOGS 10000
+
+static const int active_counts[] = { 10, 100, 1000, MAXIMUM_ACTIVE_WATCHDOGS };
+
+static Watchdog_Header header;
+
+static Watchdog_Control active[ MAXIMUM_ACTIVE_WATCHDOGS ];
+
+static Watchdog_Control probe[ OPERATION_COUNT ];
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static void watchdog_routine( Objects_Id id, void *arg )
+{
+  rtems_test_assert( 0 );
+}
+
+/*
+ *  Spread the intervals so that the insert position is not always at the
+ *  head or tail of the delta chain.
+ */
+static Watchdog_Interval interval_of( int index )
+{
+  return (Watchdog_Interval) ( ( index * 7919 ) % 10007 ) + 1;
+}
+
+static void insert_watchdog( Watchdog_Control *the_watchdog, int index )
+{
+  _Watchdog_Initialize( the_watchdog, watchdog_routine, 0, NULL );
+  the_watchdog->initial = interval_of( index );
+  _Watchdog_Insert( &header, the_watchdog );
+}
+
+static void benchmark_watchdog_insert(
+  int    iteration,
+  void  *argument
+)
+{
+  insert_watchdog( &probe[ iteration ], iteration );
+}
+
+static void benchmark_watchdog_remove(
+  int    iteration,
+  void  *argument
+)
+{
+  (void) _Watchdog_Remove( &probe[ iteration ] );
+}
+
+static void measure( int active_count )
+{
+  char description[ 64 ];
+  int  i;
+
+  _Watchdog_Header_initialize( &header );
+
+  for ( i = 0 ; i < active_count ; i++ ) {
+    insert_watchdog( &active[ i ], i );
+  }
+
+  snprintf(
+    description,
+    sizeof( description ),
+    "_Watchdog_Insert: %d active watchdogs",
+    active_count
+  );
+  rtems_time_test_measure_operation(
+    description,
+    benchmark_watchdog_insert,
+    NULL,
+    OPERATION_COUNT,
+    0
+  );
+
+  snprintf(
+    description,
+    sizeof( description ),
+    "_Watchdog_Remove: %d active watchdogs",
+    active_count
+  );
+  rtems_time_test_measure_operation(
+    description,
+    benchmark_watchdog_remove,
+    NULL,
+    OPERATION_COUNT,
+    0
+  );
+
+  for ( i = 0 ; i < active_count ; i++ ) {
+    (void) _Watchdog_Remove( &active[ i ] );
+  }
+
+  rtems_test_assert( _Watchdog_Is_empty( &header ) );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  size_t i;
+
+  puts( "\n\n*** TIME TEST 31 ***" );
+
+  for ( i = 0 ; i < RTEMS_ARRAY_SIZE( active_counts ) ; i++ ) {
+    measure( active_counts[ i ] );
+  }
+
+  puts( "*** END OF TIME TEST 31 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS             1
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
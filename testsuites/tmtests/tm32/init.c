@@ -0,0 +1,159 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <bsp.h>
+#include <coverhd.h>
+#include <tmacros.h>
+#include <timesys.h>
+#include "test_support.h"
+
+#define MAXIMUM_MESSAGE_SIZE 4096
+
+static const size_t message_sizes[] = { 16, 256, MAXIMUM_MESSAGE_SIZE };
+
+static rtems_id queue;
+
+static char send_buffer[ MAXIMUM_MESSAGE_SIZE ];
+
+static char receive_buffer[ MAXIMUM_MESSAGE_SIZE ];
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static void benchmark_copy(
+  int    iteration,
+  void  *argument
+)
+{
+  size_t            size = *(const size_t *) argument;
+  size_t            received_size;
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_send( queue, send_buffer, size );
+  directive_failed( sc, "rtems_message_queue_send" );
+
+  sc = rtems_message_queue_receive(
+    queue,
+    receive_buffer,
+    &received_size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  directive_failed( sc, "rtems_message_queue_receive" );
+}
+
+static void benchmark_zero_copy(
+  int    iteration,
+  void  *argument
+)
+{
+  size_t            size = *(const size_t *) argument;
+  size_t            received_size;
+  void             *buffer;
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_get_buffer( queue, &buffer );
+  directive_failed( sc, "rtems_message_queue_get_buffer" );
+
+  sc = rtems_message_queue_send_buffer( queue, buffer, size );
+  directive_failed( sc, "rtems_message_queue_send_buffer" );
+
+  sc = rtems_message_queue_receive_buffer(
+    queue,
+    &buffer,
+    &received_size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  directive_failed( sc, "rtems_message_queue_receive_buffer" );
+
+  sc = rtems_message_queue_release_buffer( queue, buffer );
+  directive_failed( sc, "rtems_message_queue_release_buffer" );
+}
+
+static void measure( size_t size )
+{
+  char description[ 64 ];
+
+  snprintf(
+    description,
+    sizeof( description ),
+    "message copy: %zu bytes",
+    size
+  );
+  rtems_time_test_measure_operation(
+    description,
+    benchmark_copy,
+    &size,
+    OPERATION_COUNT,
+    0
+  );
+
+  snprintf(
+    description,
+    sizeof( description ),
+    "message zero-copy: %zu bytes",
+    size
+  );
+  rtems_time_test_measure_operation(
+    description,
+    benchmark_zero_copy,
+    &size,
+    OPERATION_COUNT,
+    0
+  );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code sc;
+  size_t            i;
+
+  puts( "\n\n*** TIME TEST 32 ***" );
+
+  sc = rtems_message_queue_create(
+    rtems_build_name( 'M', 'Q', '1', ' ' ),
+    1,
+    MAXIMUM_MESSAGE_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &queue
+  );
+  directive_failed( sc, "rtems_message_queue_create" );
+
+  for ( i = 0 ; i < RTEMS_ARRAY_SIZE( message_sizes ) ; i++ ) {
+    measure( message_sizes[ i ] );
+  }
+
+  puts( "*** END OF TIME TEST 32 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS             1
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES    1
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( 1, MAXIMUM_MESSAGE_SIZE )
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */
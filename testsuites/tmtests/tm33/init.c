@@ -0,0 +1,217 @@
+/*
+ *  COPYRIGHT (c) 2013.
+ *  On-Line Applications Research Corporation (OAR).
+ *
+ *  The license and distribution terms for this file may be
+ *  found in the file LICENSE in this distribution or at
+ *  http://www.rtems.com/license/LICENSE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <bsp.h>
+#include <coverhd.h>
+#include <tmacros.h>
+#include <timesys.h>
+
+#define WAITER_COUNT_MAXIMUM 500
+
+#define INIT_PRIORITY 250
+
+/*
+ *  The waiters use the priorities 2 up to the priority above the Init task.
+ *  A step which is coprime to the priority span distributes the waiters over
+ *  all priorities and inserts them out of order.
+ */
+#define WAITER_PRIORITY_FIRST 2
+
+#define WAITER_PRIORITY_SPAN (INIT_PRIORITY - WAITER_PRIORITY_FIRST)
+
+#define WAITER_PRIORITY_STEP 37
+
+static const uint32_t waiter_counts[] = { 10, WAITER_COUNT_MAXIMUM };
+
+static rtems_id semaphore;
+
+static rtems_id waiters[ WAITER_COUNT_MAXIMUM ];
+
+rtems_task Init(
+  rtems_task_argument argument
+);
+
+static rtems_task Waiter(
+  rtems_task_argument argument
+)
+{
+  (void) rtems_semaphore_obtain(
+    semaphore,
+    RTEMS_DEFAULT_OPTIONS,
+    RTEMS_NO_TIMEOUT
+  );
+
+  rtems_test_assert( 0 );
+}
+
+static rtems_task Probe(
+  rtems_task_argument argument
+)
+{
+  benchmark_timer_initialize();
+
+  (void) rtems_semaphore_obtain(
+    semaphore,
+    RTEMS_DEFAULT_OPTIONS,
+    RTEMS_NO_TIMEOUT
+  );
+
+  rtems_test_assert( 0 );
+}
+
+static void create_waiters( uint32_t count )
+{
+  rtems_status_code   sc;
+  rtems_task_priority priority;
+  uint32_t            i;
+
+  for ( i = 0 ; i < count ; i++ ) {
+    priority = WAITER_PRIORITY_FIRST +
+      ( i * WAITER_PRIORITY_STEP ) % WAITER_PRIORITY_SPAN;
+
+    sc = rtems_task_create(
+      rtems_build_name( 'W', 'A', 'I', 'T' ),
+      priority,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &waiters[ i ]
+    );
+    directive_failed( sc, "rtems_task_create of waiter" );
+
+    /* the waiter preempts the Init task and blocks on the semaphore */
+    sc = rtems_task_start( waiters[ i ], Waiter, 0 );
+    directive_failed( sc, "rtems_task_start of waiter" );
+  }
+}
+
+static void delete_waiters( uint32_t count )
+{
+  rtems_status_code sc;
+  uint32_t          i;
+
+  for ( i = 0 ; i < count ; i++ ) {
+    sc = rtems_task_delete( waiters[ i ] );
+    directive_failed( sc, "rtems_task_delete of waiter" );
+  }
+}
+
+static uint32_t measure_enqueue( rtems_task_priority priority )
+{
+  rtems_status_code sc;
+  rtems_id          probe;
+  uint32_t          time;
+
+  sc = rtems_task_create(
+    rtems_build_name( 'P', 'R', 'O', 'B' ),
+    priority,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &probe
+  );
+  directive_failed( sc, "rtems_task_create of probe" );
+
+  /* the probe preempts the Init task and starts the timer before it blocks */
+  sc = rtems_task_start( probe, Probe, 0 );
+  directive_failed( sc, "rtems_task_start of probe" );
+
+  time = benchmark_timer_read();
+
+  sc = rtems_task_delete( probe );
+  directive_failed( sc, "rtems_task_delete of probe" );
+
+  return time;
+}
+
+static void measure( uint32_t count )
+{
+  rtems_task_priority priority;
+  uint32_t            time;
+  uint32_t            worst = 0;
+  uint32_t            total = 0;
+  uint32_t            probes = 0;
+
+  create_waiters( count );
+
+  for ( priority = 1 ; priority < INIT_PRIORITY ; priority++ ) {
+    time = measure_enqueue( priority );
+    total += time;
+    ++probes;
+
+    if ( time > worst ) {
+      worst = time;
+    }
+  }
+
+  printf(
+    "rtems_semaphore_obtain: caller blocks, %" PRIu32 " waiters -- "
+      "worst case %" PRIu32 "\n",
+    count,
+    worst - CALLING_OVERHEAD_SEMAPHORE_OBTAIN
+  );
+  put_time(
+    "rtems_semaphore_obtain: caller blocks -- average",
+    total,
+    probes,
+    0,
+    CALLING_OVERHEAD_SEMAPHORE_OBTAIN
+  );
+
+  delete_waiters( count );
+}
+
+rtems_task Init(
+  rtems_task_argument argument
+)
+{
+  rtems_status_code sc;
+  size_t            i;
+
+  Print_Warning();
+
+  puts( "\n\n*** TIME TEST 33 ***" );
+
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'S', 'E', 'M', '1' ),
+    0,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY,
+    0,
+    &semaphore
+  );
+  directive_failed( sc, "rtems_semaphore_create" );
+
+  for ( i = 0 ; i < RTEMS_ARRAY_SIZE( waiter_counts ) ; i++ ) {
+    measure( waiter_counts[ i ] );
+  }
+
+  puts( "*** END OF TIME TEST 33 ***" );
+
+  rtems_test_exit(0);
+}
+
+/* configuration information */
+
+#define CONFIGURE_APPLICATION_NEEDS_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_TIMER_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS             (WAITER_COUNT_MAXIMUM + 2)
+#define CONFIGURE_MAXIMUM_SEMAPHORES        1
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_PRIORITY        INIT_PRIORITY
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
+/* end of file */